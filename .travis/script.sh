@@ -436,6 +436,7 @@ build_samr21() {
 [ $BUILD_TARGET != posix-app-pty ] || {
     ./bootstrap
     .travis/check-posix-app-pty || die
+    OT_CLI_PATH="$(pwd)/$(ls output/posix/*linux*/bin/ot-cli)" RADIO_DEVICE="$(pwd)/$(ls output/*linux*/bin/ot-ncp-radio)" .travis/bench-posix-app-pty || die
 }
 
 [ $BUILD_TARGET != posix-mtd ] || {
@@ -456,6 +457,24 @@ build_samr21() {
     CERT_LOG=1 COVERAGE=1 PYTHONUNBUFFERED=1 OT_NCP_PATH="$(pwd)/$(ls output/posix/*/bin/ot-ncp)" RADIO_DEVICE="$(pwd)/$(ls output/*/bin/ot-ncp-radio)" NODE_TYPE=ncp-sim make -f src/posix/Makefile-posix check || die
 }
 
+[ $BUILD_TARGET != posix-unit-config ] || {
+    # Run the unit tests against core builds with non-default configurations.
+
+    git checkout -- . || die
+
+    for cppflags in \
+        "-DOPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES=512" \
+        "-DOPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET=2 -DOPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH=3 \
+         -DOPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL=4" \
+        "-DOPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP=1" \
+        "-DOPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS=1"; do
+        git clean -xfd || die
+        ./bootstrap || die
+        CPPFLAGS="$cppflags" make -f examples/Makefile-posix build || die
+        make -C build/*/tests/unit check || die
+    done
+}
+
 [ $BUILD_TARGET != posix-ncp ] || {
     ./bootstrap || die
     CERT_LOG=1 COVERAGE=1 PYTHONUNBUFFERED=1 NODE_TYPE=ncp-sim make -f examples/Makefile-posix check || die
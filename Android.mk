@@ -123,6 +123,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/common/timer.cpp                               \
     src/core/common/tlvs.cpp                                \
     src/core/common/trickle_timer.cpp                       \
+    src/core/crypto/aes_accel.cpp                           \
     src/core/crypto/aes_ccm.cpp                             \
     src/core/crypto/aes_ecb.cpp                             \
     src/core/crypto/hmac_sha256.cpp                         \
@@ -170,6 +171,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/thread/child_table.cpp                         \
     src/core/thread/data_poll_manager.cpp                   \
     src/core/thread/energy_scan_server.cpp                  \
+    src/core/thread/indirect_queue.cpp                      \
     src/core/thread/key_manager.cpp                         \
     src/core/thread/link_quality.cpp                        \
     src/core/thread/lowpan.cpp                              \
@@ -207,7 +209,9 @@ LOCAL_SRC_FILES                                          := \
     src/posix/platform/alarm.c                              \
     src/posix/platform/hdlc_interface.cpp                   \
     src/posix/platform/logging.c                            \
+    src/posix/platform/message_pool.c                       \
     src/posix/platform/misc.c                               \
+    src/posix/platform/poller.c                             \
     src/posix/platform/radio_spinel.cpp                     \
     src/posix/platform/random.c                             \
     src/posix/platform/settings.cpp                         \
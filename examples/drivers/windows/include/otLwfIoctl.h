@@ -380,7 +380,7 @@ typedef enum _OTLWF_NOTIF_TYPE
 #define IOCTL_OTLWF_OT_EID_CACHE_ENTRY \
     OTLWF_CTL_CODE(142, METHOD_BUFFERED, FILE_READ_DATA)
     // GUID - InterfaceGuid
-    // uint8_t - aIndex (input)
+    // uint16_t - aIndex (input)
     // otEidCacheEntry - aEntry (output)
 
 #define IOCTL_OTLWF_OT_LEADER_DATA \
@@ -3134,7 +3134,7 @@ otError
 OTCALL
 otThreadGetEidCacheEntry(
     _In_ otInstance *aInstance, 
-    uint8_t aIndex, 
+    uint16_t aIndex, 
     _Out_ otEidCacheEntry *aEntry
     )
 {
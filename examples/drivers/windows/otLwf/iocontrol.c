@@ -4003,13 +4003,13 @@ otLwfIoCtl_otEidCacheEntry(
 {
     NTSTATUS status = STATUS_INVALID_PARAMETER;
 
-    if (InBufferLength >= sizeof(uint8_t) &&
+    if (InBufferLength >= sizeof(uint16_t) &&
         *OutBufferLength >= sizeof(otEidCacheEntry))
     {
         status = ThreadErrorToNtstatus(
             otThreadGetEidCacheEntry(
                 pFilter->otCtx,
-                *(uint8_t*)InBuffer,
+                *(uint16_t*)InBuffer,
                 (otEidCacheEntry*)OutBuffer)
             );
         *OutBufferLength = sizeof(otEidCacheEntry);
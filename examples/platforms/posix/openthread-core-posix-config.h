@@ -126,4 +126,35 @@
  *
  */
 #define CLI_COAP_SECURE_USE_COAP_DEFAULT_HANDLER 1
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+ *
+ * Code size is not a concern on POSIX, so the HDLC FCS is computed with the slice-by-8 tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+#define OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+ *
+ * Define as 1 to let the host opt in to batched unsolicited spinel frames.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+ *
+ * Define as 1 to enable CoAP block-wise transfer (RFC 7959) with streaming Block1/Block2 handlers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -98,6 +98,14 @@ enum
     POSIX_RADIO_CHANNEL_MAX = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX,
 };
 
+enum
+{
+    POSIX_RADIO_BASE_PORT = 9000,
+};
+
+// Multicast group used by the simulated radio medium when `RADIO_MEDIUM=multicast`.
+#define POSIX_RADIO_MULTICAST_GROUP "224.0.0.116"
+
 OT_TOOL_PACKED_BEGIN
 struct RadioMessage
 {
@@ -127,7 +135,10 @@ static uint8_t  sExtendedAddress[OT_EXT_ADDRESS_SIZE];
 static uint16_t sShortAddress;
 static uint16_t sPanid;
 static uint16_t sPortOffset = 0;
-static int      sSockFd;
+static int      sSockFd;   // Socket receiving frames (also used to transmit in UDP port mode).
+static int      sTxSockFd; // Socket transmitting frames.
+static uint16_t sTxPort;   // Port `sTxSockFd` is bound to, identifying this node on the medium.
+static bool     sUseMulticast = false;
 static bool     sPromiscuous = false;
 static bool     sAckWait     = false;
 static int8_t   sTxPower     = 0;
@@ -388,12 +399,90 @@ void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
     sPromiscuous = aEnable;
 }
 
-void platformRadioInit(void)
+static int radioCreateSocket(uint16_t aPort, bool aReuseAddress)
 {
     struct sockaddr_in sockaddr;
-    char *             offset;
+    int                fd;
+
     memset(&sockaddr, 0, sizeof(sockaddr));
-    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_family      = AF_INET;
+    sockaddr.sin_port        = htons(aPort);
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+
+    fd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (fd == -1)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (aReuseAddress)
+    {
+        int one = 1;
+
+        if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char *)&one, sizeof(one)) == -1)
+        {
+            perror("setsockopt(SO_REUSEADDR)");
+            exit(EXIT_FAILURE);
+        }
+
+#ifdef SO_REUSEPORT
+        if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, (const char *)&one, sizeof(one)) == -1)
+        {
+            perror("setsockopt(SO_REUSEPORT)");
+            exit(EXIT_FAILURE);
+        }
+#endif
+    }
+
+    if (bind(fd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    {
+        perror("bind");
+        exit(EXIT_FAILURE);
+    }
+
+    return fd;
+}
+
+static void radioInitMulticast(void)
+{
+    struct ip_mreq mreq;
+    struct in_addr loopback;
+    unsigned char  loop = 1;
+    unsigned char  ttl  = 0;
+
+    inet_pton(AF_INET, "127.0.0.1", &loopback);
+
+    // Frames are sent once to the multicast group and looped back to every node on this host.
+    sTxSockFd = radioCreateSocket(sTxPort, false);
+
+    if (setsockopt(sTxSockFd, IPPROTO_IP, IP_MULTICAST_IF, (const char *)&loopback, sizeof(loopback)) == -1 ||
+        setsockopt(sTxSockFd, IPPROTO_IP, IP_MULTICAST_LOOP, (const char *)&loop, sizeof(loop)) == -1 ||
+        setsockopt(sTxSockFd, IPPROTO_IP, IP_MULTICAST_TTL, (const char *)&ttl, sizeof(ttl)) == -1)
+    {
+        perror("setsockopt(IP_MULTICAST)");
+        exit(EXIT_FAILURE);
+    }
+
+    // All nodes of a simulation share the receive port, so it is bound with address reuse.
+    sSockFd = radioCreateSocket((uint16_t)(POSIX_RADIO_BASE_PORT + sPortOffset), true);
+
+    memset(&mreq, 0, sizeof(mreq));
+    inet_pton(AF_INET, POSIX_RADIO_MULTICAST_GROUP, &mreq.imr_multiaddr);
+    mreq.imr_interface = loopback;
+
+    if (setsockopt(sSockFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&mreq, sizeof(mreq)) == -1)
+    {
+        perror("setsockopt(IP_ADD_MEMBERSHIP)");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void platformRadioInit(void)
+{
+    char *offset;
+    char *medium;
 
     offset = getenv("PORT_OFFSET");
 
@@ -412,29 +501,38 @@ void platformRadioInit(void)
         sPortOffset *= WELLKNOWN_NODE_ID;
     }
 
+    medium = getenv("RADIO_MEDIUM");
+
+    if (medium)
+    {
+        if (strcmp(medium, "multicast") == 0)
+        {
+            sUseMulticast = true;
+        }
+        else if (strcmp(medium, "udp") != 0)
+        {
+            fprintf(stderr, "Invalid RADIO_MEDIUM: %s\n", medium);
+            exit(EXIT_FAILURE);
+        }
+    }
+
     if (sPromiscuous)
     {
-        sockaddr.sin_port = htons((uint16_t)(9000 + sPortOffset + WELLKNOWN_NODE_ID));
+        sTxPort = (uint16_t)(POSIX_RADIO_BASE_PORT + sPortOffset + WELLKNOWN_NODE_ID);
     }
     else
     {
-        sockaddr.sin_port = htons((uint16_t)(9000 + sPortOffset + gNodeId));
+        sTxPort = (uint16_t)(POSIX_RADIO_BASE_PORT + sPortOffset + gNodeId);
     }
 
-    sockaddr.sin_addr.s_addr = INADDR_ANY;
-
-    sSockFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-
-    if (sSockFd == -1)
+    if (sUseMulticast)
     {
-        perror("socket");
-        exit(EXIT_FAILURE);
+        radioInitMulticast();
     }
-
-    if (bind(sSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    else
     {
-        perror("bind");
-        exit(EXIT_FAILURE);
+        sSockFd   = radioCreateSocket(sTxPort, false);
+        sTxSockFd = sSockFd;
     }
 
     sReceiveFrame.mPsdu  = sReceiveMessage.mPsdu;
@@ -454,8 +552,18 @@ void platformRadioDeinit(void)
 {
 #ifndef _WIN32
     close(sSockFd);
+
+    if (sTxSockFd != sSockFd)
+    {
+        close(sTxSockFd);
+    }
 #else
     closesocket(sSockFd);
+
+    if (sTxSockFd != sSockFd)
+    {
+        closesocket(sTxSockFd);
+    }
 #endif
 }
 
@@ -585,8 +693,11 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
 
 void radioReceive(otInstance *aInstance)
 {
-    bool    isAck;
-    ssize_t rval = recvfrom(sSockFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0, NULL, NULL);
+    bool               isAck;
+    struct sockaddr_in sockaddr;
+    socklen_t          sockaddrLength = sizeof(sockaddr);
+    ssize_t            rval           = recvfrom(sSockFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0,
+                                  (struct sockaddr *)&sockaddr, &sockaddrLength);
 
     if (rval < 0)
     {
@@ -594,6 +705,9 @@ void radioReceive(otInstance *aInstance)
         exit(EXIT_FAILURE);
     }
 
+    // The multicast medium loops our own transmissions back to us.
+    otEXPECT(!sUseMulticast || sockaddr.sin_port != htons(sTxPort));
+
     if (otPlatRadioGetPromiscuous(aInstance))
     {
         // Timestamp
@@ -622,6 +736,9 @@ void radioReceive(otInstance *aInstance)
     {
         radioProcessFrame(aInstance);
     }
+
+exit:
+    return;
 }
 
 void radioSendMessage(otInstance *aInstance)
@@ -693,11 +810,11 @@ void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMax
 
     if (aWriteFdSet != NULL && sState == OT_RADIO_STATE_TRANSMIT && !sAckWait)
     {
-        FD_SET(sSockFd, aWriteFdSet);
+        FD_SET(sTxSockFd, aWriteFdSet);
 
-        if (aMaxFd != NULL && *aMaxFd < sSockFd)
+        if (aMaxFd != NULL && *aMaxFd < sTxSockFd)
         {
-            *aMaxFd = sSockFd;
+            *aMaxFd = sTxSockFd;
         }
     }
 }
@@ -733,6 +850,18 @@ static void radioComputeCrc(struct RadioMessage *aMessage, uint16_t aLength)
     aMessage->mPsdu[crc_offset + 1] = crc >> 8;
 }
 
+static void radioSendTo(const struct RadioMessage *aMessage, uint16_t aLength, const struct sockaddr_in *aSockaddr)
+{
+    ssize_t rval =
+        sendto(sTxSockFd, (const char *)aMessage, aLength, 0, (const struct sockaddr *)aSockaddr, sizeof(*aSockaddr));
+
+    if (rval < 0)
+    {
+        perror("sendto");
+        exit(EXIT_FAILURE);
+    }
+}
+
 void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFrame)
 {
     uint32_t           i;
@@ -745,25 +874,26 @@ void radioTransmit(struct RadioMessage *aMessage, const struct otRadioFrame *aFr
 
     memset(&sockaddr, 0, sizeof(sockaddr));
     sockaddr.sin_family = AF_INET;
-    inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
 
-    for (i = 1; i <= WELLKNOWN_NODE_ID; i++)
+    if (sUseMulticast)
+    {
+        inet_pton(AF_INET, POSIX_RADIO_MULTICAST_GROUP, &sockaddr.sin_addr);
+        sockaddr.sin_port = htons((uint16_t)(POSIX_RADIO_BASE_PORT + sPortOffset));
+        radioSendTo(aMessage, 1 + aFrame->mLength, &sockaddr);
+    }
+    else
     {
-        ssize_t rval;
+        inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
 
-        if (gNodeId == i)
+        for (i = 1; i <= WELLKNOWN_NODE_ID; i++)
         {
-            continue;
-        }
+            if (gNodeId == i)
+            {
+                continue;
+            }
 
-        sockaddr.sin_port = htons((uint16_t)(9000 + sPortOffset + i));
-        rval = sendto(sSockFd, (const char *)aMessage, 1 + aFrame->mLength, 0, (struct sockaddr *)&sockaddr,
-                      sizeof(sockaddr));
-
-        if (rval < 0)
-        {
-            perror("sendto");
-            exit(EXIT_FAILURE);
+            sockaddr.sin_port = htons((uint16_t)(POSIX_RADIO_BASE_PORT + sPortOffset + i));
+            radioSendTo(aMessage, 1 + aFrame->mLength, &sockaddr);
         }
     }
 }
@@ -91,12 +91,13 @@ typedef enum otCoapCode
     OT_COAP_CODE_PUT    = OT_COAP_CODE(0, 3), ///< Put
     OT_COAP_CODE_DELETE = OT_COAP_CODE(0, 4), ///< Delete
 
-    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0), ///< 2.00
-    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1), ///< Created
-    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2), ///< Deleted
-    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3), ///< Valid
-    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4), ///< Changed
-    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5), ///< Content
+    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0),  ///< 2.00
+    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1),  ///< Created
+    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2),  ///< Deleted
+    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3),  ///< Valid
+    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4),  ///< Changed
+    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5),  ///< Content
+    OT_COAP_CODE_CONTINUE     = OT_COAP_CODE(2, 31), ///< RFC7959 Continue
 
     OT_COAP_CODE_BAD_REQUEST         = OT_COAP_CODE(4, 0),  ///< Bad Request
     OT_COAP_CODE_UNAUTHORIZED        = OT_COAP_CODE(4, 1),  ///< Unauthorized
@@ -105,6 +106,7 @@ typedef enum otCoapCode
     OT_COAP_CODE_NOT_FOUND           = OT_COAP_CODE(4, 4),  ///< Not Found
     OT_COAP_CODE_METHOD_NOT_ALLOWED  = OT_COAP_CODE(4, 5),  ///< Method Not Allowed
     OT_COAP_CODE_NOT_ACCEPTABLE      = OT_COAP_CODE(4, 6),  ///< Not Acceptable
+    OT_COAP_CODE_REQUEST_INCOMPLETE  = OT_COAP_CODE(4, 8),  ///< RFC7959 Request Entity Incomplete
     OT_COAP_CODE_PRECONDITION_FAILED = OT_COAP_CODE(4, 12), ///< Precondition Failed
     OT_COAP_CODE_REQUEST_TOO_LARGE   = OT_COAP_CODE(4, 13), ///< Request Entity Too Large
     OT_COAP_CODE_UNSUPPORTED_FORMAT  = OT_COAP_CODE(4, 15), ///< Unsupported Content-Format
@@ -135,6 +137,9 @@ typedef enum otCoapOptionType
     OT_COAP_OPTION_URI_QUERY      = 15, ///< Uri-Query
     OT_COAP_OPTION_ACCEPT         = 17, ///< Accept
     OT_COAP_OPTION_LOCATION_QUERY = 20, ///< Location-Query
+    OT_COAP_OPTION_BLOCK2         = 23, ///< Block2 (RFC7959)
+    OT_COAP_OPTION_BLOCK1         = 27, ///< Block1 (RFC7959)
+    OT_COAP_OPTION_SIZE2          = 28, ///< Size2 (RFC7959)
     OT_COAP_OPTION_PROXY_URI      = 35, ///< Proxy-Uri
     OT_COAP_OPTION_PROXY_SCHEME   = 39, ///< Proxy-Scheme
     OT_COAP_OPTION_SIZE1          = 60, ///< Size1
@@ -293,6 +298,21 @@ typedef enum otCoapOptionContentFormat
     OT_COAP_OPTION_CONTENT_FORMAT_SENSML_XML = 311
 } otCoapOptionContentFormat;
 
+/**
+ * CoAP Block Size Exponents (RFC7959).
+ *
+ */
+typedef enum otCoapBlockSzx
+{
+    OT_COAP_OPTION_BLOCK_SZX_16   = 0, ///< 16-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_32   = 1, ///< 32-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_64   = 2, ///< 64-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_128  = 3, ///< 128-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_256  = 4, ///< 256-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_512  = 5, ///< 512-byte blocks
+    OT_COAP_OPTION_BLOCK_SZX_1024 = 6, ///< 1024-byte blocks
+} otCoapBlockSzx;
+
 /**
  * This function pointer is called when a CoAP response is received or on the request timeout.
  *
@@ -321,6 +341,49 @@ typedef void (*otCoapResponseHandler)(void *               aContext,
  */
 typedef void (*otCoapRequestHandler)(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function pointer is called to consume the next part of a block-wise transfer.
+ *
+ * Blocks are delivered in order. A block larger than the local buffer is delivered in several consecutive parts.
+ *
+ * @param[in]  aContext      A pointer to arbitrary context information.
+ * @param[in]  aBlock        A pointer to the received data.
+ * @param[in]  aPosition     The offset of @p aBlock in the whole transfer.
+ * @param[in]  aBlockLength  The number of bytes in @p aBlock.
+ * @param[in]  aMore         TRUE if more data follows, FALSE if @p aBlock ends the transfer.
+ * @param[in]  aTotalLength  The total length of the transfer announced by the peer, or zero if unknown.
+ *
+ * @retval  OT_ERROR_NONE  The data was consumed, the transfer continues.
+ * @retval  ...            Any other value aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockWiseReceiveHook)(void *         aContext,
+                                              const uint8_t *aBlock,
+                                              uint32_t       aPosition,
+                                              uint16_t       aBlockLength,
+                                              bool           aMore,
+                                              uint32_t       aTotalLength);
+
+/**
+ * This function pointer is called to produce the next block of a block-wise transfer.
+ *
+ * @param[in]     aContext      A pointer to arbitrary context information.
+ * @param[out]    aBlock        A pointer to the buffer to write the block to.
+ * @param[in]     aPosition     The offset of the requested block in the whole transfer.
+ * @param[inout]  aBlockLength  On input, the block size. On output, the number of bytes written to @p aBlock, which
+ *                              must equal the block size unless the block is the last one.
+ * @param[out]    aMore         Set to TRUE if more blocks follow, FALSE if this block is the last one.
+ *
+ * @retval  OT_ERROR_NONE  The block was written to @p aBlock.
+ * @retval  ...            Any other value aborts the transfer.
+ *
+ */
+typedef otError (*otCoapBlockWiseTransmitHook)(void *    aContext,
+                                               uint8_t * aBlock,
+                                               uint32_t  aPosition,
+                                               uint16_t *aBlockLength,
+                                               bool *    aMore);
+
 /**
  * This structure represents a CoAP resource.
  *
@@ -333,6 +396,20 @@ typedef struct otCoapResource
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
 } otCoapResource;
 
+/**
+ * This structure represents a CoAP resource with block-wise transfer.
+ *
+ */
+typedef struct otCoapBlockWiseResource
+{
+    const char *                    mUriPath;      ///< The URI Path string
+    otCoapRequestHandler            mHandler;      ///< The callback for handling a complete request
+    otCoapBlockWiseReceiveHook      mReceiveHook;  ///< The callback consuming Block1 requests, may be NULL
+    otCoapBlockWiseTransmitHook     mTransmitHook; ///< The callback producing Block2 responses, may be NULL
+    void *                          mContext;      ///< Application-specific context
+    struct otCoapBlockWiseResource *mNext;         ///< The next CoAP block-wise resource in the list
+} otCoapBlockWiseResource;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -625,6 +702,37 @@ otError otCoapSendRequest(otInstance *          aInstance,
                           otCoapResponseHandler aHandler,
                           void *                aContext);
 
+/**
+ * This function sends a CoAP request block-wise (RFC 7959).
+ *
+ * The request payload is produced by @p aTransmitHook one Block1 block at a time and the response payload is handed
+ * to @p aReceiveHook one Block2 block at a time, so neither has to be held in memory as a whole. The block size is
+ * chosen so that each message fits in a single IEEE 802.15.4 frame, and is reduced further if the peer asks for
+ * smaller blocks. @p aHandler is called once the transfer has completed or failed.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is set.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the confirmable request, without payload, to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aHandler       A function pointer that shall be called on response reception or timeout.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aHandler and the hooks.
+ * @param[in]  aTransmitHook  A function pointer producing the request payload, or NULL if there is none.
+ * @param[in]  aReceiveHook   A function pointer consuming a block-wise response payload, or NULL.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent the first block of the CoAP request.
+ * @retval OT_ERROR_NO_BUFS       Failed to allocate retransmission data.
+ * @retval OT_ERROR_INVALID_ARGS  The @p aMessage is not a confirmable request.
+ *
+ */
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockWiseTransmitHook aTransmitHook,
+                                   otCoapBlockWiseReceiveHook  aReceiveHook);
+
 /**
  * This function starts the CoAP server.
  *
@@ -667,6 +775,31 @@ otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function adds a block-wise resource to the CoAP server.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is set.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the resource.
+ *
+ * @retval OT_ERROR_NONE     Successfully added @p aResource.
+ * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+ *
+ */
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockWiseResource *aResource);
+
+/**
+ * This function removes a block-wise resource from the CoAP server.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is set.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the resource.
+ *
+ */
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockWiseResource *aResource);
+
 /**
  * This function sets the default handler for unhandled CoAP requests.
  *
@@ -690,6 +823,30 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
  */
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function sends a CoAP response from the server block-wise (RFC 7959).
+ *
+ * Only the first Block2 block is produced by @p aTransmitHook here. The following blocks are requested by the client
+ * and produced by the transmit hook of the block-wise resource the request was addressed to.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is set.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the CoAP response, without payload, to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+ * @param[in]  aTransmitHook  A function pointer producing the response payload.
+ *
+ * @retval OT_ERROR_NONE     Successfully enqueued the CoAP response message.
+ * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+ *
+ */
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockWiseTransmitHook aTransmitHook);
+
 /**
  * @}
  *
@@ -88,6 +88,19 @@ typedef struct otBufferInfo
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
 } otBufferInfo;
 
+/**
+ * This structure represents the message buffer pool statistics.
+ *
+ */
+typedef struct otMessagePoolStats
+{
+    uint16_t mTotalBuffers;          ///< The number of buffers the pool can provide (in use and free).
+    uint16_t mUsedBuffers;           ///< The number of buffers in use.
+    uint16_t mMaxUsedBuffers;        ///< The maximum number of buffers in use at the same time (high-water mark).
+    uint32_t mAllocFailures;         ///< The number of failed buffer allocations.
+    uint32_t mReservedAllocFailures; ///< The number of allocations denied to keep buffers for higher priorities.
+} otMessagePoolStats;
+
 /**
  * This enumeration defines the OpenThread message priority levels.
  *
@@ -382,6 +395,25 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 OTAPI void OTCALL otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Get the message buffer pool statistics.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ * @param[out]  aStats     A pointer where the message buffer pool statistics are written.
+ *
+ */
+OTAPI void OTCALL otMessageGetPoolStats(otInstance *aInstance, otMessagePoolStats *aStats);
+
+/**
+ * Reset the message buffer pool statistics.
+ *
+ * The allocation failure counters are cleared and the high-water mark is set to the number of buffers in use.
+ *
+ * @param[in]   aInstance  A pointer to the OpenThread instance.
+ *
+ */
+OTAPI void OTCALL otMessageResetPoolStats(otInstance *aInstance);
+
 /**
  * @}
  *
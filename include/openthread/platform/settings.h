@@ -200,6 +200,34 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex);
  */
 void otPlatSettingsWipe(otInstance *aInstance);
 
+/**
+ * This function starts a group of settings changes.
+ *
+ * The changes made until the matching `otPlatSettingsCommitChange()` may be made durable together, for example with
+ * a single flush of the underlying storage. Groups may be nested, the outermost group commits the changes.
+ *
+ * This function is optional, the default implementation does nothing.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ * @retval OT_ERROR_NONE  The group was started.
+ *
+ */
+otError otPlatSettingsBeginChange(otInstance *aInstance);
+
+/**
+ * This function commits a group of settings changes started by `otPlatSettingsBeginChange()`.
+ *
+ * This function is optional, the default implementation does nothing.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ *
+ * @retval OT_ERROR_NONE           The changes were committed.
+ * @retval OT_ERROR_INVALID_STATE  No group of changes was started.
+ *
+ */
+otError otPlatSettingsCommitChange(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -86,12 +86,18 @@ otError otPlatUdpConnect(otUdpSocket *aUdpSocket);
 /**
  * This function sends UDP payload by platform.
  *
+ * The platform may queue the datagram and send it later, e.g. batched with other datagrams when the main loop
+ * returns to the platform. It checks the socket, destination and size before accepting the datagram, so the
+ * errors returned here are reported synchronously. A queued datagram that later fails to be sent is dropped; this
+ * is not reported to the caller, the platform logs and counts it instead.
+ *
  * @param[in]   aUdpSocket      A pointer to the UDP socket.
  * @param[in]   aMessage        A pointer to the message to send.
  * @param[in]   aMessageInfo    A pointer to the message info associated with @p aMessage.
  *
- * @retval  OT_ERROR_NONE   Successfully sent by platform, and @p aMessage is freed.
- * @retval  OT_ERROR_FAILED Failed to binded UDP socket.
+ * @retval  OT_ERROR_NONE           Successfully sent or queued by platform, and @p aMessage is freed.
+ * @retval  OT_ERROR_INVALID_ARGS   The socket, destination or size is invalid, and @p aMessage is not freed.
+ * @retval  OT_ERROR_FAILED         Failed to binded UDP socket.
  *
  */
 otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo);
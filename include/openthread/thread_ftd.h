@@ -512,7 +512,7 @@ OTAPI otError OTCALL otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRout
  * @retval OT_ERROR_INVALID_ARGS  @p aIndex was out of bounds or @p aEntry was NULL.
  *
  */
-OTAPI otError OTCALL otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry);
+OTAPI otError OTCALL otThreadGetEidCacheEntry(otInstance *aInstance, uint16_t aIndex, otEidCacheEntry *aEntry);
 
 /**
  * Get the thrPSKc.
@@ -518,9 +518,11 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
     OT_UNUSED_VARIABLE(argc);
     OT_UNUSED_VARIABLE(argv);
 
-    otBufferInfo bufferInfo;
+    otBufferInfo       bufferInfo;
+    otMessagePoolStats poolStats;
 
     otMessageGetBufferInfo(mInstance, &bufferInfo);
+    otMessageGetPoolStats(mInstance, &poolStats);
 
     mServer->OutputFormat("total: %d\r\n", bufferInfo.mTotalBuffers);
     mServer->OutputFormat("free: %d\r\n", bufferInfo.mFreeBuffers);
@@ -534,6 +536,9 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
     mServer->OutputFormat("coap secure: %d %d\r\n", bufferInfo.mCoapSecureMessages, bufferInfo.mCoapSecureBuffers);
     mServer->OutputFormat("application coap: %d %d\r\n", bufferInfo.mApplicationCoapMessages,
                           bufferInfo.mApplicationCoapBuffers);
+    mServer->OutputFormat("max used: %d\r\n", poolStats.mMaxUsedBuffers);
+    mServer->OutputFormat("alloc failures: %lu %lu\r\n", static_cast<unsigned long>(poolStats.mAllocFailures),
+                          static_cast<unsigned long>(poolStats.mReservedAllocFailures));
 
     AppendResult(OT_ERROR_NONE);
 }
@@ -1126,7 +1131,7 @@ void Interpreter::ProcessEidCache(int argc, char *argv[])
 
     otEidCacheEntry entry;
 
-    for (uint8_t i = 0;; i++)
+    for (uint16_t i = 0;; i++)
     {
         SuccessOrExit(otThreadGetEidCacheEntry(mInstance, i, &entry));
 
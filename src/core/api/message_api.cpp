@@ -169,7 +169,7 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     uint16_t  messages, buffers;
     Instance &instance = *static_cast<Instance *>(aInstance);
 
-    aBufferInfo->mTotalBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+    aBufferInfo->mTotalBuffers = instance.Get<MessagePool>().GetTotalBufferCount();
 
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
@@ -218,4 +218,18 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+void otMessageGetPoolStats(otInstance *aInstance, otMessagePoolStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().GetStats(*aStats);
+}
+
+void otMessageResetPoolStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().ResetStats();
+}
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
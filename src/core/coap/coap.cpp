@@ -31,6 +31,7 @@
 #include "coap.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
@@ -50,16 +51,30 @@ namespace Coap {
 
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
+    , mUnindexedRequests(0)
     , mRetransmissionTimer(aInstance, &Coap::HandleRetransmissionTimer, this)
-    , mResources(NULL)
     , mContext(NULL)
     , mInterceptor(NULL)
-    , mResponsesQueue(aInstance)
+    , mResponsesQueue(aInstance, mCounters)
     , mDefaultHandler(NULL)
     , mDefaultHandlerContext(NULL)
     , mSender(aSender)
 {
     mMessageId = Random::GetUint16();
+
+    for (uint8_t i = 0; i < kResourceHashBuckets; i++)
+    {
+        mResources[i] = NULL;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        mBlockWiseResources[i] = NULL;
+#endif
+    }
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    memset(mBlock1Transfers, 0, sizeof(mBlock1Transfers));
+#endif
+
+    memset(&mCounters, 0, sizeof(mCounters));
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
@@ -81,17 +96,56 @@ void CoapBase::ClearRequestsAndResponses(void)
     mResponsesQueue.DequeueAllResponses();
 }
 
+void CoapBase::ResetCounters(void)
+{
+    uint16_t pendingRequests = mCounters.mPendingRequests;
+
+    memset(&mCounters, 0, sizeof(mCounters));
+    mCounters.mPendingRequests     = pendingRequests;
+    mCounters.mPendingRequestsPeak = pendingRequests;
+}
+
+uint16_t CoapBase::GetTokenKey(const Message &aMessage)
+{
+    Crc16          crc(Crc16::kCcitt);
+    const uint8_t *token = aMessage.GetToken();
+
+    crc.Init();
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        crc.Update(token[i]);
+    }
+
+    return crc.Get();
+}
+
+uint8_t CoapBase::GetResourceBucket(const char *aUriPath)
+{
+    Crc16 crc(Crc16::kCcitt);
+
+    crc.Init();
+
+    for (const char *cur = aUriPath; *cur != '\0'; cur++)
+    {
+        crc.Update(static_cast<uint8_t>(*cur));
+    }
+
+    return static_cast<uint8_t>(crc.Get() % kResourceHashBuckets);
+}
+
 otError CoapBase::AddResource(Resource &aResource)
 {
-    otError error = OT_ERROR_NONE;
+    otError    error  = OT_ERROR_NONE;
+    Resource *&bucket = mResources[GetResourceBucket(aResource.mUriPath)];
 
-    for (Resource *cur = mResources; cur; cur = cur->GetNext())
+    for (Resource *cur = bucket; cur; cur = cur->GetNext())
     {
         VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
     }
 
-    aResource.mNext = mResources;
-    mResources      = &aResource;
+    aResource.mNext = bucket;
+    bucket          = &aResource;
 
 exit:
     return error;
@@ -99,13 +153,15 @@ exit:
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    if (mResources == &aResource)
+    Resource *&bucket = mResources[GetResourceBucket(aResource.mUriPath)];
+
+    if (bucket == &aResource)
     {
-        mResources = aResource.GetNext();
+        bucket = aResource.GetNext();
     }
     else
     {
-        for (Resource *cur = mResources; cur; cur = cur->GetNext())
+        for (Resource *cur = bucket; cur; cur = cur->GetNext())
         {
             if (cur->mNext == &aResource)
             {
@@ -119,6 +175,57 @@ exit:
     aResource.mNext = NULL;
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource)
+{
+    otError             error  = OT_ERROR_NONE;
+    ResourceBlockWise *&bucket = mBlockWiseResources[GetResourceBucket(aResource.mUriPath)];
+
+    for (ResourceBlockWise *cur = bucket; cur; cur = cur->GetNext())
+    {
+        VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
+    }
+
+    aResource.mNext = bucket;
+    bucket          = &aResource;
+
+exit:
+    return error;
+}
+
+void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
+{
+    ResourceBlockWise *&bucket = mBlockWiseResources[GetResourceBucket(aResource.mUriPath)];
+
+    for (uint8_t i = 0; i < kMaxBlock1Transfers; i++)
+    {
+        if (mBlock1Transfers[i].mResource == &aResource)
+        {
+            mBlock1Transfers[i].mResource = NULL;
+        }
+    }
+
+    if (bucket == &aResource)
+    {
+        bucket = aResource.GetNext();
+    }
+    else
+    {
+        for (ResourceBlockWise *cur = bucket; cur; cur = cur->GetNext())
+        {
+            if (cur->mNext == &aResource)
+            {
+                cur->mNext = aResource.mNext;
+                ExitNow();
+            }
+        }
+    }
+
+exit:
+    aResource.mNext = NULL;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 void CoapBase::SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext)
 {
     mDefaultHandler        = aHandler;
@@ -141,10 +248,76 @@ otError CoapBase::SendMessage(Message &               aMessage,
                               otCoapResponseHandler   aHandler,
                               void *                  aContext)
 {
-    otError      error;
     CoapMetadata coapMetadata;
-    Message *    storedCopy = NULL;
-    uint16_t     copyLength = 0;
+
+    if (aMessage.IsConfirmable() || aHandler != NULL)
+    {
+        coapMetadata = CoapMetadata(aMessage.IsConfirmable(), aMessageInfo, aHandler, aContext);
+    }
+
+    return SendMessage(aMessage, aMessageInfo, coapMetadata);
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError CoapBase::SendMessage(Message &                   aMessage,
+                              const Ip6::MessageInfo &    aMessageInfo,
+                              otCoapResponseHandler       aHandler,
+                              void *                      aContext,
+                              otCoapBlockWiseTransmitHook aTransmitHook,
+                              otCoapBlockWiseReceiveHook  aReceiveHook)
+{
+    otError        error = OT_ERROR_NONE;
+    CoapMetadata   coapMetadata;
+    otCoapBlockSzx size = GetBlockSzx(aMessage.GetLength());
+    bool           more = false;
+
+    if (aMessage.IsRequest())
+    {
+        VerifyOrExit(aMessage.IsConfirmable(), error = OT_ERROR_INVALID_ARGS);
+
+        coapMetadata                        = CoapMetadata(true, aMessageInfo, aHandler, aContext);
+        coapMetadata.mBlockWiseTransmitHook = aTransmitHook;
+        coapMetadata.mBlockWiseReceiveHook  = aReceiveHook;
+        coapMetadata.mBlockWiseHeaderLength = aMessage.GetLength();
+        coapMetadata.mBlockWiseSzx          = size;
+
+        if (aTransmitHook != NULL)
+        {
+            SuccessOrExit(
+                error = AppendBlock(aMessage, OT_COAP_OPTION_BLOCK1, 0, size, aTransmitHook, aContext, more));
+            coapMetadata.mBlockWiseMore = more;
+        }
+        else if (aReceiveHook != NULL)
+        {
+            // Let the server know the preferred block size of the response.
+            SuccessOrExit(error = aMessage.AppendBlockOption(OT_COAP_OPTION_BLOCK2, 0, false, size));
+        }
+    }
+    else
+    {
+        VerifyOrExit(aHandler == NULL && aReceiveHook == NULL, error = OT_ERROR_INVALID_ARGS);
+
+        if (aTransmitHook != NULL)
+        {
+            SuccessOrExit(
+                error = AppendBlock(aMessage, OT_COAP_OPTION_BLOCK2, 0, size, aTransmitHook, aContext, more));
+        }
+    }
+
+    error = SendMessage(aMessage, aMessageInfo, coapMetadata);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+otError CoapBase::SendMessage(Message &               aMessage,
+                              const Ip6::MessageInfo &aMessageInfo,
+                              const CoapMetadata &    aCoapMetadata)
+{
+    otError  error;
+    Message *storedCopy = NULL;
+    uint16_t copyLength = 0;
 
     if ((aMessage.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || aMessage.GetType() == OT_COAP_TYPE_RESET) &&
         aMessage.GetCode() != OT_COAP_CODE_EMPTY)
@@ -166,7 +339,7 @@ otError CoapBase::SendMessage(Message &               aMessage,
         // Create a copy of entire message and enqueue it.
         copyLength = aMessage.GetLength();
     }
-    else if (aMessage.IsNonConfirmable() && (aHandler != NULL))
+    else if (aMessage.IsNonConfirmable() && (aCoapMetadata.mResponseHandler != NULL))
     {
         // As we do not retransmit non confirmable messages, create a copy of header only, for token information.
         copyLength = aMessage.GetOptionStart();
@@ -174,8 +347,7 @@ otError CoapBase::SendMessage(Message &               aMessage,
 
     if (copyLength > 0)
     {
-        coapMetadata = CoapMetadata(aMessage.IsConfirmable(), aMessageInfo, aHandler, aContext);
-        VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aMessage, copyLength, coapMetadata)) != NULL,
+        VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aMessage, copyLength, aCoapMetadata)) != NULL,
                      error = OT_ERROR_NO_BUFS);
     }
 
@@ -390,9 +562,27 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
         mRetransmissionTimer.Start(aCoapMetadata.mRetransmissionTimeout);
     }
 
-    // Enqueue the message.
+    // Enqueue the message and index it for response matching.
     mPendingRequests.Enqueue(*messageCopy);
 
+    if (mRequestsById.Add(*messageCopy, messageCopy->GetMessageId()))
+    {
+        bool added = mRequestsByToken.Add(*messageCopy, GetTokenKey(*messageCopy));
+
+        // Both indexes are always updated together, so they have the same number of free entries.
+        assert(added);
+        OT_UNUSED_VARIABLE(added);
+    }
+    else
+    {
+        mUnindexedRequests++;
+    }
+
+    if (++mCounters.mPendingRequests > mCounters.mPendingRequestsPeak)
+    {
+        mCounters.mPendingRequestsPeak = mCounters.mPendingRequests;
+    }
+
 exit:
 
     if (error != OT_ERROR_NONE && messageCopy != NULL)
@@ -408,6 +598,18 @@ void CoapBase::DequeueMessage(Message &aMessage)
 {
     mPendingRequests.Dequeue(aMessage);
 
+    if (mRequestsById.Remove(aMessage, aMessage.GetMessageId()))
+    {
+        mRequestsByToken.Remove(aMessage, GetTokenKey(aMessage));
+    }
+    else
+    {
+        assert(mUnindexedRequests > 0);
+        mUnindexedRequests--;
+    }
+
+    mCounters.mPendingRequests--;
+
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == NULL))
     {
         // No more requests pending, stop the timer.
@@ -447,46 +649,83 @@ Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       CoapMetadata &          aCoapMetadata)
 {
-    Message *message = static_cast<Message *>(mPendingRequests.GetHead());
+    Message *              message;
+    RequestIndex::Iterator iterator;
+    const RequestIndex *   index;
+    uint16_t               key;
 
-    while (message != NULL)
+    mCounters.mRequestLookups++;
+
+    // Acknowledgments and resets are matched by Message ID, separate responses by Token.
+    if (aResponse.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || aResponse.GetType() == OT_COAP_TYPE_RESET)
+    {
+        index = &mRequestsById;
+        key   = aResponse.GetMessageId();
+    }
+    else
     {
-        aCoapMetadata.ReadFrom(*message);
+        index = &mRequestsByToken;
+        key   = GetTokenKey(aResponse);
+    }
 
-        if (((aCoapMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aCoapMetadata.mDestinationAddress.IsMulticast() ||
-             aCoapMetadata.mDestinationAddress.IsAnycastRoutingLocator()) &&
-            (aCoapMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+    for (message = index->FindFirst(key, iterator); message != NULL; message = index->FindNext(key, iterator))
+    {
+        if (IsRelatedRequest(*message, aResponse, aMessageInfo, aCoapMetadata))
         {
-            switch (aResponse.GetType())
-            {
-            case OT_COAP_TYPE_RESET:
-            case OT_COAP_TYPE_ACKNOWLEDGMENT:
-                if (aResponse.GetMessageId() == message->GetMessageId())
-                {
-                    ExitNow();
-                }
-
-                break;
-
-            case OT_COAP_TYPE_CONFIRMABLE:
-            case OT_COAP_TYPE_NON_CONFIRMABLE:
-                if (aResponse.IsTokenEqual(*message))
-                {
-                    ExitNow();
-                }
-
-                break;
-            }
+            ExitNow();
         }
+    }
+
+    // Some pending requests did not fit in the index, so walk the whole queue.
+    VerifyOrExit(mUnindexedRequests > 0);
 
-        message = static_cast<Message *>(message->GetNext());
+    for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL;
+         message = static_cast<Message *>(message->GetNext()))
+    {
+        if (IsRelatedRequest(*message, aResponse, aMessageInfo, aCoapMetadata))
+        {
+            break;
+        }
     }
 
 exit:
     return message;
 }
 
+bool CoapBase::IsRelatedRequest(const Message &         aRequest,
+                                const Message &         aResponse,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                CoapMetadata &          aCoapMetadata)
+{
+    bool rval = false;
+
+    mCounters.mRequestProbes++;
+
+    // Compare the header fields kept in the first buffer before reading the metadata from the message tail.
+    switch (aResponse.GetType())
+    {
+    case OT_COAP_TYPE_RESET:
+    case OT_COAP_TYPE_ACKNOWLEDGMENT:
+        VerifyOrExit(aResponse.GetMessageId() == aRequest.GetMessageId());
+        break;
+
+    case OT_COAP_TYPE_CONFIRMABLE:
+    case OT_COAP_TYPE_NON_CONFIRMABLE:
+        VerifyOrExit(aResponse.IsTokenEqual(aRequest));
+        break;
+    }
+
+    aCoapMetadata.ReadFrom(aRequest);
+
+    rval = ((aCoapMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
+            aCoapMetadata.mDestinationAddress.IsMulticast() ||
+            aCoapMetadata.mDestinationAddress.IsAnycastRoutingLocator()) &&
+           (aCoapMetadata.mDestinationPort == aMessageInfo.GetPeerPort());
+
+exit:
+    return rval;
+}
+
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = static_cast<Message &>(aMessage);
@@ -548,7 +787,11 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         else if (aMessage.IsResponse() && aMessage.IsTokenEqual(*request))
         {
             // Piggybacked response.
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+            ProcessBlockWiseResponse(*request, coapMetadata, aMessage, aMessageInfo);
+#else
             FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+#endif
         }
 
         // Silently ignore acknowledgments carrying requests (RFC 7252, p. 4.2)
@@ -563,7 +806,11 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
         // Separate response.
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        ProcessBlockWiseResponse(*request, coapMetadata, aMessage, aMessageInfo);
+#else
         FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+#endif
 
         break;
     }
@@ -586,6 +833,7 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
     char *   curUriPath     = uriPath;
     Message *cachedResponse = NULL;
     otError  error          = OT_ERROR_NOT_FOUND;
+    uint8_t  bucket;
 
     if (mInterceptor != NULL)
     {
@@ -630,8 +878,13 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
 
     curUriPath[0] = '\0';
 
-    for (const Resource *resource = mResources; resource; resource = resource->GetNext())
+    mCounters.mResourceLookups++;
+    bucket = GetResourceBucket(uriPath);
+
+    for (const Resource *resource = mResources[bucket]; resource; resource = resource->GetNext())
     {
+        mCounters.mResourceProbes++;
+
         if (strcmp(resource->mUriPath, uriPath) == 0)
         {
             resource->HandleRequest(aMessage, aMessageInfo);
@@ -640,6 +893,20 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         }
     }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    for (const ResourceBlockWise *resource = mBlockWiseResources[bucket]; resource; resource = resource->GetNext())
+    {
+        mCounters.mResourceProbes++;
+
+        if (strcmp(resource->mUriPath, uriPath) == 0)
+        {
+            ProcessBlockWiseRequest(*resource, aMessage, aMessageInfo);
+            error = OT_ERROR_NONE;
+            ExitNow();
+        }
+    }
+#endif
+
     if (mDefaultHandler)
     {
         mDefaultHandler(mDefaultHandlerContext, &aMessage, &aMessageInfo);
@@ -664,6 +931,390 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otCoapBlockSzx CoapBase::GetBlockSzx(uint16_t aHeaderLength)
+{
+    uint8_t size = kMaxBlockSzx;
+
+    // Use the largest block that still fits in a single frame along with the header and the block option.
+    while (size > OT_COAP_OPTION_BLOCK_SZX_16 &&
+           aHeaderLength + kBlockOptionOverhead + Message::GetBlockSize(static_cast<otCoapBlockSzx>(size)) >
+               kBlockFramePayloadSize)
+    {
+        size--;
+    }
+
+    return static_cast<otCoapBlockSzx>(size);
+}
+
+otError CoapBase::AppendBlock(Message &                   aMessage,
+                              uint16_t                    aNumber,
+                              uint32_t                    aPosition,
+                              otCoapBlockSzx              aSize,
+                              otCoapBlockWiseTransmitHook aTransmitHook,
+                              void *                      aContext,
+                              bool &                      aMore)
+{
+    otError  error;
+    uint8_t  block[kMaxBlockLength];
+    uint16_t blockSize   = Message::GetBlockSize(aSize);
+    uint16_t blockLength = blockSize;
+
+    assert(blockSize <= sizeof(block));
+
+    aMore = false;
+    SuccessOrExit(error = aTransmitHook(aContext, block, aPosition, &blockLength, &aMore));
+
+    // Only the last block may be shorter than the block size.
+    VerifyOrExit(blockLength <= blockSize && (!aMore || blockLength == blockSize), error = OT_ERROR_INVALID_ARGS);
+
+    SuccessOrExit(error = aMessage.AppendBlockOption(aNumber, aPosition / blockSize, aMore, aSize));
+
+    if (blockLength > 0)
+    {
+        SuccessOrExit(error = aMessage.SetPayloadMarker());
+        SuccessOrExit(error = aMessage.Append(block, blockLength));
+    }
+
+exit:
+    return error;
+}
+
+otError CoapBase::DeliverBlock(const Message &            aMessage,
+                               uint32_t                   aPosition,
+                               bool                       aMore,
+                               uint32_t                   aTotalLength,
+                               otCoapBlockWiseReceiveHook aReceiveHook,
+                               void *                     aContext)
+{
+    otError  error  = OT_ERROR_NONE;
+    uint16_t offset = aMessage.GetOffset();
+    uint8_t  block[kMaxBlockLength];
+    uint16_t length;
+
+    // Hand the payload over in chunks, so that a block of any size can be received.
+    do
+    {
+        length = aMessage.Read(offset, sizeof(block), block);
+        offset += length;
+
+        SuccessOrExit(error = aReceiveHook(aContext, block, aPosition, length, aMore || offset < aMessage.GetLength(),
+                                           aTotalLength));
+
+        aPosition += length;
+    } while (offset < aMessage.GetLength());
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendNextBlock(Message &           aRequest,
+                                const CoapMetadata &aCoapMetadata,
+                                uint16_t            aNumber,
+                                uint32_t            aPosition,
+                                otCoapBlockSzx      aSize)
+{
+    otError          error   = OT_ERROR_NONE;
+    Message *        message = NULL;
+    CoapMetadata     coapMetadata;
+    Ip6::MessageInfo messageInfo;
+    bool             more = false;
+
+    messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+    messageInfo.SetInterfaceId(Get<ThreadNetif>().GetInterfaceId());
+
+    VerifyOrExit((message = aRequest.CloneHeader(aCoapMetadata.mBlockWiseHeaderLength)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+
+    coapMetadata = CoapMetadata(true, messageInfo, aCoapMetadata.mResponseHandler, aCoapMetadata.mResponseContext);
+
+    coapMetadata.mBlockWiseTransmitHook = aCoapMetadata.mBlockWiseTransmitHook;
+    coapMetadata.mBlockWiseReceiveHook  = aCoapMetadata.mBlockWiseReceiveHook;
+    coapMetadata.mBlockWiseHeaderLength = aCoapMetadata.mBlockWiseHeaderLength;
+    coapMetadata.mBlockWisePosition     = aPosition;
+    coapMetadata.mBlockWiseSzx          = aSize;
+
+    if (aNumber == OT_COAP_OPTION_BLOCK1)
+    {
+        SuccessOrExit(error = AppendBlock(*message, aNumber, aPosition, aSize, aCoapMetadata.mBlockWiseTransmitHook,
+                                          aCoapMetadata.mResponseContext, more));
+        coapMetadata.mBlockWiseMore = more;
+
+        if (!more)
+        {
+            // The request is complete, a block-wise response starts from the beginning.
+            coapMetadata.mBlockWisePosition = 0;
+        }
+    }
+    else
+    {
+        SuccessOrExit(error =
+                          message->AppendBlockOption(aNumber, aPosition / Message::GetBlockSize(aSize), false, aSize));
+    }
+
+    SuccessOrExit(error = SendMessage(*message, messageInfo, coapMetadata));
+
+    // The transaction continues with the new request.
+    DequeueMessage(aRequest);
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError CoapBase::SendBlockResponse(Message::Code               aCode,
+                                    const Message &             aRequest,
+                                    const Ip6::MessageInfo &    aMessageInfo,
+                                    uint16_t                    aNumber,
+                                    uint32_t                    aPosition,
+                                    otCoapBlockSzx              aSize,
+                                    otCoapBlockWiseTransmitHook aTransmitHook,
+                                    void *                      aContext)
+{
+    otError  error   = OT_ERROR_NONE;
+    Message *message = NULL;
+    bool     more    = true;
+
+    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    if (aRequest.IsConfirmable())
+    {
+        message->Init(OT_COAP_TYPE_ACKNOWLEDGMENT, aCode);
+        message->SetMessageId(aRequest.GetMessageId());
+    }
+    else
+    {
+        message->Init(OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
+    }
+
+    message->SetToken(aRequest.GetToken(), aRequest.GetTokenLength());
+
+    if (aTransmitHook != NULL)
+    {
+        SuccessOrExit(error = AppendBlock(*message, aNumber, aPosition, aSize, aTransmitHook, aContext, more));
+    }
+    else
+    {
+        SuccessOrExit(error =
+                          message->AppendBlockOption(aNumber, aPosition / Message::GetBlockSize(aSize), more, aSize));
+    }
+
+    SuccessOrExit(error = SendMessage(*message, aMessageInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+void CoapBase::ProcessBlockWiseResponse(Message &               aRequest,
+                                        const CoapMetadata &    aCoapMetadata,
+                                        Message &               aResponse,
+                                        const Ip6::MessageInfo &aMessageInfo)
+{
+    otError        error    = OT_ERROR_NONE;
+    bool           finished = true;
+    otCoapBlockSzx sentSize = static_cast<otCoapBlockSzx>(aCoapMetadata.mBlockWiseSzx);
+    uint32_t       blockNumber;
+    bool           more;
+    otCoapBlockSzx size;
+    uint32_t       position;
+    uint32_t       totalLength = 0;
+
+    if (aCoapMetadata.mBlockWiseMore)
+    {
+        // Any other response than 2.31 (Continue) ends the Block1 transfer early.
+        VerifyOrExit(aResponse.GetCode() == OT_COAP_CODE_CONTINUE);
+
+        SuccessOrExit(error = aResponse.ReadBlockOption(OT_COAP_OPTION_BLOCK1, blockNumber, more, size));
+        VerifyOrExit(blockNumber == aCoapMetadata.mBlockWisePosition / Message::GetBlockSize(sentSize),
+                     error = OT_ERROR_PARSE);
+
+        // The server may ask for smaller blocks, but never for larger ones.
+        if (size > sentSize)
+        {
+            size = sentSize;
+        }
+
+        SuccessOrExit(error = SendNextBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK1,
+                                            aCoapMetadata.mBlockWisePosition + Message::GetBlockSize(sentSize), size));
+        finished = false;
+    }
+    else if (aCoapMetadata.mBlockWiseReceiveHook != NULL &&
+             aResponse.ReadBlockOption(OT_COAP_OPTION_BLOCK2, blockNumber, more, size) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(blockNumber * Message::GetBlockSize(size) == aCoapMetadata.mBlockWisePosition,
+                     error = OT_ERROR_PARSE);
+
+        aResponse.ReadUintOption(OT_COAP_OPTION_SIZE2, totalLength);
+
+        SuccessOrExit(error = DeliverBlock(aResponse, aCoapMetadata.mBlockWisePosition, more, totalLength,
+                                           aCoapMetadata.mBlockWiseReceiveHook, aCoapMetadata.mResponseContext));
+        VerifyOrExit(more);
+
+        position = aCoapMetadata.mBlockWisePosition + Message::GetBlockSize(size);
+
+        if (size > GetBlockSzx(aCoapMetadata.mBlockWiseHeaderLength))
+        {
+            size = GetBlockSzx(aCoapMetadata.mBlockWiseHeaderLength);
+        }
+
+        SuccessOrExit(error = SendNextBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK2, position, size));
+        finished = false;
+    }
+
+exit:
+
+    if (finished)
+    {
+        if (error == OT_ERROR_NONE)
+        {
+            FinalizeCoapTransaction(aRequest, aCoapMetadata, &aResponse, &aMessageInfo, OT_ERROR_NONE);
+        }
+        else
+        {
+            otLogInfoCoapErr(error, "Block-wise transfer failed");
+            FinalizeCoapTransaction(aRequest, aCoapMetadata, NULL, NULL, error);
+        }
+    }
+}
+
+void CoapBase::ProcessBlockWiseRequest(const ResourceBlockWise &aResource,
+                                       Message &                aRequest,
+                                       const Ip6::MessageInfo & aMessageInfo)
+{
+    uint32_t       blockNumber;
+    bool           more;
+    otCoapBlockSzx size;
+    uint32_t       totalLength = 0;
+
+    if (aResource.mReceiveHook != NULL &&
+        aRequest.ReadBlockOption(OT_COAP_OPTION_BLOCK1, blockNumber, more, size) == OT_ERROR_NONE)
+    {
+        uint32_t        position = blockNumber * Message::GetBlockSize(size);
+        Block1Transfer *transfer = FindBlock1Transfer(aResource, aRequest, aMessageInfo);
+
+        aRequest.ReadUintOption(OT_COAP_OPTION_SIZE1, totalLength);
+
+        // Only the first block may start a transfer, any other block must follow the last one received from the peer.
+        if ((position != 0 && (transfer == NULL || transfer->mPosition != position)) ||
+            DeliverBlock(aRequest, position, more, totalLength, aResource.mReceiveHook, aResource.mContext) !=
+                OT_ERROR_NONE)
+        {
+            if (transfer != NULL)
+            {
+                transfer->mResource = NULL;
+            }
+
+            SendHeaderResponse(OT_COAP_CODE_REQUEST_INCOMPLETE, aRequest, aMessageInfo);
+            ExitNow();
+        }
+
+        if (more)
+        {
+            if (transfer == NULL)
+            {
+                transfer = NewBlock1Transfer(aResource, aRequest, aMessageInfo);
+            }
+
+            transfer->mPosition   = position + Message::GetBlockSize(size);
+            transfer->mUpdateTime = TimerMilli::GetNow();
+
+            SendBlockResponse(OT_COAP_CODE_CONTINUE, aRequest, aMessageInfo, OT_COAP_OPTION_BLOCK1, position, size,
+                              NULL, NULL);
+            ExitNow();
+        }
+
+        if (transfer != NULL)
+        {
+            transfer->mResource = NULL;
+        }
+    }
+    else if (aResource.mTransmitHook != NULL &&
+             aRequest.ReadBlockOption(OT_COAP_OPTION_BLOCK2, blockNumber, more, size) == OT_ERROR_NONE &&
+             blockNumber > 0)
+    {
+        uint32_t       position     = blockNumber * Message::GetBlockSize(size);
+        otCoapBlockSzx responseSize = GetBlockSzx(aRequest.GetOptionStart());
+
+        // The first block is sent by the resource handler, the following ones are served directly.
+        if (SendBlockResponse(OT_COAP_CODE_CONTENT, aRequest, aMessageInfo, OT_COAP_OPTION_BLOCK2, position,
+                              size < responseSize ? size : responseSize, aResource.mTransmitHook,
+                              aResource.mContext) != OT_ERROR_NONE)
+        {
+            SendHeaderResponse(OT_COAP_CODE_INTERNAL_ERROR, aRequest, aMessageInfo);
+        }
+
+        ExitNow();
+    }
+
+    aResource.HandleRequest(aRequest, aMessageInfo);
+
+exit:
+    return;
+}
+
+CoapBase::Block1Transfer *CoapBase::FindBlock1Transfer(const ResourceBlockWise &aResource,
+                                                       const Message &          aRequest,
+                                                       const Ip6::MessageInfo & aMessageInfo)
+{
+    Block1Transfer *rval = NULL;
+
+    for (uint8_t i = 0; i < kMaxBlock1Transfers; i++)
+    {
+        Block1Transfer &transfer = mBlock1Transfers[i];
+
+        if (transfer.mResource == &aResource && transfer.mPeerAddress == aMessageInfo.GetPeerAddr() &&
+            transfer.mPeerPort == aMessageInfo.GetPeerPort() && transfer.mTokenLength == aRequest.GetTokenLength() &&
+            memcmp(transfer.mToken, aRequest.GetToken(), transfer.mTokenLength) == 0)
+        {
+            ExitNow(rval = &transfer);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+CoapBase::Block1Transfer *CoapBase::NewBlock1Transfer(const ResourceBlockWise &aResource,
+                                                      const Message &          aRequest,
+                                                      const Ip6::MessageInfo & aMessageInfo)
+{
+    uint32_t        now  = TimerMilli::GetNow();
+    Block1Transfer *rval = &mBlock1Transfers[0];
+
+    // Use an unused entry, or else replace the transfer that was idle the longest.
+    for (uint8_t i = 0; i < kMaxBlock1Transfers && rval->mResource != NULL; i++)
+    {
+        Block1Transfer &transfer = mBlock1Transfers[i];
+
+        if (transfer.mResource == NULL || now - transfer.mUpdateTime > now - rval->mUpdateTime)
+        {
+            rval = &transfer;
+        }
+    }
+
+    rval->mResource    = &aResource;
+    rval->mPeerAddress = aMessageInfo.GetPeerAddr();
+    rval->mPeerPort    = aMessageInfo.GetPeerPort();
+    rval->mTokenLength = aRequest.GetTokenLength();
+    memcpy(rval->mToken, aRequest.GetToken(), rval->mTokenLength);
+
+    return rval;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 CoapMetadata::CoapMetadata(bool                    aConfirmable,
                            const Ip6::MessageInfo &aMessageInfo,
                            otCoapResponseHandler   aHandler,
@@ -674,6 +1325,14 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
     mDestinationAddress    = aMessageInfo.GetPeerAddr();
     mResponseHandler       = aHandler;
     mResponseContext       = aContext;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    mBlockWiseTransmitHook = NULL;
+    mBlockWiseReceiveHook  = NULL;
+    mBlockWiseHeaderLength = 0;
+    mBlockWisePosition     = 0;
+    mBlockWiseSzx          = OT_COAP_OPTION_BLOCK_SZX_16;
+    mBlockWiseMore         = false;
+#endif
     mRetransmissionCount   = 0;
     mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
     mRetransmissionTimeout += Random::GetUint32InRange(
@@ -695,37 +1354,31 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
     mConfirmable  = aConfirmable;
 }
 
-ResponsesQueue::ResponsesQueue(Instance &aInstance)
+ResponsesQueue::ResponsesQueue(Instance &aInstance, CoapCounters &aCounters)
     : mQueue()
+    , mIndex()
     , mTimer(aInstance, &ResponsesQueue::HandleTimer, this)
+    , mCounters(aCounters)
 {
 }
 
-otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
-                                               const Ip6::MessageInfo &aMessageInfo,
-                                               Message **              aResponse)
+uint16_t ResponsesQueue::GetResponseKey(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
 {
-    otError                error = OT_ERROR_NOT_FOUND;
-    Message *              message;
-    EnqueuedResponseHeader enqueuedResponseHeader;
-    Ip6::MessageInfo       messageInfo;
+    return aMessageId ^ aMessageInfo.GetPeerPort() ^ aMessageInfo.GetPeerAddr().mFields.m16[7];
+}
 
-    for (message = static_cast<Message *>(mQueue.GetHead()); message != NULL;
-         message = static_cast<Message *>(message->GetNext()))
-    {
-        enqueuedResponseHeader.ReadFrom(*message);
-        messageInfo = enqueuedResponseHeader.GetMessageInfo();
+Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+{
+    uint16_t                key = GetResponseKey(aRequest.GetMessageId(), aMessageInfo);
+    Message *               message;
+    ResponseIndex::Iterator iterator;
+    EnqueuedResponseHeader  enqueuedResponseHeader;
 
-        // Check source endpoint
-        if (messageInfo.GetPeerPort() != aMessageInfo.GetPeerPort())
-        {
-            continue;
-        }
+    mCounters.mResponseLookups++;
 
-        if (messageInfo.GetPeerAddr() != aMessageInfo.GetPeerAddr())
-        {
-            continue;
-        }
+    for (message = mIndex.FindFirst(key, iterator); message != NULL; message = mIndex.FindNext(key, iterator))
+    {
+        mCounters.mResponseProbes++;
 
         // Check Message Id
         if (message->GetMessageId() != aRequest.GetMessageId())
@@ -733,41 +1386,45 @@ otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
             continue;
         }
 
-        VerifyOrExit((*aResponse = message->Clone(message->GetLength() - sizeof(EnqueuedResponseHeader))) != NULL,
-                     error = OT_ERROR_NO_BUFS);
+        // Check source endpoint
+        enqueuedResponseHeader.ReadFrom(*message);
 
-        error = OT_ERROR_NONE;
-        break;
+        if (enqueuedResponseHeader.GetMessageInfo().GetPeerPort() == aMessageInfo.GetPeerPort() &&
+            enqueuedResponseHeader.GetMessageInfo().GetPeerAddr() == aMessageInfo.GetPeerAddr())
+        {
+            break;
+        }
     }
 
+    return message;
+}
+
+otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
+                                               const Ip6::MessageInfo &aMessageInfo,
+                                               Message **              aResponse)
+{
+    otError  error = OT_ERROR_NONE;
+    Message *message;
+
+    VerifyOrExit((message = FindMatchedResponse(aRequest, aMessageInfo)) != NULL, error = OT_ERROR_NOT_FOUND);
+
+    VerifyOrExit((*aResponse = message->Clone(message->GetLength() - sizeof(EnqueuedResponseHeader))) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+
 exit:
     return error;
 }
 
 void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    otError                error          = OT_ERROR_NONE;
-    Message *              cachedResponse = NULL;
-    Message *              responseCopy   = NULL;
+    otError                error        = OT_ERROR_NONE;
+    Message *              responseCopy = NULL;
     EnqueuedResponseHeader enqueuedResponseHeader(aMessageInfo);
     uint16_t               messageCount;
     uint16_t               bufferCount;
+    bool                   indexed;
 
-    switch (GetMatchedResponseCopy(aMessage, aMessageInfo, &cachedResponse))
-    {
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    case OT_ERROR_NONE:
-        assert(cachedResponse != NULL);
-        cachedResponse->Free();
-
-        // fall through
-
-    case OT_ERROR_NO_BUFS:
-    default:
-        ExitNow();
-    }
+    VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == NULL);
 
     mQueue.GetInfo(messageCount, bufferCount);
 
@@ -781,6 +1438,11 @@ void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &
     SuccessOrExit(error = enqueuedResponseHeader.AppendTo(*responseCopy));
     mQueue.Enqueue(*responseCopy);
 
+    // The oldest response was dequeued above when the cache was full, so there is always room in the index.
+    indexed = mIndex.Add(*responseCopy, GetResponseKey(responseCopy->GetMessageId(), aMessageInfo));
+    assert(indexed);
+    OT_UNUSED_VARIABLE(indexed);
+
     if (!mTimer.IsRunning())
     {
         mTimer.Start(TimerMilli::SecToMsec(kExchangeLifetime));
@@ -817,6 +1479,17 @@ void ResponsesQueue::DequeueAllResponses(void)
     }
 }
 
+void ResponsesQueue::DequeueResponse(Message &aMessage)
+{
+    EnqueuedResponseHeader enqueuedResponseHeader;
+
+    enqueuedResponseHeader.ReadFrom(aMessage);
+    mIndex.Remove(aMessage, GetResponseKey(aMessage.GetMessageId(), enqueuedResponseHeader.GetMessageInfo()));
+
+    mQueue.Dequeue(aMessage);
+    aMessage.Free();
+}
+
 void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
     static_cast<ResponsesQueue *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleTimer();
@@ -84,6 +84,194 @@ enum
     kNonLifetime      = kMaxTransmitSpan + kMaxLatency
 };
 
+/**
+ * This structure represents counters for matching CoAP messages to transactions and resources.
+ *
+ */
+struct CoapCounters
+{
+    uint16_t mPendingRequests;     ///< Number of requests currently awaiting an acknowledgment or a response.
+    uint16_t mPendingRequestsPeak; ///< Highest number of requests pending at the same time.
+    uint32_t mRequestLookups;      ///< Number of received responses matched against pending requests.
+    uint32_t mRequestProbes;       ///< Number of pending requests examined while matching responses.
+    uint32_t mResponseLookups;     ///< Number of lookups in the cached responses.
+    uint32_t mResponseProbes;      ///< Number of cached responses examined during lookups.
+    uint32_t mResourceLookups;     ///< Number of received requests dispatched by Uri-Path.
+    uint32_t mResourceProbes;      ///< Number of resources whose Uri-Path was compared during dispatch.
+};
+
+/**
+ * This class implements a fixed-size hash index of messages keyed by a 16-bit value.
+ *
+ * Messages are chained within the bucket selected by their key, in the order they were added, so a lookup only
+ * examines the messages sharing a bucket instead of walking the whole message queue.
+ *
+ */
+template <uint8_t kNumEntries, uint8_t kNumBuckets> class MessageIndex
+{
+public:
+    /**
+     * This type is used to iterate over the messages matching a key.
+     *
+     */
+    typedef uint8_t Iterator;
+
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    MessageIndex(void) { Clear(); }
+
+    /**
+     * This method removes all messages from the index.
+     *
+     */
+    void Clear(void)
+    {
+        OT_STATIC_ASSERT(kNumEntries > 0 && kNumEntries < kInvalidEntry, "Unsupported number of index entries");
+        OT_STATIC_ASSERT(kNumBuckets > 0, "Unsupported number of index buckets");
+
+        for (uint8_t i = 0; i < kNumBuckets; i++)
+        {
+            mBuckets[i] = kInvalidEntry;
+        }
+
+        for (uint8_t i = 0; i < kNumEntries; i++)
+        {
+            mEntries[i].mNext = i + 1;
+        }
+
+        mEntries[kNumEntries - 1].mNext = kInvalidEntry;
+        mFreeEntry                      = 0;
+    }
+
+    /**
+     * This method adds a message to the index.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     * @param[in]  aKey      The key of @p aMessage.
+     *
+     * @retval TRUE   Successfully added @p aMessage.
+     * @retval FALSE  The index is full.
+     *
+     */
+    bool Add(Message &aMessage, uint16_t aKey)
+    {
+        bool     rval  = false;
+        uint8_t  entry = mFreeEntry;
+        uint8_t *link  = &mBuckets[aKey % kNumBuckets];
+
+        VerifyOrExit(entry != kInvalidEntry);
+        mFreeEntry = mEntries[entry].mNext;
+
+        while (*link != kInvalidEntry)
+        {
+            link = &mEntries[*link].mNext;
+        }
+
+        mEntries[entry].mMessage = &aMessage;
+        mEntries[entry].mKey     = aKey;
+        mEntries[entry].mNext    = kInvalidEntry;
+        *link                    = entry;
+        rval                     = true;
+
+    exit:
+        return rval;
+    }
+
+    /**
+     * This method removes a message from the index.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     * @param[in]  aKey      The key @p aMessage was added with.
+     *
+     * @retval TRUE   Successfully removed @p aMessage.
+     * @retval FALSE  The @p aMessage was not in the index.
+     *
+     */
+    bool Remove(const Message &aMessage, uint16_t aKey)
+    {
+        bool rval = false;
+
+        for (uint8_t *link = &mBuckets[aKey % kNumBuckets]; *link != kInvalidEntry; link = &mEntries[*link].mNext)
+        {
+            uint8_t entry = *link;
+
+            if (mEntries[entry].mMessage == &aMessage)
+            {
+                *link                 = mEntries[entry].mNext;
+                mEntries[entry].mNext = mFreeEntry;
+                mFreeEntry            = entry;
+                ExitNow(rval = true);
+            }
+        }
+
+    exit:
+        return rval;
+    }
+
+    /**
+     * This method returns the first message added with a given key.
+     *
+     * @param[in]   aKey       The key.
+     * @param[out]  aIterator  A reference to an iterator to pass to FindNext().
+     *
+     * @returns A pointer to the first message with @p aKey, or NULL if there is none.
+     *
+     */
+    Message *FindFirst(uint16_t aKey, Iterator &aIterator) const
+    {
+        aIterator = mBuckets[aKey % kNumBuckets];
+        return FindNext(aKey, aIterator);
+    }
+
+    /**
+     * This method returns the next message added with a given key.
+     *
+     * @param[in]     aKey       The key.
+     * @param[inout]  aIterator  A reference to the iterator returned from FindFirst().
+     *
+     * @returns A pointer to the next message with @p aKey, or NULL if there are no more.
+     *
+     */
+    Message *FindNext(uint16_t aKey, Iterator &aIterator) const
+    {
+        Message *message = NULL;
+
+        while (aIterator != kInvalidEntry)
+        {
+            const Entry &entry = mEntries[aIterator];
+
+            aIterator = entry.mNext;
+
+            if (entry.mKey == aKey)
+            {
+                message = entry.mMessage;
+                break;
+            }
+        }
+
+        return message;
+    }
+
+private:
+    enum
+    {
+        kInvalidEntry = 0xff,
+    };
+
+    struct Entry
+    {
+        Message *mMessage;
+        uint16_t mKey;
+        uint8_t  mNext;
+    };
+
+    Entry   mEntries[kNumEntries];
+    uint8_t mBuckets[kNumBuckets];
+    uint8_t mFreeEntry;
+};
+
 /**
  * This class implements metadata required for CoAP retransmission.
  *
@@ -102,6 +290,14 @@ public:
         : mDestinationPort(0)
         , mResponseHandler(NULL)
         , mResponseContext(NULL)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        , mBlockWiseTransmitHook(NULL)
+        , mBlockWiseReceiveHook(NULL)
+        , mBlockWiseHeaderLength(0)
+        , mBlockWisePosition(0)
+        , mBlockWiseSzx(OT_COAP_OPTION_BLOCK_SZX_16)
+        , mBlockWiseMore(false)
+#endif
         , mNextTimerShot(0)
         , mRetransmissionTimeout(0)
         , mRetransmissionCount(0)
@@ -185,6 +381,14 @@ private:
     uint16_t              mDestinationPort;       ///< UDP port of the message destination.
     otCoapResponseHandler mResponseHandler;       ///< A function pointer that is called on response reception.
     void *                mResponseContext;       ///< A pointer to arbitrary context information.
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapBlockWiseTransmitHook mBlockWiseTransmitHook; ///< A function pointer producing the Block1 payload.
+    otCoapBlockWiseReceiveHook  mBlockWiseReceiveHook;  ///< A function pointer consuming the Block2 payload.
+    uint16_t                    mBlockWiseHeaderLength; ///< Length of the request header without block options.
+    uint32_t                    mBlockWisePosition;     ///< Position of the block sent (Block1) or requested (Block2).
+    uint8_t                     mBlockWiseSzx;          ///< Size exponent of the block option sent.
+    bool                        mBlockWiseMore;         ///< Whether more Block1 blocks remain to be sent.
+#endif
     uint32_t              mNextTimerShot;         ///< Time when the timer should shoot for this message.
     uint32_t              mRetransmissionTimeout; ///< Delay that is applied to next retransmission.
     uint8_t               mRetransmissionCount;   ///< Number of retransmissions.
@@ -244,6 +448,64 @@ private:
     }
 };
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+/**
+ * This class implements CoAP resource handling with block-wise transfer.
+ *
+ */
+class ResourceBlockWise : public otCoapBlockWiseResource
+{
+    friend class CoapBase;
+
+public:
+    /**
+     * This constructor initializes the resource.
+     *
+     * @param[in]  aUriPath       A pointer to a NULL-terminated string for the Uri-Path.
+     * @param[in]  aHandler       A function pointer that is called when a complete request for @p aUriPath is
+     *                            received.
+     * @param[in]  aReceiveHook   A function pointer consuming Block1 requests, or NULL.
+     * @param[in]  aTransmitHook  A function pointer producing Block2 responses, or NULL.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     */
+    ResourceBlockWise(const char *                aUriPath,
+                      otCoapRequestHandler        aHandler,
+                      otCoapBlockWiseReceiveHook  aReceiveHook,
+                      otCoapBlockWiseTransmitHook aTransmitHook,
+                      void *                      aContext)
+    {
+        mUriPath      = aUriPath;
+        mHandler      = aHandler;
+        mReceiveHook  = aReceiveHook;
+        mTransmitHook = aTransmitHook;
+        mContext      = aContext;
+        mNext         = NULL;
+    }
+
+    /**
+     * This method returns a pointer to the next resource.
+     *
+     * @returns A Pointer to the next resource.
+     *
+     */
+    ResourceBlockWise *GetNext(void) const { return static_cast<ResourceBlockWise *>(mNext); };
+
+    /**
+     * This method returns a pointer to the Uri-Path.
+     *
+     * @returns A Pointer to the Uri-Path.
+     *
+     */
+    const char *GetUriPath(void) const { return mUriPath; };
+
+private:
+    void HandleRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
+    {
+        mHandler(mContext, &aMessage, &aMessageInfo);
+    }
+};
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 /**
  * This class implements metadata required for caching CoAP responses.
  *
@@ -339,9 +601,10 @@ public:
      * Default class constructor.
      *
      * @param[in]  aInstance  A reference to the OpenThread instance.
+     * @param[in]  aCounters  A reference to the counters updated by lookups in the cache.
      *
      */
-    explicit ResponsesQueue(Instance &aInstance);
+    ResponsesQueue(Instance &aInstance, CoapCounters &aCounters);
 
     /**
      * Add given response to the cache.
@@ -396,17 +659,20 @@ private:
         kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
     };
 
-    void DequeueResponse(Message &aMessage)
-    {
-        mQueue.Dequeue(aMessage);
-        aMessage.Free();
-    }
+    typedef MessageIndex<kMaxCachedResponses, kMaxCachedResponses> ResponseIndex;
+
+    Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    void     DequeueResponse(Message &aMessage);
+
+    static uint16_t GetResponseKey(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
     MessageQueue      mQueue;
+    ResponseIndex     mIndex;
     TimerMilliContext mTimer;
+    CoapCounters &    mCounters;
 };
 
 /**
@@ -471,6 +737,27 @@ public:
      */
     void RemoveResource(Resource &aResource);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method adds a block-wise resource to the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     * @retval OT_ERROR_NONE     Successfully added @p aResource.
+     * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+     *
+     */
+    otError AddBlockWiseResource(ResourceBlockWise &aResource);
+
+    /**
+     * This method removes a block-wise resource from the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     */
+    void RemoveBlockWiseResource(ResourceBlockWise &aResource);
+#endif
+
     /* This function sets the default handler for unhandled CoAP requests.
      *
      * @param[in]  aHandler   A function pointer that shall be called when an unhandled request arrives.
@@ -512,6 +799,40 @@ public:
                         otCoapResponseHandler   aHandler = NULL,
                         void *                  aContext = NULL);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method sends a CoAP message block-wise (RFC 7959).
+     *
+     * For a confirmable request, the payload is produced by @p aTransmitHook one Block1 block at a time and a
+     * block-wise response is handed to @p aReceiveHook one Block2 block at a time. @p aHandler is called with the
+     * final response once the whole transfer has completed, or with an error if it failed.
+     *
+     * For a response, only the first Block2 block is produced by @p aTransmitHook. The following blocks are requested
+     * by the client and produced by the transmit hook of the block-wise resource the request was addressed to.
+     *
+     * The block size is chosen so that each message fits in a single IEEE 802.15.4 frame, and is reduced further if
+     * the peer asks for smaller blocks.
+     *
+     * @param[in]  aMessage       A reference to the message, without payload, to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aHandler       A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext       A pointer to arbitrary context information passed to @p aHandler and the hooks.
+     * @param[in]  aTransmitHook  A function pointer producing the payload, or NULL.
+     * @param[in]  aReceiveHook   A function pointer consuming a block-wise response payload, or NULL.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent the first block of the CoAP message.
+     * @retval OT_ERROR_NO_BUFS       Failed to allocate retransmission data.
+     * @retval OT_ERROR_INVALID_ARGS  A request is not confirmable, or a response is given a handler or receive hook.
+     *
+     */
+    otError SendMessage(Message &                   aMessage,
+                        const Ip6::MessageInfo &    aMessageInfo,
+                        otCoapResponseHandler       aHandler,
+                        void *                      aContext,
+                        otCoapBlockWiseTransmitHook aTransmitHook,
+                        otCoapBlockWiseReceiveHook  aReceiveHook);
+#endif
+
     /**
      * This method sends a CoAP reset message.
      *
@@ -634,6 +955,22 @@ public:
      */
     const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
+    /**
+     * This method returns the transaction and resource matching counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    const CoapCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the transaction and resource matching counters.
+     *
+     * The number of pending requests is preserved and becomes the new peak.
+     *
+     */
+    void ResetCounters(void);
+
 protected:
     /**
      * This constructor initializes the object.
@@ -655,6 +992,40 @@ protected:
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum
+    {
+        kPendingRequestIndexSize = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE,
+        kResourceHashBuckets     = OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS,
+    };
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    enum
+    {
+        kBlockFramePayloadSize = OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE,
+        kBlockOptionOverhead   = 6, ///< Block option header and value, and the payload marker.
+        kMaxBlockSzx           = OT_COAP_OPTION_BLOCK_SZX_64,
+        kMaxBlockLength        = 64, ///< Larger blocks never fit in a single IEEE 802.15.4 frame.
+        kMaxBlock1Transfers    = OPENTHREAD_CONFIG_COAP_BLOCKWISE_MAX_BLOCK1_TRANSFERS,
+    };
+
+    /**
+     * This structure tracks a Block1 transfer received by a block-wise resource, identified by peer and token.
+     *
+     */
+    struct Block1Transfer
+    {
+        const ResourceBlockWise *mResource;   ///< The resource receiving the transfer, NULL if the entry is unused.
+        Ip6::Address             mPeerAddress;
+        uint16_t                 mPeerPort;
+        uint8_t                  mTokenLength;
+        uint8_t                  mToken[OT_COAP_MAX_TOKEN_LENGTH];
+        uint32_t                 mPosition;   ///< The position of the next block expected.
+        uint32_t                 mUpdateTime; ///< The time the last block was received.
+    };
+#endif
+
+    typedef MessageIndex<kPendingRequestIndexSize, kPendingRequestIndexSize> RequestIndex;
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
@@ -663,6 +1034,10 @@ private:
     Message *FindRelatedRequest(const Message &         aResponse,
                                 const Ip6::MessageInfo &aMessageInfo,
                                 CoapMetadata &          aCoapMetadata);
+    bool     IsRelatedRequest(const Message &         aRequest,
+                              const Message &         aResponse,
+                              const Ip6::MessageInfo &aMessageInfo,
+                              CoapMetadata &          aCoapMetadata);
     void     FinalizeCoapTransaction(Message &               aRequest,
                                      const CoapMetadata &    aCoapMetadata,
                                      Message *               aResponse,
@@ -672,6 +1047,7 @@ private:
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    otError SendMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo, const CoapMetadata &aCoapMetadata);
     otError SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError SendEmptyMessage(Message::Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
 
@@ -690,11 +1066,66 @@ private:
         return mSender(*this, aMessage, aMessageInfo);
     }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    static otCoapBlockSzx GetBlockSzx(uint16_t aHeaderLength);
+
+    otError AppendBlock(Message &                   aMessage,
+                        uint16_t                    aNumber,
+                        uint32_t                    aPosition,
+                        otCoapBlockSzx              aSize,
+                        otCoapBlockWiseTransmitHook aTransmitHook,
+                        void *                      aContext,
+                        bool &                      aMore);
+    otError DeliverBlock(const Message &            aMessage,
+                         uint32_t                   aPosition,
+                         bool                       aMore,
+                         uint32_t                   aTotalLength,
+                         otCoapBlockWiseReceiveHook aReceiveHook,
+                         void *                     aContext);
+    otError SendNextBlock(Message &           aRequest,
+                          const CoapMetadata &aCoapMetadata,
+                          uint16_t            aNumber,
+                          uint32_t            aPosition,
+                          otCoapBlockSzx      aSize);
+    otError SendBlockResponse(Message::Code               aCode,
+                              const Message &             aRequest,
+                              const Ip6::MessageInfo &    aMessageInfo,
+                              uint16_t                    aNumber,
+                              uint32_t                    aPosition,
+                              otCoapBlockSzx              aSize,
+                              otCoapBlockWiseTransmitHook aTransmitHook,
+                              void *                      aContext);
+    void    ProcessBlockWiseResponse(Message &               aRequest,
+                                     const CoapMetadata &    aCoapMetadata,
+                                     Message &               aResponse,
+                                     const Ip6::MessageInfo &aMessageInfo);
+    void    ProcessBlockWiseRequest(const ResourceBlockWise &aResource,
+                                    Message &                aRequest,
+                                    const Ip6::MessageInfo & aMessageInfo);
+
+    Block1Transfer *FindBlock1Transfer(const ResourceBlockWise &aResource,
+                                       const Message &          aRequest,
+                                       const Ip6::MessageInfo & aMessageInfo);
+    Block1Transfer *NewBlock1Transfer(const ResourceBlockWise &aResource,
+                                      const Message &          aRequest,
+                                      const Ip6::MessageInfo & aMessageInfo);
+#endif
+
+    static uint16_t GetTokenKey(const Message &aMessage);
+    static uint8_t  GetResourceBucket(const char *aUriPath);
+
     MessageQueue      mPendingRequests;
+    RequestIndex      mRequestsById;
+    RequestIndex      mRequestsByToken;
+    uint16_t          mUnindexedRequests;
     uint16_t          mMessageId;
     TimerMilliContext mRetransmissionTimer;
 
-    Resource *mResources;
+    Resource *mResources[kResourceHashBuckets];
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    ResourceBlockWise *mBlockWiseResources[kResourceHashBuckets];
+    Block1Transfer     mBlock1Transfers[kMaxBlock1Transfers];
+#endif
 
     void *         mContext;
     Interceptor    mInterceptor;
@@ -704,6 +1135,8 @@ private:
     void *               mDefaultHandlerContext;
 
     Sender mSender;
+
+    CoapCounters mCounters;
 };
 
 /**
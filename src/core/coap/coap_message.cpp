@@ -194,6 +194,75 @@ otError Message::AppendUriQueryOption(const char *aUriQuery)
     return AppendStringOption(OT_COAP_OPTION_URI_QUERY, aUriQuery);
 }
 
+otError Message::AppendBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSzx aSize)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t value;
+
+    VerifyOrExit(aNumber == OT_COAP_OPTION_BLOCK1 || aNumber == OT_COAP_OPTION_BLOCK2, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aBlockNumber <= kMaxBlockNumber && aSize <= OT_COAP_OPTION_BLOCK_SZX_1024,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    value = (aBlockNumber << kBlockNumberOffset) | static_cast<uint32_t>(aSize);
+
+    if (aMore)
+    {
+        value |= kBlockMoreFlag;
+    }
+
+    error = AppendUintOption(aNumber, value);
+
+exit:
+    return error;
+}
+
+otError Message::ReadBlockOption(uint16_t aNumber, uint32_t &aBlockNumber, bool &aMore, otCoapBlockSzx &aSize)
+{
+    otError  error;
+    uint32_t value;
+
+    SuccessOrExit(error = ReadUintOption(aNumber, value));
+
+    // The block option value is at most three bytes long.
+    VerifyOrExit(value <= ((kMaxBlockNumber << kBlockNumberOffset) | kBlockMoreFlag | kBlockSzxMask),
+                 error = OT_ERROR_PARSE);
+    VerifyOrExit((value & kBlockSzxMask) != kBlockSzxReserved, error = OT_ERROR_PARSE);
+
+    aBlockNumber = value >> kBlockNumberOffset;
+    aMore        = (value & kBlockMoreFlag) != 0;
+    aSize        = static_cast<otCoapBlockSzx>(value & kBlockSzxMask);
+
+exit:
+    return error;
+}
+
+otError Message::ReadUintOption(uint16_t aNumber, uint32_t &aValue)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    uint8_t value[sizeof(uint32_t)];
+
+    for (const otCoapOption *option = GetFirstOption(); option != NULL; option = GetNextOption())
+    {
+        if (option->mNumber == aNumber)
+        {
+            VerifyOrExit(option->mLength <= sizeof(value), error = OT_ERROR_PARSE);
+            SuccessOrExit(error = GetOptionValue(value));
+
+            aValue = 0;
+
+            for (uint16_t i = 0; i < option->mLength; i++)
+            {
+                aValue = (aValue << 8) | value[i];
+            }
+
+            ExitNow();
+        }
+    }
+
+exit:
+    return error;
+}
+
 const otCoapOption *Message::GetFirstOption(void)
 {
     const otCoapOption *option = NULL;
@@ -379,6 +448,27 @@ exit:
     return message;
 }
 
+Message *Message::CloneHeader(uint16_t aLength) const
+{
+    Message *message    = Clone(aLength);
+    uint16_t optionLast = 0;
+
+    VerifyOrExit(message != NULL);
+
+    // Restore the last option number, so that options appended to the copy are encoded relative to it.
+    for (const otCoapOption *option = message->GetFirstOption(); option != NULL; option = message->GetNextOption())
+    {
+        optionLast = option->mNumber;
+    }
+
+    message->GetHelpData().mOptionLast   = optionLast;
+    message->GetHelpData().mHeaderLength = aLength;
+    message->SetMessageId(0);
+
+exit:
+    return message;
+}
+
 #if OPENTHREAD_ENABLE_APPLICATION_COAP
 const char *Message::CodeToString(void) const
 {
@@ -431,6 +521,9 @@ const char *Message::CodeToString(void) const
     case OT_COAP_CODE_CHANGED:
         codeString = "Changed";
         break;
+    case OT_COAP_CODE_CONTINUE:
+        codeString = "Continue";
+        break;
     case OT_COAP_CODE_BAD_REQUEST:
         codeString = "BadRequest";
         break;
@@ -446,6 +539,9 @@ const char *Message::CodeToString(void) const
     case OT_COAP_CODE_NOT_ACCEPTABLE:
         codeString = "NotAcceptable";
         break;
+    case OT_COAP_CODE_REQUEST_INCOMPLETE:
+        codeString = "RequestIncomplete";
+        break;
     case OT_COAP_CODE_PRECONDITION_FAILED:
         codeString = "PreconditionFailed";
         break;
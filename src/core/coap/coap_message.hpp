@@ -360,6 +360,60 @@ public:
      */
     otError AppendUriQueryOption(const char *aUriQuery);
 
+    /**
+     * This method appends a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]  aNumber       The option number, either OT_COAP_OPTION_BLOCK1 or OT_COAP_OPTION_BLOCK2.
+     * @param[in]  aBlockNumber  The block number.
+     * @param[in]  aMore         TRUE if more blocks follow, FALSE otherwise.
+     * @param[in]  aSize         The block size exponent.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the option.
+     * @retval OT_ERROR_INVALID_ARGS  The option is not a block option, the block number does not fit in the option,
+     *                                or the option type is not equal or greater than the last option type.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError AppendBlockOption(uint16_t aNumber, uint32_t aBlockNumber, bool aMore, otCoapBlockSzx aSize);
+
+    /**
+     * This method reads the value of a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]   aNumber       The option number, either OT_COAP_OPTION_BLOCK1 or OT_COAP_OPTION_BLOCK2.
+     * @param[out]  aBlockNumber  The block number.
+     * @param[out]  aMore         TRUE if more blocks follow, FALSE otherwise.
+     * @param[out]  aSize         The block size exponent.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option.
+     * @retval OT_ERROR_NOT_FOUND  The message does not contain the option.
+     * @retval OT_ERROR_PARSE      The option value is malformed.
+     *
+     */
+    otError ReadBlockOption(uint16_t aNumber, uint32_t &aBlockNumber, bool &aMore, otCoapBlockSzx &aSize);
+
+    /**
+     * This method reads the value of an unsigned integer option.
+     *
+     * @param[in]   aNumber  The option number.
+     * @param[out]  aValue   The option value.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option.
+     * @retval OT_ERROR_NOT_FOUND  The message does not contain the option.
+     * @retval OT_ERROR_PARSE      The option value is longer than four bytes.
+     *
+     */
+    otError ReadUintOption(uint16_t aNumber, uint32_t &aValue);
+
+    /**
+     * This static method returns the number of bytes in a block of a given size exponent.
+     *
+     * @param[in]  aSize  The block size exponent.
+     *
+     * @returns The block size in bytes.
+     *
+     */
+    static uint16_t GetBlockSize(otCoapBlockSzx aSize) { return static_cast<uint16_t>(1 << (aSize + kBlockSzxBase)); }
+
     /**
      * This method returns a pointer to the first option.
      *
@@ -506,6 +560,19 @@ public:
      */
     Message *Clone(void) const { return Clone(GetLength()); };
 
+    /**
+     * This method creates a copy of the CoAP header and of the options in the first @p aLength bytes.
+     *
+     * The copy has no Message ID assigned, so a new one is assigned when it is sent. Further options can be
+     * appended to it after the copied ones.
+     *
+     * @param[in]  aLength  The length of the header and options to copy, which must end on an option boundary.
+     *
+     * @returns A pointer to the message or NULL if insufficient message buffers are available.
+     *
+     */
+    Message *CloneHeader(uint16_t aLength) const;
+
     /**
      * This method returns the minimal reserved bytes required for CoAP message.
      *
@@ -535,6 +602,13 @@ private:
 
         kMaxOptionHeaderSize = 5, ///< Maximum size of an Option header
 
+        kBlockSzxMask      = 0x7,     ///< Block size exponent mask as specified (RFC 7959).
+        kBlockSzxBase      = 4,       ///< Block size is 2 ** (SZX + 4) as specified (RFC 7959).
+        kBlockSzxReserved  = 7,       ///< Reserved block size exponent (RFC 7959).
+        kBlockMoreFlag     = 0x8,     ///< Block more flag as specified (RFC 7959).
+        kBlockNumberOffset = 4,       ///< Block number offset as specified (RFC 7959).
+        kMaxBlockNumber    = 0xfffff, ///< Maximum block number as specified (RFC 7959).
+
         kOption1ByteExtension = 13, ///< Indicates a 1 byte extension (RFC 7252).
         kOption2ByteExtension = 14, ///< Indicates a 1 byte extension (RFC 7252).
 
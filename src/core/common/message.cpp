@@ -37,6 +37,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
@@ -46,11 +47,16 @@ namespace ot {
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mNumUsedBuffers(0)
+    , mMaxUsedBuffers(0)
+    , mAllocFailures(0)
+    , mReservedAllocFailures(0)
     , mAllQueue()
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     // Initialize Platform buffer pool management.
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
+    assert(otPlatMessagePoolNumFreeBuffers(&GetInstance()) > kNumReservedBuffers);
 #else
     memset(mBuffers, 0, sizeof(mBuffers));
 
@@ -152,6 +158,15 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
     if (buffer == NULL)
     {
         otLogInfoMem("No available message buffer");
+        mAllocFailures++;
+        ExitNow();
+    }
+
+    mNumUsedBuffers++;
+
+    if (mNumUsedBuffers > mMaxUsedBuffers)
+    {
+        mMaxUsedBuffers = mNumUsedBuffers;
     }
 
 exit:
@@ -170,27 +185,79 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
         mFreeBuffers = aBuffer;
         mNumFreeBuffers++;
 #endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+        mNumUsedBuffers--;
         aBuffer = tmpBuffer;
     }
 }
 
 otError MessagePool::ReclaimBuffers(int aNumBuffers, uint8_t aPriority)
 {
+    otError error    = OT_ERROR_NONE;
+    int     required = aNumBuffers;
+
+    VerifyOrExit(aNumBuffers > 0);
+
+    // Buffers reserved for higher priority levels must remain available after the allocation.
+    required += GetReservedBufferCount(aPriority);
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-    while (aNumBuffers > GetFreeBufferCount())
+    while (required > GetFreeBufferCount())
     {
         SuccessOrExit(Get<MeshForwarder>().EvictMessage(aPriority));
     }
+#endif
 
 exit:
-#else  // OPENTHREAD_MTD || OPENTHREAD_FTD
-    OT_UNUSED_VARIABLE(aPriority);
-#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
-
-    // First comparison is to get around issues with comparing
-    // signed and unsigned numbers, if aNumBuffers is negative then
-    // the second comparison wont be attempted.
-    return (aNumBuffers < 0 || aNumBuffers <= GetFreeBufferCount()) ? OT_ERROR_NONE : OT_ERROR_NO_BUFS;
+    if (aNumBuffers > 0 && required > GetFreeBufferCount())
+    {
+        error = OT_ERROR_NO_BUFS;
+        mAllocFailures++;
+
+        if (aNumBuffers <= GetFreeBufferCount())
+        {
+            mReservedAllocFailures++;
+        }
+    }
+
+    return error;
+}
+
+uint16_t MessagePool::GetReservedBufferCount(uint8_t aPriority)
+{
+    uint16_t rval = 0;
+
+    if (aPriority < Message::kPriorityNet)
+    {
+        rval += OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET;
+    }
+
+    if (aPriority < Message::kPriorityHigh)
+    {
+        rval += OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH;
+    }
+
+    if (aPriority < Message::kPriorityNormal)
+    {
+        rval += OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL;
+    }
+
+    return rval;
+}
+
+void MessagePool::GetStats(otMessagePoolStats &aStats) const
+{
+    aStats.mTotalBuffers          = GetTotalBufferCount();
+    aStats.mUsedBuffers           = mNumUsedBuffers;
+    aStats.mMaxUsedBuffers        = mMaxUsedBuffers;
+    aStats.mAllocFailures         = mAllocFailures;
+    aStats.mReservedAllocFailures = mReservedAllocFailures;
+}
+
+void MessagePool::ResetStats(void)
+{
+    mMaxUsedBuffers        = mNumUsedBuffers;
+    mAllocFailures         = 0;
+    mReservedAllocFailures = 0;
 }
 
 uint16_t MessagePool::GetFreeBufferCount(void) const
@@ -352,6 +419,22 @@ exit:
     return error;
 }
 
+uint16_t Message::GetAvailableLength(void) const
+{
+    uint16_t freeBuffers     = GetMessagePool()->GetFreeBufferCount();
+    uint16_t reservedBuffers = MessagePool::GetReservedBufferCount(GetPriority());
+    uint32_t length          = kHeadBufferDataSize + (GetBufferCount() - 1) * static_cast<uint32_t>(kBufferDataSize);
+
+    if (freeBuffers > reservedBuffers)
+    {
+        length += (freeBuffers - reservedBuffers) * static_cast<uint32_t>(kBufferDataSize);
+    }
+
+    length -= GetReserved();
+
+    return (length < 0xffff) ? static_cast<uint16_t>(length) : 0xffff;
+}
+
 uint8_t Message::GetBufferCount(void) const
 {
     uint8_t rval = 1;
@@ -515,153 +598,104 @@ void Message::RemoveHeader(uint16_t aLength)
     }
 }
 
-uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    aChunk.mLength = 0;
+    aChunk.mBuffer = this;
 
     if (aOffset >= GetLength())
     {
+        aLength = 0;
         ExitNow();
     }
 
-    if (aOffset + aLength >= GetLength())
+    if (aLength > GetLength() - aOffset)
     {
         aLength = GetLength() - aOffset;
     }
 
     aOffset += GetReserved();
 
-    // special case first buffer
     if (aOffset < kHeadBufferDataSize)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(aBuf, GetFirstData() + aOffset, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
+        aChunk.mData   = GetFirstData() + aOffset;
+        aChunk.mLength = kHeadBufferDataSize - aOffset;
     }
     else
     {
         aOffset -= kHeadBufferDataSize;
-    }
-
-    // advance to offset
-    curBuffer = GetNextBuffer();
+        aChunk.mBuffer = GetNextBuffer();
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
-
-    // begin copy
-    while (aLength > 0)
-    {
-        assert(curBuffer != NULL);
-
-        bytesToCopy = kBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
+        while (aOffset >= kBufferDataSize)
         {
-            bytesToCopy = aLength;
+            assert(aChunk.mBuffer != NULL);
+
+            aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+            aOffset -= kBufferDataSize;
         }
 
-        memcpy(aBuf, curBuffer->GetData() + aOffset, bytesToCopy);
+        assert(aChunk.mBuffer != NULL);
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
+        aChunk.mData   = aChunk.mBuffer->GetData() + aOffset;
+        aChunk.mLength = kBufferDataSize - aOffset;
+    }
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    if (aChunk.mLength > aLength)
+    {
+        aChunk.mLength = aLength;
     }
 
+    aLength -= aChunk.mLength;
+
 exit:
-    return bytesCopied;
+    return;
 }
 
-int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    aChunk.mLength = 0;
 
-    assert(aOffset + aLength <= GetLength());
+    VerifyOrExit(aLength > 0);
 
-    if (aOffset + aLength >= GetLength())
-    {
-        aLength = GetLength() - aOffset;
-    }
+    aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+    assert(aChunk.mBuffer != NULL);
 
-    aOffset += GetReserved();
+    aChunk.mData   = aChunk.mBuffer->GetData();
+    aChunk.mLength = (aLength < kBufferDataSize) ? aLength : static_cast<uint16_t>(kBufferDataSize);
 
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
-    {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
+    aLength -= aChunk.mLength;
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(GetFirstData() + aOffset, aBuf, bytesToCopy);
+exit:
+    return;
+}
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+{
+    uint8_t *bufPtr      = static_cast<uint8_t *>(aBuf);
+    uint16_t bytesCopied = 0;
+    Chunk    chunk;
 
-        aOffset = 0;
-    }
-    else
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
     {
-        aOffset -= kHeadBufferDataSize;
+        memcpy(bufPtr + bytesCopied, chunk.GetData(), chunk.GetLength());
+        bytesCopied += chunk.GetLength();
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return bytesCopied;
+}
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+{
+    const uint8_t *bufPtr      = static_cast<const uint8_t *>(aBuf);
+    uint16_t       bytesCopied = 0;
+    WritableChunk  chunk;
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
+    assert(aOffset + aLength <= GetLength());
 
-    // begin copy
-    while (aLength > 0)
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
     {
-        assert(curBuffer != NULL);
-
-        bytesToCopy = kBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(curBuffer->GetData() + aOffset, aBuf, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+        memcpy(chunk.GetData(), bufPtr + bytesCopied, chunk.GetLength());
+        bytesCopied += chunk.GetLength();
     }
 
     return bytesCopied;
@@ -670,22 +704,37 @@ int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
     uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
-    uint8_t  buf[16];
+    Chunk    chunk;
 
-    while (aLength > 0)
+    if (&aMessage == this)
     {
-        bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
+        // The source and destination ranges may overlap, so copy through an intermediate buffer.
+        uint8_t  buf[16];
+        uint16_t bytesToCopy;
+
+        while (aLength > 0)
+        {
+            bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
 
-        Read(aSourceOffset, bytesToCopy, buf);
-        aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+            Read(aSourceOffset, bytesToCopy, buf);
+            aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+
+            aSourceOffset += bytesToCopy;
+            aDestinationOffset += bytesToCopy;
+            aLength -= bytesToCopy;
+            bytesCopied += bytesToCopy;
+        }
 
-        aSourceOffset += bytesToCopy;
-        aDestinationOffset += bytesToCopy;
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
+        ExitNow();
+    }
+
+    for (GetFirstChunk(aSourceOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
+    {
+        aMessage.Write(aDestinationOffset + bytesCopied, chunk.GetLength(), chunk.GetData());
+        bytesCopied += chunk.GetLength();
     }
 
+exit:
     return bytesCopied;
 }
 
@@ -719,38 +768,10 @@ exit:
     return messageCopy;
 }
 
-bool Message::GetChildMask(uint8_t aChildIndex) const
-{
-    assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
-    return (mBuffer.mHead.mInfo.mChildMask[aChildIndex / 8] & (0x80 >> (aChildIndex % 8))) != 0;
-}
-
-void Message::ClearChildMask(uint8_t aChildIndex)
-{
-    assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
-    mBuffer.mHead.mInfo.mChildMask[aChildIndex / 8] &= ~(0x80 >> (aChildIndex % 8));
-}
-
-void Message::SetChildMask(uint8_t aChildIndex)
+void Message::DecrementChildPendingCount(void)
 {
-    assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
-    mBuffer.mHead.mInfo.mChildMask[aChildIndex / 8] |= 0x80 >> (aChildIndex % 8);
-}
-
-bool Message::IsChildPending(void) const
-{
-    bool rval = false;
-
-    for (size_t i = 0; i < sizeof(mBuffer.mHead.mInfo.mChildMask); i++)
-    {
-        if (mBuffer.mHead.mInfo.mChildMask[i] != 0)
-        {
-            ExitNow(rval = true);
-        }
-    }
-
-exit:
-    return rval;
+    assert(mBuffer.mHead.mInfo.mChildPendingCount > 0);
+    mBuffer.mHead.mInfo.mChildPendingCount--;
 }
 
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
@@ -762,77 +783,62 @@ uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
 {
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBuf);
+    uint64_t       sum   = 0;
+    uint32_t       word;
+
+    // The one's complement sum does not depend on byte order, so the data is summed as 32-bit words in host byte
+    // order into a 64-bit accumulator (which cannot overflow for a 16-bit length). The folded result is converted to
+    // network byte order once at the end.
 
-    for (int i = 0; i < aLength; i++)
+    for (; aLength >= sizeof(word); aLength -= sizeof(word), bytes += sizeof(word))
     {
-        aChecksum = UpdateChecksum(aChecksum, (i & 1) ? bytes[i] : static_cast<uint16_t>(bytes[i] << 8));
+        memcpy(&word, bytes, sizeof(word));
+        sum += word;
     }
 
-    return aChecksum;
-}
-
-uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
-{
-    Buffer * curBuffer;
-    uint16_t bytesCovered = 0;
-    uint16_t bytesToCover;
-
-    assert(aOffset + aLength <= GetLength());
-
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    if (aLength > 0)
     {
-        bytesToCover = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
-
-        aChecksum = Message::UpdateChecksum(aChecksum, GetFirstData() + aOffset, bytesToCover);
-
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
-
-        aOffset = 0;
+        // Zero-pad the trailing bytes; an odd last byte becomes the most significant byte of its 16-bit word.
+        word = 0;
+        memcpy(&word, bytes, aLength);
+        sum += word;
     }
-    else
+
+    while ((sum >> 16) != 0)
     {
-        aOffset -= kHeadBufferDataSize;
+        sum = (sum & 0xffff) + (sum >> 16);
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return UpdateChecksum(aChecksum, Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum)));
+}
 
-    while (aOffset >= kBufferDataSize)
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength, uint16_t aPosition)
+{
+    if (aPosition & 1)
     {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+        // Bytes at odd positions are the low bytes of 16-bit words. Summing byte-swapped values gives the byte-swapped
+        // sum, so the buffer is summed as if it were aligned and the result is swapped back.
+        aChecksum = Encoding::Swap16(UpdateChecksum(Encoding::Swap16(aChecksum), aBuf, aLength));
     }
-
-    // begin copy
-    while (aLength > 0)
+    else
     {
-        assert(curBuffer != NULL);
-
-        bytesToCover = kBufferDataSize - aOffset;
+        aChecksum = UpdateChecksum(aChecksum, aBuf, aLength);
+    }
 
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
+    return aChecksum;
+}
 
-        aChecksum = Message::UpdateChecksum(aChecksum, curBuffer->GetData() + aOffset, bytesToCover);
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
+{
+    uint16_t bytesCovered = 0;
+    Chunk    chunk;
 
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
+    assert(aOffset + aLength <= GetLength());
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
+    {
+        aChecksum = Message::UpdateChecksum(aChecksum, chunk.GetData(), chunk.GetLength(), bytesCovered);
+        bytesCovered += chunk.GetLength();
     }
 
     return aChecksum;
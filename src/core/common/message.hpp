@@ -47,6 +47,7 @@
 #include "common/tlvs.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/link_quality.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -99,9 +100,10 @@ struct MessageInfo
     uint16_t    mDatagramTag; ///< The datagram tag used for 6LoWPAN fragmentation.
     RssAverager mRssAverager; ///< The averager maintaining the received signal strength (RSS) average.
 
-    uint8_t mChildMask[8]; ///< A bit-vector to indicate which sleepy children need to receive this.
-    uint8_t mTimeout;      ///< Seconds remaining before dropping the message.
-    int8_t  mInterfaceId;  ///< The interface ID.
+    uint16_t mChildPendingCount; ///< Number of sleepy children this message is queued for.
+    uint16_t mIndirectEntry;     ///< The first indirect queue entry of this message (valid while child pending).
+    uint8_t  mTimeout;           ///< Seconds remaining before dropping the message.
+    int8_t   mInterfaceId;       ///< The interface ID.
     union
     {
         uint16_t mPanId;   ///< Used for MLE Discover Request and Response messages.
@@ -240,6 +242,60 @@ public:
         kNumPriorities = 4, ///< Number of priority levels.
     };
 
+    enum
+    {
+        kInvalidIndirectEntry = 0xffff, ///< Indicates no indirect queue entry.
+    };
+
+    /**
+     * This class represents a contiguous span of message content within a single message buffer.
+     *
+     */
+    class Chunk
+    {
+        friend class Message;
+
+    public:
+        /**
+         * This method returns a pointer to the first byte of the chunk.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        const uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the number of bytes in the chunk.
+         *
+         * A zero length indicates that there are no more chunks.
+         *
+         * @returns The chunk length.
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+    protected:
+        const uint8_t *mData;
+        uint16_t       mLength;
+        const Buffer * mBuffer;
+    };
+
+    /**
+     * This class represents a contiguous span of message content which may be modified in place.
+     *
+     */
+    class WritableChunk : public Chunk
+    {
+    public:
+        /**
+         * This method returns a pointer to the first byte of the chunk.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        uint8_t *GetData(void) const { return const_cast<uint8_t *>(mData); }
+    };
+
     /**
      * This method frees this message buffer.
      *
@@ -272,6 +328,30 @@ public:
      */
     otError SetLength(uint16_t aLength);
 
+    /**
+     * This method returns the number of message bytes that fit in the first message buffer.
+     *
+     * Setting the length of the message up to this value never allocates another message buffer.
+     *
+     * @returns The number of message bytes that fit in the first message buffer.
+     *
+     */
+    uint16_t GetHeadBufferLength(void) const
+    {
+        return GetReserved() < kHeadBufferDataSize ? kHeadBufferDataSize - GetReserved() : 0;
+    }
+
+    /**
+     * This method returns the largest length the message can be set to without reclaiming buffers.
+     *
+     * Setting the length of the message up to this value uses the buffers of the message and the free buffers of the
+     * pool not reserved for higher priority levels, so it never evicts other messages.
+     *
+     * @returns The largest length the message can be set to without reclaiming buffers.
+     *
+     */
+    uint16_t GetAvailableLength(void) const;
+
     /**
      * This method returns the number of buffers in the message.
      *
@@ -456,6 +536,57 @@ public:
      */
     int CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const;
 
+    /**
+     * This method gets the first chunk of a range of message content.
+     *
+     * A message is stored in a chain of buffers, so a range of its content is made of one or more contiguous chunks.
+     * Together with `GetNextChunk()`, this method allows the content to be accessed in place without copying it.
+     *
+     * @param[in]     aOffset  Byte offset within the message where the range begins.
+     * @param[inout]  aLength  On entry, the length of the range. It is truncated to the end of the message, and on exit
+     *                         holds the number of bytes in the range following @p aChunk.
+     * @param[out]    aChunk   A reference to a chunk to output the first chunk of the range.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the next chunk of a range of message content.
+     *
+     * @param[inout]  aLength  On entry, the number of bytes remaining in the range. On exit, the number of bytes in the
+     *                         range following @p aChunk.
+     * @param[inout]  aChunk   On entry, the current chunk. On exit, the next chunk (zero length if none).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the first writable chunk of a range of message content.
+     *
+     * @param[in]     aOffset  Byte offset within the message where the range begins.
+     * @param[inout]  aLength  On entry, the length of the range. It is truncated to the end of the message, and on exit
+     *                         holds the number of bytes in the range following @p aChunk.
+     * @param[out]    aChunk   A reference to a chunk to output the first chunk of the range.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
+    {
+        static_cast<const Message *>(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+    }
+
+    /**
+     * This method gets the next writable chunk of a range of message content.
+     *
+     * @param[inout]  aLength  On entry, the number of bytes remaining in the range. On exit, the number of bytes in the
+     *                         range following @p aChunk.
+     * @param[inout]  aChunk   On entry, the current chunk. On exit, the next chunk (zero length if none).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
+    {
+        static_cast<const Message *>(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
+    }
+
     /**
      * This method creates a copy of the message.
      *
@@ -499,40 +630,49 @@ public:
     void SetDatagramTag(uint16_t aTag) { mBuffer.mHead.mInfo.mDatagramTag = aTag; }
 
     /**
-     * This method returns whether or not the message forwarding is scheduled for the child.
+     * This method increments the number of children for which the message forwarding is scheduled.
      *
-     * @param[in]  aChildIndex  The index into the child table.
+     * @note Only `IndirectQueue` should use this method, the per-child scheduling is tracked there.
      *
-     * @retval TRUE   If the message is scheduled to be forwarded to the child.
-     * @retval FALSE  If the message is not scheduled to be forwarded to the child.
+     */
+    void IncrementChildPendingCount(void) { mBuffer.mHead.mInfo.mChildPendingCount++; }
+
+    /**
+     * This method decrements the number of children for which the message forwarding is scheduled.
+     *
+     * @note Only `IndirectQueue` should use this method, the per-child scheduling is tracked there.
      *
      */
-    bool GetChildMask(uint8_t aChildIndex) const;
+    void DecrementChildPendingCount(void);
 
     /**
-     * This method unschedules forwarding of the message to the child.
+     * This method returns whether or not the message forwarding is scheduled for at least one child.
      *
-     * @param[in]  aChildIndex  The index into the child table.
+     * @retval TRUE   If message forwarding is scheduled for at least one child.
+     * @retval FALSE  If message forwarding is not scheduled for any child.
      *
      */
-    void ClearChildMask(uint8_t aChildIndex);
+    bool IsChildPending(void) const { return mBuffer.mHead.mInfo.mChildPendingCount != 0; }
 
     /**
-     * This method schedules forwarding of the message to the child.
+     * This method returns the index of the first indirect queue entry of the message.
+     *
+     * @note Only `IndirectQueue` should use this method, the value is only valid while `IsChildPending()`.
      *
-     * @param[in]  aChildIndex  The index into the child table.
+     * @returns The index of the first indirect queue entry of the message.
      *
      */
-    void SetChildMask(uint8_t aChildIndex);
+    uint16_t GetIndirectEntry(void) const { return mBuffer.mHead.mInfo.mIndirectEntry; }
 
     /**
-     * This method returns whether or not the message forwarding is scheduled for at least one child.
+     * This method sets the index of the first indirect queue entry of the message.
      *
-     * @retval TRUE   If message forwarding is scheduled for at least one child.
-     * @retval FALSE  If message forwarding is not scheduled for any child.
+     * @note Only `IndirectQueue` should use this method.
+     *
+     * @param[in]  aEntry  The index of the first indirect queue entry, or `kInvalidIndirectEntry`.
      *
      */
-    bool IsChildPending(void) const;
+    void SetIndirectEntry(uint16_t aEntry) { mBuffer.mHead.mInfo.mIndirectEntry = aEntry; }
 
     /**
      * This method returns the IEEE 802.15.4 Destination PAN ID.
@@ -828,6 +968,19 @@ private:
      */
     void SetMessagePool(MessagePool *aMessagePool) { mBuffer.mHead.mInfo.mMessagePool = aMessagePool; }
 
+    /**
+     * This static method updates a checksum with a buffer which starts at a given position within the checksummed data.
+     *
+     * @param[in]  aChecksum  The checksum value to update.
+     * @param[in]  aBuf       A pointer to a buffer.
+     * @param[in]  aLength    The number of bytes in @p aBuf.
+     * @param[in]  aPosition  The position of the first byte of @p aBuf within the checksummed data.
+     *
+     * @returns The updated checksum.
+     *
+     */
+    static uint16_t UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength, uint16_t aPosition);
+
     /**
      * This method returns `true` if the message is enqueued in any queue (`MessageQueue` or `PriorityQueue`).
      *
@@ -1336,16 +1489,50 @@ public:
      */
     uint16_t GetFreeBufferCount(void) const;
 
+    /**
+     * This method returns the number of buffers the pool can provide, in use and free.
+     *
+     * @returns The total number of buffers.
+     *
+     */
+    uint16_t GetTotalBufferCount(void) const { return mNumUsedBuffers + GetFreeBufferCount(); }
+
+    /**
+     * This method retrieves the message buffer pool statistics.
+     *
+     * @param[out]  aStats  A reference to where the statistics are written.
+     *
+     */
+    void GetStats(otMessagePoolStats &aStats) const;
+
+    /**
+     * This method resets the message buffer pool statistics.
+     *
+     * The allocation failure counters are cleared and the high-water mark is set to the number of buffers in use.
+     *
+     */
+    void ResetStats(void);
+
 private:
     enum
     {
         kDefaultMessagePriority = Message::kPriorityNormal,
+        kNumReservedBuffers = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET +
+                              OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH +
+                              OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL,
     };
 
-    Buffer *       NewBuffer(uint8_t aPriority);
-    void           FreeBuffers(Buffer *aBuffer);
-    otError        ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
-    PriorityQueue *GetAllMessagesQueue(void) { return &mAllQueue; }
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT == 0
+    // The size of a platform managed pool is only known at run time, see the constructor.
+    OT_STATIC_ASSERT(kNumReservedBuffers < OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+                     "Reserved message buffers exceed the number of message buffers");
+#endif
+
+    Buffer *        NewBuffer(uint8_t aPriority);
+    void            FreeBuffers(Buffer *aBuffer);
+    otError         ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
+    static uint16_t GetReservedBufferCount(uint8_t aPriority);
+    PriorityQueue * GetAllMessagesQueue(void) { return &mAllQueue; }
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT == 0
     uint16_t mNumFreeBuffers;
@@ -1353,6 +1540,11 @@ private:
     Buffer * mFreeBuffers;
 #endif
 
+    uint16_t mNumUsedBuffers;
+    uint16_t mMaxUsedBuffers;
+    uint32_t mAllocFailures;
+    uint32_t mReservedAllocFailures;
+
     PriorityQueue mAllQueue;
 };
 
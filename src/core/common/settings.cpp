@@ -101,6 +101,18 @@ void Settings::Wipe(void)
     otLogInfoCore("Non-volatile: Wiped all info");
 }
 
+void Settings::BeginChange(void)
+{
+    IgnoreReturnValue(otPlatSettingsBeginChange(&GetInstance()));
+}
+
+void Settings::CommitChange(void)
+{
+    otError error = otPlatSettingsCommitChange(&GetInstance());
+
+    LogFailure(error, "committing changes", false);
+}
+
 otError Settings::SaveOperationalDataset(bool aIsActive, const MeshCoP::Dataset &aDataset)
 {
     otError error = Save(aIsActive ? kKeyActiveDataset : kKeyPendingDataset, aDataset.GetBytes(), aDataset.GetSize());
@@ -332,3 +344,17 @@ otError Settings::Delete(Key aKey)
 }
 
 } // namespace ot
+
+OT_TOOL_WEAK otError otPlatSettingsBeginChange(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_ERROR_NONE;
+}
+
+OT_TOOL_WEAK otError otPlatSettingsCommitChange(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_ERROR_NONE;
+}
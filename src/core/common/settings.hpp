@@ -188,6 +188,18 @@ public:
      */
     void Wipe(void);
 
+    /**
+     * This method starts a group of changes to the non-volatile store, committed by `CommitChange()`.
+     *
+     */
+    void BeginChange(void);
+
+    /**
+     * This method commits a group of changes started by `BeginChange()`.
+     *
+     */
+    void CommitChange(void);
+
     /**
      * This method saves the Operational Dataset (active or pending).
      *
@@ -82,6 +82,164 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+
+void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mNext  = NULL;
+    aTimer.mPrev  = NULL;
+    aTimer.mChild = NULL;
+
+    if (mHead == NULL)
+    {
+        mHead = &aTimer;
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        Timer *head = Meld(*mHead, aTimer, aAlarmApi.AlarmGetNow());
+
+        if (head != mHead)
+        {
+            mHead = head;
+            SetAlarm(aAlarmApi);
+        }
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    uint32_t now;
+    Timer *  subHeap;
+
+    VerifyOrExit(aTimer.mNext != &aTimer);
+
+    now     = aAlarmApi.AlarmGetNow();
+    subHeap = MergePairs(aTimer.mChild, now);
+
+    if (mHead == &aTimer)
+    {
+        mHead = subHeap;
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        // Unlink the timer from its parent (if first child) or from its previous sibling.
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != NULL)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        if (subHeap != NULL)
+        {
+            Timer *head = Meld(*mHead, *subHeap, now);
+
+            if (head != mHead)
+            {
+                mHead = head;
+                SetAlarm(aAlarmApi);
+            }
+        }
+    }
+
+    aTimer.mNext  = &aTimer;
+    aTimer.mPrev  = NULL;
+    aTimer.mChild = NULL;
+
+exit:
+    return;
+}
+
+Timer *TimerScheduler::Meld(Timer &aFirst, Timer &aSecond, uint32_t aNow)
+{
+    // Both timers must be heap roots. On equal fire times `aFirst` stays the root.
+
+    Timer *parent = &aFirst;
+    Timer *child  = &aSecond;
+
+    if (aSecond.DoesFireBefore(aFirst, aNow))
+    {
+        parent = &aSecond;
+        child  = &aFirst;
+    }
+
+    child->mPrev = parent;
+    child->mNext = parent->mChild;
+
+    if (parent->mChild != NULL)
+    {
+        parent->mChild->mPrev = child;
+    }
+
+    parent->mChild = child;
+    parent->mNext  = NULL;
+    parent->mPrev  = NULL;
+
+    return parent;
+}
+
+Timer *TimerScheduler::MergePairs(Timer *aFirst, uint32_t aNow)
+{
+    Timer *pairs = NULL;
+    Timer *heap  = NULL;
+
+    // First pass: meld the siblings in pairs from left to right, collecting the resulting heaps in a list (linked
+    // through `mNext`, most recent first).
+
+    while (aFirst != NULL)
+    {
+        Timer *first  = aFirst;
+        Timer *second = first->mNext;
+        Timer *pair   = first;
+
+        first->mNext = NULL;
+        first->mPrev = NULL;
+
+        if (second != NULL)
+        {
+            aFirst = second->mNext;
+
+            second->mNext = NULL;
+            second->mPrev = NULL;
+            pair          = Meld(*first, *second, aNow);
+        }
+        else
+        {
+            aFirst = NULL;
+        }
+
+        pair->mNext = pairs;
+        pairs       = pair;
+    }
+
+    // Second pass: meld the pairs from right to left into a single heap.
+
+    while (pairs != NULL)
+    {
+        Timer *pair = pairs;
+
+        pairs       = pair->mNext;
+        pair->mNext = NULL;
+        heap        = (heap == NULL) ? pair : Meld(*heap, *pair, aNow);
+    }
+
+    return heap;
+}
+
+#else // OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Remove(aTimer, aAlarmApi);
@@ -154,6 +312,8 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
     if (mHead == NULL)
@@ -96,6 +96,10 @@ public:
         , mHandler(aHandler)
         , mFireTime(0)
         , mNext(this)
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+        , mPrev(NULL)
+        , mChild(NULL)
+#endif
     {
     }
 
@@ -134,6 +138,10 @@ protected:
     Handler  mHandler;
     uint32_t mFireTime;
     Timer *  mNext;
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+    Timer *mPrev;  // Parent if this is the first child, otherwise previous sibling (NULL for the heap root).
+    Timer *mChild; // First child in the pairing heap.
+#endif
 };
 
 /**
@@ -367,6 +375,12 @@ protected:
     void SetAlarm(const AlarmApi &aAlarmApi);
 
     Timer *mHead;
+
+#if OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+private:
+    static Timer *Meld(Timer &aFirst, Timer &aSecond, uint32_t aNow);
+    static Timer *MergePairs(Timer *aFirst, uint32_t aNow);
+#endif
 };
 
 /**
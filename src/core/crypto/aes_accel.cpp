@@ -0,0 +1,314 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements AES computations using the AES instructions of the host CPU.
+ */
+
+#include "aes_accel.hpp"
+
+#include <openthread/platform/toolchain.h>
+
+#include "common/debug.hpp"
+
+#if OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION && (defined(__GNUC__) || defined(__clang__)) && \
+    defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#if defined(__x86_64__)
+#define AES_ACCEL_X86_64 1
+#elif defined(__aarch64__)
+#define AES_ACCEL_AARCH64 1
+#endif
+#endif
+
+#if AES_ACCEL_X86_64
+#include <cpuid.h>
+#include <wmmintrin.h>
+
+#define AES_ACCEL_TARGET __attribute__((target("aes,sse2")))
+#elif AES_ACCEL_AARCH64
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+#if defined(__clang__)
+#define AES_ACCEL_TARGET __attribute__((target("aes")))
+#else
+#define AES_ACCEL_TARGET __attribute__((target("+crypto")))
+#endif
+#endif
+
+namespace ot {
+namespace Crypto {
+
+bool AesAccel::sEnabled = true;
+
+#if AES_ACCEL_X86_64 || AES_ACCEL_AARCH64
+
+enum
+{
+    kNumRoundKeys = 11, ///< Number of AES-128 round keys.
+};
+
+#if AES_ACCEL_X86_64
+
+typedef __m128i Block;
+
+AES_ACCEL_TARGET static inline Block LoadBlock(const uint8_t *aBytes)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes));
+}
+
+AES_ACCEL_TARGET static inline void StoreBlock(uint8_t *aBytes, Block aBlock)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes), aBlock);
+}
+
+AES_ACCEL_TARGET static inline Block XorBlocks(Block aBlock0, Block aBlock1)
+{
+    return _mm_xor_si128(aBlock0, aBlock1);
+}
+
+AES_ACCEL_TARGET static inline Block EncryptBlock(const Block *aKeys, Block aBlock)
+{
+    aBlock = _mm_xor_si128(aBlock, aKeys[0]);
+
+    for (int i = 1; i < kNumRoundKeys - 1; i++)
+    {
+        aBlock = _mm_aesenc_si128(aBlock, aKeys[i]);
+    }
+
+    return _mm_aesenclast_si128(aBlock, aKeys[kNumRoundKeys - 1]);
+}
+
+AES_ACCEL_TARGET static inline void EncryptBlocks(const Block *aKeys, Block &aBlock0, Block &aBlock1)
+{
+    aBlock0 = _mm_xor_si128(aBlock0, aKeys[0]);
+    aBlock1 = _mm_xor_si128(aBlock1, aKeys[0]);
+
+    for (int i = 1; i < kNumRoundKeys - 1; i++)
+    {
+        aBlock0 = _mm_aesenc_si128(aBlock0, aKeys[i]);
+        aBlock1 = _mm_aesenc_si128(aBlock1, aKeys[i]);
+    }
+
+    aBlock0 = _mm_aesenclast_si128(aBlock0, aKeys[kNumRoundKeys - 1]);
+    aBlock1 = _mm_aesenclast_si128(aBlock1, aKeys[kNumRoundKeys - 1]);
+}
+
+#elif AES_ACCEL_AARCH64
+
+typedef uint8x16_t Block;
+
+AES_ACCEL_TARGET static inline Block LoadBlock(const uint8_t *aBytes)
+{
+    return vld1q_u8(aBytes);
+}
+
+AES_ACCEL_TARGET static inline void StoreBlock(uint8_t *aBytes, Block aBlock)
+{
+    vst1q_u8(aBytes, aBlock);
+}
+
+AES_ACCEL_TARGET static inline Block XorBlocks(Block aBlock0, Block aBlock1)
+{
+    return veorq_u8(aBlock0, aBlock1);
+}
+
+AES_ACCEL_TARGET static inline Block EncryptBlock(const Block *aKeys, Block aBlock)
+{
+    // AESE adds the round key before the substitution, the last round key is added on its own
+    for (int i = 0; i < kNumRoundKeys - 2; i++)
+    {
+        aBlock = vaesmcq_u8(vaeseq_u8(aBlock, aKeys[i]));
+    }
+
+    return veorq_u8(vaeseq_u8(aBlock, aKeys[kNumRoundKeys - 2]), aKeys[kNumRoundKeys - 1]);
+}
+
+AES_ACCEL_TARGET static inline void EncryptBlocks(const Block *aKeys, Block &aBlock0, Block &aBlock1)
+{
+    for (int i = 0; i < kNumRoundKeys - 2; i++)
+    {
+        aBlock0 = vaesmcq_u8(vaeseq_u8(aBlock0, aKeys[i]));
+        aBlock1 = vaesmcq_u8(vaeseq_u8(aBlock1, aKeys[i]));
+    }
+
+    aBlock0 = veorq_u8(vaeseq_u8(aBlock0, aKeys[kNumRoundKeys - 2]), aKeys[kNumRoundKeys - 1]);
+    aBlock1 = veorq_u8(vaeseq_u8(aBlock1, aKeys[kNumRoundKeys - 2]), aKeys[kNumRoundKeys - 1]);
+}
+
+#endif // AES_ACCEL_AARCH64
+
+static int8_t sInstructions = -1; // -1 until the instructions are detected
+
+AES_ACCEL_TARGET static inline void LoadRoundKeys(const uint8_t *aRoundKeys, Block *aKeys)
+{
+    for (int i = 0; i < kNumRoundKeys; i++)
+    {
+        aKeys[i] = LoadBlock(aRoundKeys + i * AesAccel::kBlockSize);
+    }
+}
+
+static inline void IncrementCounter(uint8_t *aCtr, uint8_t aNonceLength)
+{
+    for (int i = AesAccel::kBlockSize - 1; i > aNonceLength; i--)
+    {
+        if (++aCtr[i])
+        {
+            break;
+        }
+    }
+}
+
+bool AesAccel::DetectInstructions(void)
+{
+#if AES_ACCEL_X86_64
+    unsigned int eax, ebx, ecx, edx;
+
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES) != 0;
+#elif defined(__APPLE__)
+    return true;
+#elif defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#else
+    return false;
+#endif
+}
+
+bool AesAccel::IsAvailable(void)
+{
+    if (sInstructions < 0)
+    {
+        sInstructions = DetectInstructions() ? 1 : 0;
+    }
+
+    return sEnabled && sInstructions;
+}
+
+AES_ACCEL_TARGET void AesAccel::Encrypt(const uint8_t *aRoundKeys,
+                                        const uint8_t  aInput[kBlockSize],
+                                        uint8_t        aOutput[kBlockSize])
+{
+    Block keys[kNumRoundKeys];
+
+    LoadRoundKeys(aRoundKeys, keys);
+    StoreBlock(aOutput, EncryptBlock(keys, LoadBlock(aInput)));
+}
+
+AES_ACCEL_TARGET void AesAccel::ProcessCcmBlocks(const uint8_t *aRoundKeys,
+                                                 uint8_t *      aMac,
+                                                 bool           aMacPending,
+                                                 uint8_t *      aCtr,
+                                                 uint8_t        aNonceLength,
+                                                 const uint8_t *aInput,
+                                                 uint8_t *      aOutput,
+                                                 uint32_t       aNumBlocks,
+                                                 bool           aEncrypt)
+{
+    Block keys[kNumRoundKeys];
+    Block mac = LoadBlock(aMac);
+
+    LoadRoundKeys(aRoundKeys, keys);
+
+    for (uint32_t i = 0; i < aNumBlocks; i++)
+    {
+        Block input = LoadBlock(aInput);
+        Block pad;
+        Block output;
+
+        IncrementCounter(aCtr, aNonceLength);
+        pad = LoadBlock(aCtr);
+
+        if (aMacPending)
+        {
+            // the CBC-MAC of the previous block and the key stream of this block are independent
+            EncryptBlocks(keys, mac, pad);
+        }
+        else
+        {
+            pad         = EncryptBlock(keys, pad);
+            aMacPending = true;
+        }
+
+        output = XorBlocks(input, pad);
+        StoreBlock(aOutput, output);
+        mac = XorBlocks(mac, aEncrypt ? input : output);
+
+        aInput += kBlockSize;
+        aOutput += kBlockSize;
+    }
+
+    StoreBlock(aMac, mac);
+}
+
+#else // AES_ACCEL_X86_64 || AES_ACCEL_AARCH64
+
+bool AesAccel::IsAvailable(void)
+{
+    return false;
+}
+
+void AesAccel::Encrypt(const uint8_t *aRoundKeys, const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
+{
+    OT_UNUSED_VARIABLE(aRoundKeys);
+    OT_UNUSED_VARIABLE(aInput);
+    OT_UNUSED_VARIABLE(aOutput);
+
+    assert(false);
+}
+
+void AesAccel::ProcessCcmBlocks(const uint8_t *aRoundKeys,
+                                uint8_t *      aMac,
+                                bool           aMacPending,
+                                uint8_t *      aCtr,
+                                uint8_t        aNonceLength,
+                                const uint8_t *aInput,
+                                uint8_t *      aOutput,
+                                uint32_t       aNumBlocks,
+                                bool           aEncrypt)
+{
+    OT_UNUSED_VARIABLE(aRoundKeys);
+    OT_UNUSED_VARIABLE(aMac);
+    OT_UNUSED_VARIABLE(aMacPending);
+    OT_UNUSED_VARIABLE(aCtr);
+    OT_UNUSED_VARIABLE(aNonceLength);
+    OT_UNUSED_VARIABLE(aInput);
+    OT_UNUSED_VARIABLE(aOutput);
+    OT_UNUSED_VARIABLE(aNumBlocks);
+    OT_UNUSED_VARIABLE(aEncrypt);
+
+    assert(false);
+}
+
+#endif // AES_ACCEL_X86_64 || AES_ACCEL_AARCH64
+
+} // namespace Crypto
+} // namespace ot
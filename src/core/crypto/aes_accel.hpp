@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for AES computations using the AES instructions of the host CPU.
+ */
+
+#ifndef AES_ACCEL_HPP_
+#define AES_ACCEL_HPP_
+
+#include "openthread-core-config.h"
+
+#include "utils/wrap_stdint.h"
+
+namespace ot {
+namespace Crypto {
+
+/**
+ * @addtogroup core-security
+ *
+ * @{
+ *
+ */
+
+/**
+ * This class implements AES-128 encryption with the AES instructions of the host CPU: AES-NI on x86-64 and the ARMv8
+ * Cryptography Extensions on AArch64.
+ *
+ * The instructions are detected at runtime. `IsAvailable()` returns FALSE when they are missing, on any other
+ * architecture, or when `OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION` is disabled, in which case AES is computed by
+ * mbedTLS.
+ *
+ * The round keys are the 11 round keys of an AES-128 key as returned by `AesEcb::GetRoundKeys()`.
+ *
+ */
+class AesAccel
+{
+public:
+    enum
+    {
+        kBlockSize = 16, ///< AES block size (bytes).
+    };
+
+    /**
+     * This static method indicates whether the AES instructions are available and enabled.
+     *
+     * @retval TRUE   The AES instructions are available and enabled.
+     * @retval FALSE  The AES instructions are not available or disabled.
+     *
+     */
+    static bool IsAvailable(void);
+
+    /**
+     * This static method enables or disables the use of the AES instructions, e.g. to compare with mbedTLS.
+     *
+     * @param[in]  aEnabled  TRUE to use the AES instructions when available, FALSE to use mbedTLS.
+     *
+     */
+    static void SetEnabled(bool aEnabled) { sEnabled = aEnabled; }
+
+    /**
+     * This static method encrypts a block.
+     *
+     * This method must only be called when `IsAvailable()` returns TRUE.
+     *
+     * @param[in]   aRoundKeys  A pointer to the round keys.
+     * @param[in]   aInput      A pointer to the input block.
+     * @param[out]  aOutput     A pointer to the output block.
+     *
+     */
+    static void Encrypt(const uint8_t *aRoundKeys, const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
+
+    /**
+     * This static method encrypts or decrypts complete blocks of an AES-CCM payload and adds them to the CBC-MAC.
+     *
+     * The CTR encryption of each block is interleaved with the CBC-MAC encryption of the previous block.
+     *
+     * On input, @p aMac holds the CBC-MAC state, which still needs to be encrypted if @p aMacPending is TRUE. On
+     * return, @p aMac holds the CBC-MAC state with the last plaintext block added, not yet encrypted.
+     *
+     * This method must only be called when `IsAvailable()` returns TRUE.
+     *
+     * @param[in]     aRoundKeys    A pointer to the round keys.
+     * @param[inout]  aMac          A pointer to the CBC-MAC block.
+     * @param[in]     aMacPending   TRUE if @p aMac needs to be encrypted before adding the first block.
+     * @param[inout]  aCtr          A pointer to the counter block, incremented before each block.
+     * @param[in]     aNonceLength  Length of the nonce in the counter block in bytes.
+     * @param[in]     aInput        A pointer to the plaintext on encrypt, or the ciphertext on decrypt.
+     * @param[out]    aOutput       A pointer to the ciphertext on encrypt, or the plaintext on decrypt.
+     * @param[in]     aNumBlocks    The number of blocks.
+     * @param[in]     aEncrypt      TRUE on encrypt and FALSE on decrypt.
+     *
+     */
+    static void ProcessCcmBlocks(const uint8_t *aRoundKeys,
+                                 uint8_t *      aMac,
+                                 bool           aMacPending,
+                                 uint8_t *      aCtr,
+                                 uint8_t        aNonceLength,
+                                 const uint8_t *aInput,
+                                 uint8_t *      aOutput,
+                                 uint32_t       aNumBlocks,
+                                 bool           aEncrypt);
+
+private:
+    static bool DetectInstructions(void);
+
+    static bool sEnabled;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace Crypto
+} // namespace ot
+
+#endif // AES_ACCEL_HPP_
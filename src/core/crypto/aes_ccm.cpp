@@ -35,13 +35,20 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "crypto/aes_accel.hpp"
 
 namespace ot {
 namespace Crypto {
 
+AesCcm::AesCcm(void)
+    : mKeySchedule(&mEcb)
+{
+}
+
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, 8 * aKeyLength);
+    mKeySchedule = &mEcb;
 }
 
 otError AesCcm::Init(uint32_t    aHeaderLength,
@@ -120,7 +127,7 @@ otError AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeySchedule->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -179,7 +186,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -193,7 +200,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -208,6 +215,34 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
 
     assert(mPlainTextCur + aLength <= mPlainTextLength);
 
+#if OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION
+    // process complete blocks at once when the key stream and the CBC-MAC block are at a block boundary
+    if (aLength >= AesEcb::kBlockSize && mCtrLength == sizeof(mCtrPad) &&
+        (mBlockLength == 0 || mBlockLength == sizeof(mBlock)) && mKeySchedule->GetRoundKeys() != NULL &&
+        AesAccel::IsAvailable())
+    {
+        uint32_t numBlocks = aLength / AesEcb::kBlockSize;
+        uint32_t length    = numBlocks * AesEcb::kBlockSize;
+
+        if (aEncrypt)
+        {
+            AesAccel::ProcessCcmBlocks(mKeySchedule->GetRoundKeys(), mBlock, mBlockLength != 0, mCtr, mNonceLength,
+                                       plaintextBytes, ciphertextBytes, numBlocks, true);
+        }
+        else
+        {
+            AesAccel::ProcessCcmBlocks(mKeySchedule->GetRoundKeys(), mBlock, mBlockLength != 0, mCtr, mNonceLength,
+                                       ciphertextBytes, plaintextBytes, numBlocks, false);
+        }
+
+        plaintextBytes += length;
+        ciphertextBytes += length;
+        aLength -= length;
+        mPlainTextCur += length;
+        mBlockLength = sizeof(mBlock);
+    }
+#endif
+
     for (unsigned i = 0; i < aLength; i++)
     {
         if (mCtrLength == 16)
@@ -220,7 +255,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeySchedule->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -237,7 +272,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -250,7 +285,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -269,7 +304,7 @@ void AesCcm::Finalize(void *aTag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        mKeySchedule->Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
@@ -59,6 +59,12 @@ namespace Crypto {
 class AesCcm
 {
 public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void);
+
     /**
      * This method sets the key.
      *
@@ -68,6 +74,16 @@ public:
      */
     void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method sets the key from an already expanded AES key schedule.
+     *
+     * The key schedule is used in place, it must remain unchanged until the computation is finalized.
+     *
+     * @param[in]  aKeySchedule  A reference to an `AesEcb` holding the key schedule.
+     *
+     */
+    void SetKey(AesEcb &aKeySchedule) { mKeySchedule = &aKeySchedule; }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -123,6 +139,7 @@ private:
     };
 
     AesEcb   mEcb;
+    AesEcb * mKeySchedule; // `mEcb` or an external key schedule
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
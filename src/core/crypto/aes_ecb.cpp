@@ -33,6 +33,8 @@
 
 #include "aes_ecb.hpp"
 
+#include "crypto/aes_accel.hpp"
+
 namespace ot {
 namespace Crypto {
 
@@ -48,7 +50,28 @@ void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 
 void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+#if OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION
+    const uint8_t *roundKeys = GetRoundKeys();
+
+    if (roundKeys != NULL && AesAccel::IsAvailable())
+    {
+        AesAccel::Encrypt(roundKeys, aInput, aOutput);
+    }
+    else
+#endif
+    {
+        mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    }
+}
+
+const uint8_t *AesEcb::GetRoundKeys(void) const
+{
+#if defined(MBEDTLS_AES_ALT)
+    return NULL;
+#else
+    // mbedTLS keeps the round keys as little-endian 32-bit words, i.e. in FIPS-197 byte order on little-endian hosts
+    return (mContext.nr == 10) ? reinterpret_cast<const uint8_t *>(mContext.rk) : NULL;
+#endif
 }
 
 AesEcb::~AesEcb()
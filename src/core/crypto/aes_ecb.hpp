@@ -90,6 +90,16 @@ public:
      */
     void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
 
+    /**
+     * This method returns the expanded round keys of an AES-128 key.
+     *
+     * The round keys are stored as little-endian 32-bit words.
+     *
+     * @returns A pointer to the 11 round keys of `kBlockSize` bytes, or NULL if no AES-128 key is set.
+     *
+     */
+    const uint8_t *GetRoundKeys(void) const;
+
 private:
     mbedtls_aes_context mContext;
 };
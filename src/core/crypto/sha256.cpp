@@ -61,5 +61,10 @@ void Sha256::Finish(uint8_t aHash[kHashSize])
     mbedtls_sha256_finish_ret(&mContext, aHash);
 }
 
+void Sha256::Clone(const Sha256 &aOther)
+{
+    mbedtls_sha256_clone(&mContext, &aOther.mContext);
+}
+
 } // namespace Crypto
 } // namespace ot
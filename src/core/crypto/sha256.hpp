@@ -97,6 +97,14 @@ public:
      */
     void Finish(uint8_t aHash[kHashSize]);
 
+    /**
+     * This method copies the state of another SHA-256 computation, e.g. to resume from a precomputed state.
+     *
+     * @param[in]  aOther  A reference to the SHA-256 computation to copy.
+     *
+     */
+    void Clone(const Sha256 &aOther);
+
 private:
     mbedtls_sha256_context mContext;
 };
@@ -809,27 +809,33 @@ exit:
 
 void Mac::ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress)
 {
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[kNonceSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
-    otError        error;
+
+    aesCcm.SetKey(aFrame.GetAesKey(), 16);
+    ProcessTransmitAesCcm(aFrame, aExtAddress, aesCcm);
+}
+
+void Mac::ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[kNonceSize];
+    uint8_t  tagLength;
+    otError  error;
 
     aFrame.GetSecurityLevel(securityLevel);
     aFrame.GetFrameCounter(frameCounter);
 
     GenerateNonce(*aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aFrame.GetAesKey(), 16);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    error = aAesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     assert(error == OT_ERROR_NONE);
 
-    aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
-    aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), true);
-    aesCcm.Finalize(aFrame.GetFooter(), &tagLength);
+    aAesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
+    aAesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), true);
+    aAesCcm.Finalize(aFrame.GetFooter(), &tagLength);
 }
 
 void Mac::ProcessTransmitSecurity(Frame &aFrame, bool aProcessAesCcm)
@@ -897,7 +903,19 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame, bool aProcessAesCcm)
 
     if (aProcessAesCcm)
     {
-        ProcessTransmitAesCcm(aFrame, extAddress);
+        Crypto::AesCcm aesCcm;
+
+        if (keyIdMode == Frame::kKeyIdMode1)
+        {
+            // In main context, the cached key schedule of the current MAC key can be used.
+            aesCcm.SetKey(keyManager.GetMacKeySchedule(keyManager.GetCurrentKeySequence()));
+        }
+        else
+        {
+            aesCcm.SetKey(aFrame.GetAesKey(), 16);
+        }
+
+        ProcessTransmitAesCcm(aFrame, extAddress, aesCcm);
     }
 
 exit:
@@ -1256,7 +1274,6 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
     uint8_t           tagLength;
     uint8_t           keyid;
     uint32_t          keySequence = 0;
-    const uint8_t *   macKey;
     const ExtAddress *extAddress;
     Crypto::AesCcm    aesCcm;
 
@@ -1274,7 +1291,8 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
     switch (keyIdMode)
     {
     case Frame::kKeyIdMode0:
-        VerifyOrExit((macKey = keyManager.GetKek()) != NULL, error = OT_ERROR_SECURITY);
+        VerifyOrExit(keyManager.GetKek() != NULL, error = OT_ERROR_SECURITY);
+        aesCcm.SetKey(keyManager.GetKek(), 16);
         extAddress = &aSrcAddr.GetExtended();
         break;
 
@@ -1288,25 +1306,24 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
         {
             // same key index
             keySequence = keyManager.GetCurrentKeySequence();
-            macKey      = keyManager.GetCurrentMacKey();
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
         {
             // previous key index
             keySequence = keyManager.GetCurrentKeySequence() - 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
         }
         else if (keyid == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
         {
             // next key index
             keySequence = keyManager.GetCurrentKeySequence() + 1;
-            macKey      = keyManager.GetTemporaryMacKey(keySequence);
         }
         else
         {
             ExitNow(error = OT_ERROR_SECURITY);
         }
 
+        aesCcm.SetKey(keyManager.GetMacKeySchedule(keySequence));
+
         // If the frame is from a neighbor not in valid state (e.g., it is from a child being
         // restored), skip the key sequence and frame counter checks but continue to verify
         // the tag/MIC. Such a frame is later filtered in `RxDoneTask` which only allows MAC
@@ -1337,7 +1354,7 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
         break;
 
     case Frame::kKeyIdMode2:
-        macKey     = sMode2Key;
+        aesCcm.SetKey(sMode2Key, 16);
         extAddress = static_cast<const ExtAddress *>(&sMode2ExtAddress);
         break;
 
@@ -1349,8 +1366,6 @@ otError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neig
     GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    aesCcm.SetKey(macKey, 16);
-
     error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     VerifyOrExit(error == OT_ERROR_NONE, error = OT_ERROR_SECURITY);
 
@@ -42,6 +42,7 @@
 #include "common/locator.hpp"
 #include "common/tasklet.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ccm.hpp"
 #include "mac/channel_mask.hpp"
 #include "mac/mac_filter.hpp"
 #include "mac/mac_frame.hpp"
@@ -563,6 +564,9 @@ public:
     /**
      * This method performs AES CCM on the frame which is going to be sent.
      *
+     * This method only uses the key set on @p aFrame (`Frame::GetAesKey()`), so it can be called from interrupt
+     * context.
+     *
      * @param[in]  aFrame       A reference to the MAC frame buffer that is going to be sent.
      * @param[in]  aExtAddress  A pointer to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
@@ -606,6 +610,7 @@ private:
                               uint32_t          aFrameCounter,
                               uint8_t           aSecurityLevel,
                               uint8_t *         aNonce);
+    static void ProcessTransmitAesCcm(Frame &aFrame, const ExtAddress *aExtAddress, Crypto::AesCcm &aAesCcm);
 
     otError ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor);
     void    UpdateIdleMode(void);
@@ -319,6 +319,21 @@
 #define OPENTHREAD_CONFIG_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+ *
+ * The number of (child, message) entries shared by the per-child indirect transmission queues.
+ *
+ * One entry is used for each sleepy child a queued message is pending for (e.g., a multicast message sent to ten
+ * sleepy children uses ten entries, but a single message buffer). One more entry per message buffer and one more per
+ * child are reserved on top of this number, so a unicast message and a child with no queued message can always be
+ * queued. The shared entries are only needed by multicast messages sent to several sleepy children.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES
+#define OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES (4 * OPENTHREAD_CONFIG_MAX_CHILDREN)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_CHILD_TIMEOUT
  *
@@ -513,6 +528,65 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+ *
+ * Maximum number of pending CoAP requests that are indexed by Message ID and Token.
+ *
+ * Requests beyond this number are still handled, but responses to them are matched by a linear scan of the pending
+ * requests.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
+ *
+ * Number of hash buckets used to dispatch received CoAP requests to resources by Uri-Path.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+ *
+ * Define as 1 to enable CoAP block-wise transfer (RFC 7959) with streaming Block1/Block2 handlers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_MAX_BLOCK1_TRANSFERS
+ *
+ * Maximum number of Block1 transfers received at the same time by the block-wise resources of a CoAP server.
+ *
+ * When all are in use, a new transfer replaces the one that was idle the longest.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_MAX_BLOCK1_TRANSFERS
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_MAX_BLOCK1_TRANSFERS 2
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE
+ *
+ * Number of bytes of an IEEE 802.15.4 frame assumed to be left for the CoAP header, options and payload.
+ *
+ * The default leaves room for the MAC header with short addresses and key id mode 1 security, the MIC, the FCS, a
+ * mesh header, and compressed IPv6 and UDP headers. Block-wise transfers use the largest block size that keeps each
+ * message within this budget.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE 88
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DNS_RESPONSE_TIMEOUT
  *
@@ -575,6 +649,39 @@
 #define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET
+ *
+ * The number of message buffers reserved for messages with network control priority (e.g., MLE).
+ *
+ * Messages with a lower priority can not allocate the reserved buffers, so they can not starve higher priority
+ * traffic of message buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+ *
+ * The number of message buffers reserved for messages with high priority or above.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL
+ *
+ * The number of message buffers reserved for messages with normal priority or above.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_FILTER_SIZE
  *
@@ -957,6 +1064,16 @@
 #define OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE 128
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+ *
+ * Define as 1 to compute the HDLC FCS eight bytes at a time, using 3.5 KB of additional lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+#define OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
  *
@@ -1006,6 +1123,38 @@
 #define OPENTHREAD_CONFIG_NCP_SPINEL_LOG_MAX_SIZE 150
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+ *
+ * Define as 1 to support coalescing unsolicited spinel `VALUE_IS` frames into `VALUES_ARE` frames once the host
+ * sets `SPINEL_PROP_UNSOL_BATCHING_ENABLED`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE
+ *
+ * The maximum size (number of bytes) of a batched spinel frame. The NCP UART reserves a buffer of this size.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE 256
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_FLUSH_DEADLINE
+ *
+ * The time (in milliseconds) an unsolicited spinel frame may be held back waiting for more frames to batch with.
+ * Zero batches only the frames that are already queued when the transport becomes ready to send.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_FLUSH_DEADLINE
+#define OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_FLUSH_DEADLINE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
  *
@@ -1074,6 +1223,60 @@
 #define OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the MAC and MLE keys for the current, previous and next key
+ * sequences, so securing or verifying a frame does not derive or expand the key again.
+ *
+ * The key schedules are refreshed when the key sequence or the master key changes. Define to 0 to save the RAM of six
+ * AES contexts, at the cost of an AES key expansion per frame and an HMAC-SHA256 per frame using the previous or next
+ * key sequence.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+#define OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE
+ *
+ * The number of keys derived from the master key (one per key sequence) that are kept, least recently used first out.
+ *
+ * Define to 0 to derive the key of a key sequence each time it is used.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE
+#define OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION
+ *
+ * Define to 1 to use the AES instructions of the host CPU (AES-NI on x86-64, the ARMv8 Cryptography Extensions on
+ * AArch64) for AES-ECB and AES-CCM, when they are detected at runtime.
+ *
+ * Without the instructions, or on other architectures, AES is computed by mbedTLS.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION
+#define OPENTHREAD_CONFIG_ENABLE_AES_ACCELERATION 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+ *
+ * Define to 1 to keep the running timers in a pairing heap instead of a sorted list.
+ *
+ * The sorted list makes starting and stopping a timer linear in the number of running timers. The pairing heap starts
+ * a timer in constant time and stops it in amortized logarithmic time, at the cost of two extra pointers per timer.
+ * Timers with the same fire time are not guaranteed to fire in the order they were started.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP
+#define OPENTHREAD_CONFIG_ENABLE_TIMER_PAIRING_HEAP 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_ENABLE_PLATFORM_EUI64_CUSTOM_SOURCE
  *
@@ -1595,6 +1798,19 @@
 #define OPENTHREAD_CONFIG_NCP_ENABLE_PEEK_POKE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+ *
+ * Define as 1 to enable per-property handler statistics on NCP.
+ *
+ * When enabled, NCP counts the calls to each property get/set/insert/remove handler and accumulates the time spent in
+ * it. The statistics are reported through `SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS`. This is intended for debugging.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+#define OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE
  *
@@ -77,20 +77,36 @@ void AddressResolver::Clear(void)
 {
     memset(&mCache, 0, sizeof(mCache));
 
-    for (uint8_t i = 0; i < kCacheEntries; i++)
+    for (uint16_t i = 0; i < kCacheIndexSize; i++)
     {
-        mCache[i].mAge = i;
+        mCacheIndex[i] = kInvalidIndex;
     }
+
+    // All entries start out on the LRU list, ordered by their index.
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        mCache[i].mLruPrev = (i == 0) ? static_cast<uint16_t>(kInvalidIndex) : i - 1;
+        mCache[i].mLruNext = (i == kCacheEntries - 1) ? static_cast<uint16_t>(kInvalidIndex) : i + 1;
+    }
+
+    mLruHead  = 0;
+    mLruTail  = kCacheEntries - 1;
+    mUseCount = 0;
 }
 
-otError AddressResolver::GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const
+otError AddressResolver::GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const
 {
-    otError error = OT_ERROR_NONE;
+    otError  error = OT_ERROR_NONE;
+    uint32_t age;
 
     VerifyOrExit(aIndex < kCacheEntries, error = OT_ERROR_INVALID_ARGS);
+
+    age = mUseCount - mCache[aIndex].mLastUse;
+
     memcpy(&aEntry.mTarget, &mCache[aIndex].mTarget, sizeof(aEntry.mTarget));
     aEntry.mRloc16 = mCache[aIndex].mRloc16;
-    aEntry.mAge    = mCache[aIndex].mAge;
+    aEntry.mAge    = (age < kMaxAge) ? static_cast<uint8_t>(age) : static_cast<uint8_t>(kMaxAge);
     aEntry.mValid  = mCache[aIndex].mState == Cache::kStateCached;
 
 exit:
@@ -119,21 +135,155 @@ void AddressResolver::Remove(uint16_t aRloc16)
     }
 }
 
-AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
+uint16_t AddressResolver::GetCacheIndexSlot(const Ip6::Address &aEid)
+{
+    uint32_t hash = aEid.mFields.m32[0] ^ aEid.mFields.m32[1] ^ aEid.mFields.m32[2] ^ aEid.mFields.m32[3];
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+
+    return static_cast<uint16_t>(hash % kCacheIndexSize);
+}
+
+AddressResolver::Cache *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
 {
     Cache *rval = NULL;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    for (uint16_t slot = GetCacheIndexSlot(aEid); mCacheIndex[slot] != kInvalidIndex;
+         slot          = (slot + 1) % kCacheIndexSize)
     {
-        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
+        if (mCache[mCacheIndex[slot]].mTarget == aEid)
+        {
+            rval = &mCache[mCacheIndex[slot]];
+            break;
+        }
+    }
+
+    return rval;
+}
+
+void AddressResolver::AddToCacheIndex(Cache &aEntry)
+{
+    uint16_t slot = GetCacheIndexSlot(aEntry.mTarget);
+
+    // The index has twice as many slots as there are cache entries,
+    // so linear probing always finds an empty slot.
+
+    while (mCacheIndex[slot] != kInvalidIndex)
+    {
+        slot = (slot + 1) % kCacheIndexSize;
+    }
+
+    mCacheIndex[slot] = GetCacheEntryIndex(aEntry);
+}
+
+void AddressResolver::RemoveFromCacheIndex(Cache &aEntry)
+{
+    uint16_t entryIndex = GetCacheEntryIndex(aEntry);
+    uint16_t slot       = GetCacheIndexSlot(aEntry.mTarget);
+    uint16_t next;
+
+    while (mCacheIndex[slot] != entryIndex)
+    {
+        VerifyOrExit(mCacheIndex[slot] != kInvalidIndex);
+        slot = (slot + 1) % kCacheIndexSize;
+    }
+
+    // Shift back any following entries in the probe sequence whose home
+    // slot does not lie between the emptied slot and their current slot,
+    // so that lookups never stop early on the emptied slot.
+
+    for (next = (slot + 1) % kCacheIndexSize; mCacheIndex[next] != kInvalidIndex; next = (next + 1) % kCacheIndexSize)
+    {
+        uint16_t home = GetCacheIndexSlot(mCache[mCacheIndex[next]].mTarget);
+
+        if ((slot <= next) ? (slot < home && home <= next) : (slot < home || home <= next))
         {
             continue;
         }
 
-        if (rval == NULL || rval->mAge < mCache[i].mAge)
+        mCacheIndex[slot] = mCacheIndex[next];
+        slot              = next;
+    }
+
+    mCacheIndex[slot] = kInvalidIndex;
+
+exit:
+    return;
+}
+
+void AddressResolver::RemoveFromLruList(Cache &aEntry)
+{
+    if (aEntry.mLruPrev == kInvalidIndex)
+    {
+        mLruHead = aEntry.mLruNext;
+    }
+    else
+    {
+        mCache[aEntry.mLruPrev].mLruNext = aEntry.mLruNext;
+    }
+
+    if (aEntry.mLruNext == kInvalidIndex)
+    {
+        mLruTail = aEntry.mLruPrev;
+    }
+    else
+    {
+        mCache[aEntry.mLruNext].mLruPrev = aEntry.mLruPrev;
+    }
+}
+
+void AddressResolver::AddToLruListHead(Cache &aEntry)
+{
+    aEntry.mLruPrev = kInvalidIndex;
+    aEntry.mLruNext = mLruHead;
+
+    if (mLruHead == kInvalidIndex)
+    {
+        mLruTail = GetCacheEntryIndex(aEntry);
+    }
+    else
+    {
+        mCache[mLruHead].mLruPrev = GetCacheEntryIndex(aEntry);
+    }
+
+    mLruHead = GetCacheEntryIndex(aEntry);
+}
+
+void AddressResolver::AddToLruListTail(Cache &aEntry)
+{
+    aEntry.mLruPrev = mLruTail;
+    aEntry.mLruNext = kInvalidIndex;
+
+    if (mLruTail == kInvalidIndex)
+    {
+        mLruHead = GetCacheEntryIndex(aEntry);
+    }
+    else
+    {
+        mCache[mLruTail].mLruNext = GetCacheEntryIndex(aEntry);
+    }
+
+    mLruTail = GetCacheEntryIndex(aEntry);
+}
+
+AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
+{
+    Cache *rval = NULL;
+
+    // Walk from the least recently used entry, skipping entries
+    // with an outstanding first Address Query.
+
+    for (uint16_t i = mLruTail; i != kInvalidIndex; i = mCache[i].mLruPrev)
+    {
+        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
         {
-            rval = &mCache[i];
+            continue;
         }
+
+        rval = &mCache[i];
+        break;
     }
 
     if (rval != NULL)
@@ -146,15 +296,15 @@ AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 
 void AddressResolver::MarkCacheEntryAsUsed(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mAge < aEntry.mAge)
-        {
-            mCache[i].mAge++;
-        }
-    }
+    aEntry.mLastUse = ++mUseCount;
+
+    VerifyOrExit(mLruHead != GetCacheEntryIndex(aEntry));
 
-    aEntry.mAge = 0;
+    RemoveFromLruList(aEntry);
+    AddToLruListHead(aEntry);
+
+exit:
+    return;
 }
 
 const char *AddressResolver::ConvertInvalidationReasonToString(InvalidationReason aReason)
@@ -187,14 +337,6 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
 {
     OT_UNUSED_VARIABLE(aReason);
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mAge > aEntry.mAge)
-        {
-            mCache[i].mAge--;
-        }
-    }
-
     switch (aEntry.mState)
     {
     case Cache::kStateCached:
@@ -212,41 +354,39 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
         break;
     }
 
-    aEntry.mAge   = kCacheEntries - 1;
+    if (aEntry.mState != Cache::kStateInvalid)
+    {
+        RemoveFromCacheIndex(aEntry);
+    }
+
+    RemoveFromLruList(aEntry);
+    AddToLruListTail(aEntry);
+
     aEntry.mState = Cache::kStateInvalid;
 }
 
 void AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState == Cache::kStateInvalid || mCache[i].mTarget != aEid)
-        {
-            continue;
-        }
+    Cache *entry = FindCacheEntry(aEid);
 
-        if (mCache[i].mRloc16 != aRloc16)
-        {
-            // not updating the age here is intentional because this cache entry is not actually being used
-            mCache[i].mRloc16 = aRloc16;
+    VerifyOrExit(entry != NULL && entry->mRloc16 != aRloc16);
 
-            if (mCache[i].mState != Cache::kStateCached)
-            {
-                mCache[i].mRetryTimeout        = 0;
-                mCache[i].mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
-                mCache[i].mTimeout             = 0;
-                mCache[i].mFailures            = 0;
-                mCache[i].mState               = Cache::kStateCached;
-
-                Get<MeshForwarder>().HandleResolved(aEid, OT_ERROR_NONE);
-            }
+    // not updating the age here is intentional because this cache entry is not actually being used
+    entry->mRloc16 = aRloc16;
 
-            otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
-        }
+    if (entry->mState != Cache::kStateCached)
+    {
+        entry->mRetryTimeout        = 0;
+        entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+        entry->mTimeout             = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateCached;
 
-        ExitNow();
+        Get<MeshForwarder>().HandleResolved(aEid, OT_ERROR_NONE);
     }
 
+    otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
+
 exit:
     return;
 }
@@ -254,19 +394,7 @@ exit:
 otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
 {
     otError error = OT_ERROR_NONE;
-    Cache * entry = NULL;
-
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid)
-        {
-            if (mCache[i].mTarget == aEid)
-            {
-                entry = &mCache[i];
-                break;
-            }
-        }
-    }
+    Cache * entry = FindCacheEntry(aEid);
 
     if (entry == NULL)
     {
@@ -285,7 +413,8 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         entry->mFailures     = 0;
         entry->mRetryTimeout = kAddressQueryInitialRetryDelay;
         entry->mState        = Cache::kStateQuery;
-        error                = OT_ERROR_ADDRESS_QUERY;
+        AddToCacheIndex(*entry);
+        error = OT_ERROR_ADDRESS_QUERY;
         break;
 
     case Cache::kStateQuery:
@@ -371,6 +500,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     ThreadRloc16Tlv              rloc16Tlv;
     ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
     uint32_t                     lastTransactionTime;
+    Cache *                      entry;
 
     VerifyOrExit(aMessage.GetType() == OT_COAP_TYPE_CONFIRMABLE && aMessage.GetCode() == OT_COAP_CODE_POST);
 
@@ -396,56 +526,50 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
                  HostSwap16(aMessageInfo.GetPeerAddr().mFields.m16[7]), targetTlv.GetTarget().ToString().AsCString(),
                  rloc16Tlv.GetRloc16());
 
-    for (int i = 0; i < kCacheEntries; i++)
+    VerifyOrExit((entry = FindCacheEntry(targetTlv.GetTarget())) != NULL);
+
+    switch (entry->mState)
     {
-        if (mCache[i].mTarget != targetTlv.GetTarget())
-        {
-            continue;
-        }
+    case Cache::kStateInvalid:
+        break;
 
-        switch (mCache[i].mState)
+    case Cache::kStateCached:
+        if (entry->mLastTransactionTime != kLastTransactionTimeInvalid)
         {
-        case Cache::kStateInvalid:
-            break;
-
-        case Cache::kStateCached:
-            if (mCache[i].mLastTransactionTime != kLastTransactionTimeInvalid)
+            if (memcmp(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid)) != 0)
             {
-                if (memcmp(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid)) != 0)
-                {
-                    SendAddressError(targetTlv, mlIidTlv, NULL);
-                    ExitNow();
-                }
-
-                if (lastTransactionTime >= mCache[i].mLastTransactionTime)
-                {
-                    ExitNow();
-                }
+                SendAddressError(targetTlv, mlIidTlv, NULL);
+                ExitNow();
             }
 
-            // fall through
+            if (lastTransactionTime >= entry->mLastTransactionTime)
+            {
+                ExitNow();
+            }
+        }
 
-        case Cache::kStateQuery:
-            memcpy(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid));
-            mCache[i].mRloc16              = rloc16Tlv.GetRloc16();
-            mCache[i].mRetryTimeout        = 0;
-            mCache[i].mLastTransactionTime = lastTransactionTime;
-            mCache[i].mTimeout             = 0;
-            mCache[i].mFailures            = 0;
-            mCache[i].mState               = Cache::kStateCached;
-            MarkCacheEntryAsUsed(mCache[i]);
+        // fall through
 
-            otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
-                         targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
+    case Cache::kStateQuery:
+        memcpy(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid));
+        entry->mRloc16              = rloc16Tlv.GetRloc16();
+        entry->mRetryTimeout        = 0;
+        entry->mLastTransactionTime = lastTransactionTime;
+        entry->mTimeout             = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateCached;
+        MarkCacheEntryAsUsed(*entry);
 
-            if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
-            {
-                otLogInfoArp("Sending address notification acknowledgment");
-            }
+        otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
+                     targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
 
-            Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
-            break;
+        if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
+        {
+            otLogInfoArp("Sending address notification acknowledgment");
         }
+
+        Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
+        break;
     }
 
 exit:
@@ -749,18 +873,15 @@ void AddressResolver::HandleIcmpReceive(Message &               aMessage,
     OT_UNUSED_VARIABLE(aMessageInfo);
 
     Ip6::Header ip6Header;
+    Cache *     entry;
 
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::IcmpHeader::kTypeDstUnreach);
     VerifyOrExit(aIcmpHeader.GetCode() == Ip6::IcmpHeader::kCodeDstUnreachNoRoute);
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header));
 
-    for (int i = 0; i < kCacheEntries; i++)
+    if ((entry = FindCacheEntry(ip6Header.GetDestination())) != NULL)
     {
-        if (mCache[i].mState != Cache::kStateInvalid && mCache[i].mTarget == ip6Header.GetDestination())
-        {
-            InvalidateCacheEntry(mCache[i], kReasonReceivedIcmpDstUnreachNoRoute);
-            break;
-        }
+        InvalidateCacheEntry(*entry, kReasonReceivedIcmpDstUnreachNoRoute);
     }
 
 exit:
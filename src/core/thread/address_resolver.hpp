@@ -43,6 +43,7 @@
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
 #include "thread/thread_tlvs.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -77,6 +78,8 @@ public:
     /**
      * This method gets an EID cache entry.
      *
+     * The entry age is the number of times other entries were used since the entry was last used, saturated at 255.
+     *
      * @param[in]   aIndex  An index into the EID cache table.
      * @param[out]  aEntry  A reference to where the EID information is placed.
      *
@@ -84,7 +87,7 @@ public:
      * @retval OT_ERROR_INVALID_ARGS  @p aIndex was out of bounds.
      *
      */
-    otError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
+    otError GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const;
 
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
@@ -129,9 +132,14 @@ private:
     enum
     {
         kCacheEntries      = OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
-        kStateUpdatePeriod = 1000u, ///< State update period in milliseconds.
+        kCacheIndexSize    = 2 * kCacheEntries, ///< Number of hash index slots (load factor kept at or below 1/2).
+        kInvalidIndex      = 0xffff,            ///< Marks an empty hash index slot or the end of the LRU list.
+        kStateUpdatePeriod = 1000u,             ///< State update period in milliseconds.
+        kMaxAge            = 0xff,              ///< Maximum age reported by `GetEntry()`.
     };
 
+    OT_STATIC_ASSERT(kCacheIndexSize < kInvalidIndex, "OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES is too large");
+
     /**
      * Thread Protocol Parameters and Constants
      *
@@ -160,11 +168,13 @@ private:
         Ip6::Address      mTarget;
         uint8_t           mMeshLocalIid[Ip6::Address::kInterfaceIdentifierSize];
         uint32_t          mLastTransactionTime;
+        uint32_t          mLastUse; ///< Value of `mUseCount` when the entry was last used.
         Mac::ShortAddress mRloc16;
         uint16_t          mRetryTimeout;
+        uint16_t          mLruPrev; ///< Index of the next more recently used entry (`kInvalidIndex` if head).
+        uint16_t          mLruNext; ///< Index of the next less recently used entry (`kInvalidIndex` if tail).
         uint8_t           mTimeout;
         uint8_t           mFailures;
-        uint8_t           mAge;
         State             mState;
     };
 
@@ -178,10 +188,20 @@ private:
 
     static const char *ConvertInvalidationReasonToString(InvalidationReason aReason);
 
+    Cache *FindCacheEntry(const Ip6::Address &aEid);
     Cache *NewCacheEntry(void);
     void   MarkCacheEntryAsUsed(Cache &aEntry);
     void   InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason);
 
+    static uint16_t GetCacheIndexSlot(const Ip6::Address &aEid);
+    void            AddToCacheIndex(Cache &aEntry);
+    void            RemoveFromCacheIndex(Cache &aEntry);
+
+    uint16_t GetCacheEntryIndex(const Cache &aEntry) const { return static_cast<uint16_t>(&aEntry - mCache); }
+    void     RemoveFromLruList(Cache &aEntry);
+    void     AddToLruListHead(Cache &aEntry);
+    void     AddToLruListTail(Cache &aEntry);
+
     otError SendAddressQuery(const Ip6::Address &aEid);
     otError SendAddressError(const ThreadTargetTlv &      aTarget,
                              const ThreadMeshLocalEidTlv &aEid,
@@ -215,6 +235,10 @@ private:
     Coap::Resource   mAddressQuery;
     Coap::Resource   mAddressNotification;
     Cache            mCache[kCacheEntries];
+    uint16_t         mCacheIndex[kCacheIndexSize];
+    uint16_t         mLruHead;
+    uint16_t         mLruTail;
+    uint32_t         mUseCount;
     Ip6::IcmpHandler mIcmpHandler;
     TimerMilli       mTimer;
 };
@@ -34,6 +34,7 @@
 #include "child_table.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/debug.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 
@@ -101,8 +102,83 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+{
+    Clear();
+}
+
+void ChildTable::Clear(void)
 {
     memset(mChildren, 0, sizeof(mChildren));
+    ClearIndex();
+}
+
+void ChildTable::ClearIndex(void)
+{
+    memset(mChildIdHead, kInvalidIndex, sizeof(mChildIdHead));
+    memset(mExtAddressHead, kInvalidIndex, sizeof(mExtAddressHead));
+
+    for (uint8_t index = 0; index < kMaxChildren; index++)
+    {
+        mIndexedChildId[index] = kNotIndexed;
+    }
+}
+
+void ChildTable::SetChildState(Child &aChild, Child::State aState)
+{
+    aChild.SetState(aState);
+    UpdateChildIndex(aChild);
+}
+
+void ChildTable::SetChildRloc16(Child &aChild, uint16_t aRloc16)
+{
+    aChild.SetRloc16(aRloc16);
+    UpdateChildIndex(aChild);
+}
+
+void ChildTable::SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress)
+{
+    aChild.SetExtAddress(aAddress);
+    UpdateChildIndex(aChild);
+}
+
+void ChildTable::UpdateChildIndex(const Child &aChild)
+{
+    uint8_t index = GetChildIndex(aChild);
+
+    assert(index < kMaxChildren);
+
+    if (mIndexedChildId[index] != kNotIndexed)
+    {
+        Unlink(mChildIdHead[mIndexedChildId[index]], mChildIdNext, index);
+        Unlink(mExtAddressHead[mIndexedExtAddressBucket[index]], mExtAddressNext, index);
+        mIndexedChildId[index] = kNotIndexed;
+    }
+
+    VerifyOrExit(aChild.GetState() != Child::kStateInvalid);
+
+    mIndexedChildId[index]          = Mle::Mle::GetChildId(aChild.GetRloc16());
+    mIndexedExtAddressBucket[index] = GetExtAddressBucket(aChild.GetExtAddress());
+
+    mChildIdNext[index]                               = mChildIdHead[mIndexedChildId[index]];
+    mChildIdHead[mIndexedChildId[index]]              = index;
+    mExtAddressNext[index]                            = mExtAddressHead[mIndexedExtAddressBucket[index]];
+    mExtAddressHead[mIndexedExtAddressBucket[index]] = index;
+
+exit:
+    return;
+}
+
+void ChildTable::Unlink(uint8_t &aHead, uint8_t *aNext, uint8_t aIndex)
+{
+    uint8_t *link = &aHead;
+
+    while (*link != aIndex)
+    {
+        assert(*link != kInvalidIndex);
+        link = &aNext[*link];
+    }
+
+    *link = aNext[aIndex];
 }
 
 Child *ChildTable::GetChildAtIndex(uint8_t aChildIndex)
@@ -137,36 +213,34 @@ exit:
 
 Child *ChildTable::FindChild(uint16_t aRloc16, StateFilter aFilter)
 {
-    Child *child = mChildren;
+    Child *child = NULL;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    for (uint8_t index = mChildIdHead[Mle::Mle::GetChildId(aRloc16)]; index != kInvalidIndex;
+         index         = mChildIdNext[index])
     {
-        if (MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
+        if ((mChildren[index].GetRloc16() == aRloc16) && MatchesFilter(mChildren[index], aFilter))
         {
-            ExitNow();
+            ExitNow(child = &mChildren[index]);
         }
     }
 
-    child = NULL;
-
 exit:
     return child;
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilter)
 {
-    Child *child = mChildren;
+    Child *child = NULL;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    for (uint8_t index = mExtAddressHead[GetExtAddressBucket(aAddress)]; index != kInvalidIndex;
+         index         = mExtAddressNext[index])
     {
-        if (MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
+        if ((mChildren[index].GetExtAddress() == aAddress) && MatchesFilter(mChildren[index], aFilter))
         {
-            ExitNow();
+            ExitNow(child = &mChildren[index]);
         }
     }
 
-    child = NULL;
-
 exit:
     return child;
 }
@@ -238,6 +312,18 @@ exit:
     return error;
 }
 
+uint16_t ChildTable::GetExtAddressBucket(const Mac::ExtAddress &aAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aAddress.m8); i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) - hash + aAddress.m8[i]);
+    }
+
+    return hash % kExtAddressBuckets;
+}
+
 bool ChildTable::MatchesFilter(const Child &aChild, StateFilter aFilter)
 {
     bool rval = false;
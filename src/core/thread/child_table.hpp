@@ -37,7 +37,9 @@
 #include "openthread-core-config.h"
 
 #include "common/locator.hpp"
+#include "thread/mle_constants.hpp"
 #include "thread/topology.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -170,7 +172,7 @@ public:
      * This method clears the child table.
      *
      */
-    void Clear(void) { memset(mChildren, 0, sizeof(mChildren)); }
+    void Clear(void);
 
     /**
      * This method returns the child table index for a given `Child` instance.
@@ -203,9 +205,53 @@ public:
      */
     Child *GetNewChild(void);
 
+    /**
+     * This method sets the state of a `Child` entry and updates the lookup indexes of the child table.
+     *
+     * @param[in]  aChild  A reference to a `Child` entry in the child table.
+     * @param[in]  aState  The new state.
+     *
+     */
+    void SetChildState(Child &aChild, Child::State aState);
+
+    /**
+     * This method sets the RLOC16 of a `Child` entry and updates the lookup indexes of the child table.
+     *
+     * @param[in]  aChild   A reference to a `Child` entry in the child table.
+     * @param[in]  aRloc16  The new RLOC16.
+     *
+     */
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16);
+
+    /**
+     * This method sets the extended address of a `Child` entry and updates the lookup indexes of the child table.
+     *
+     * @param[in]  aChild    A reference to a `Child` entry in the child table.
+     * @param[in]  aAddress  The new extended address.
+     *
+     */
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress);
+
+    /**
+     * This method indicates whether a given `Neighbor` is an entry of the child table.
+     *
+     * @param[in]  aNeighbor  A reference to a `Neighbor`.
+     *
+     * @retval TRUE   If @p aNeighbor is a `Child` entry in the child table.
+     * @retval FALSE  If @p aNeighbor is not a `Child` entry in the child table.
+     *
+     */
+    bool Contains(const Neighbor &aNeighbor) const
+    {
+        return (&aNeighbor >= &mChildren[0]) && (&aNeighbor < &mChildren[kMaxChildren]);
+    }
+
     /**
      * This method searches the child table for a `Child` with a given RLOC16 also matching a given state filter.
      *
+     * Children in `Child::kStateInvalid` are never returned, whatever the filter. Such an entry is a free slot whose
+     * RLOC16 and extended address are left over from a removed child.
+     *
      * @param[in]  aRloc16  A RLOC16 address.
      * @param[in]  aFilter  A child state filter.
      *
@@ -218,6 +264,9 @@ public:
      * This method searches the child table for a `Child` with a given extended address also matching a given state
      * filter.
      *
+     * Children in `Child::kStateInvalid` are never returned, whatever the filter. Such an entry is a free slot whose
+     * RLOC16 and extended address are left over from a removed child.
+     *
      * @param[in]  aAddress A reference to an extended address.
      * @param[in]  aFilter  A child state filter.
      *
@@ -294,13 +343,34 @@ public:
 private:
     enum
     {
-        kMaxChildren = OPENTHREAD_CONFIG_MAX_CHILDREN,
+        kMaxChildren       = OPENTHREAD_CONFIG_MAX_CHILDREN,
+        kNumChildIds       = Mle::kMaxChildId + 1, // Number of list heads in the child ID index.
+        kExtAddressBuckets = 2 * kMaxChildren,     // Number of list heads in the extended address index.
+        kInvalidIndex      = 0xff,                 // Index value indicating no child (end of list).
+        kNotIndexed        = 0xffff,               // `mIndexedChildId` value of a child not in the indexes.
     };
 
-    static bool MatchesFilter(const Child &aChild, StateFilter aFilter);
+    OT_STATIC_ASSERT(kMaxChildren < kInvalidIndex, "OPENTHREAD_CONFIG_MAX_CHILDREN is too large");
+
+    static bool     MatchesFilter(const Child &aChild, StateFilter aFilter);
+    static uint16_t GetExtAddressBucket(const Mac::ExtAddress &aAddress);
+    static void     Unlink(uint8_t &aHead, uint8_t *aNext, uint8_t aIndex);
+
+    void ClearIndex(void);
+    void UpdateChildIndex(const Child &aChild);
 
     uint8_t mMaxChildrenAllowed;
     Child   mChildren[kMaxChildren];
+
+    // Lookup indexes maintained by the `SetChild*()` setters. Every child not in `kStateInvalid` is linked into the
+    // list of its child ID (RLOC16 child bits) and into the list of its extended address hash bucket. A lookup only
+    // visits the children on one list, and a child not found there is not in the table.
+    uint8_t  mChildIdHead[kNumChildIds];
+    uint8_t  mExtAddressHead[kExtAddressBuckets];
+    uint8_t  mChildIdNext[kMaxChildren];
+    uint8_t  mExtAddressNext[kMaxChildren];
+    uint16_t mIndexedChildId[kMaxChildren];
+    uint16_t mIndexedExtAddressBucket[kMaxChildren];
 };
 
 #endif // OPENTHREAD_FTD
@@ -343,6 +413,11 @@ public:
 
     Child *GetNewChild(void) { return NULL; }
 
+    void SetChildState(Child &aChild, Child::State aState) { aChild.SetState(aState); }
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16) { aChild.SetRloc16(aRloc16); }
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress) { aChild.SetExtAddress(aAddress); }
+    bool Contains(const Neighbor &) const { return false; }
+
     Child *FindChild(uint16_t, StateFilter) { return NULL; }
     Child *FindChild(const Mac::ExtAddress &, StateFilter) { return NULL; }
     Child *FindChild(const Mac::Address &, StateFilter) { return NULL; }
@@ -0,0 +1,313 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the per-child indirect message queues.
+ */
+
+#if OPENTHREAD_FTD
+
+#include "indirect_queue.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/locator-getters.hpp"
+#include "thread/child_table.hpp"
+
+namespace ot {
+
+IndirectQueue::IndirectQueue(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Clear();
+}
+
+void IndirectQueue::Clear(void)
+{
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        mEntries[i].mMessage = NULL;
+        mEntries[i].mNext    = (i + 1 < kNumEntries) ? i + 1 : static_cast<uint16_t>(kInvalidIndex);
+    }
+
+    mFreeEntries        = 0;
+    mNumFreeEntries     = kNumEntries;
+    mNumEmptyChildren   = kMaxChildren;
+    mNumPendingMessages = 0;
+
+    for (uint8_t i = 0; i < kMaxChildren; i++)
+    {
+        mHeads[i] = kInvalidIndex;
+        mTails[i] = kInvalidIndex;
+    }
+}
+
+uint8_t IndirectQueue::GetChildIndex(const Child &aChild) const
+{
+    uint8_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    assert(childIndex < kMaxChildren);
+
+    return childIndex;
+}
+
+uint16_t IndirectQueue::GetNumReservedEntries(void) const
+{
+    uint16_t numReserved = mNumEmptyChildren;
+
+    // With a platform message pool there may be more messages than `kMaxMessages`.
+    if (mNumPendingMessages < kMaxMessages)
+    {
+        numReserved += kMaxMessages - mNumPendingMessages;
+    }
+
+    return numReserved;
+}
+
+uint16_t IndirectQueue::FindEntry(uint8_t aChildIndex, const Message &aMessage, uint16_t &aPrevSibling) const
+{
+    uint16_t entry = kInvalidIndex;
+
+    aPrevSibling = kInvalidIndex;
+
+    VerifyOrExit(aMessage.IsChildPending());
+
+    for (entry = aMessage.GetIndirectEntry(); entry != kInvalidIndex; entry = mEntries[entry].mNextSibling)
+    {
+        if (mEntries[entry].mChildIndex == aChildIndex)
+        {
+            break;
+        }
+
+        aPrevSibling = entry;
+    }
+
+exit:
+    return entry;
+}
+
+otError IndirectQueue::Add(const Child &aChild, Message &aMessage)
+{
+    otError  error      = OT_ERROR_NONE;
+    uint8_t  childIndex = GetChildIndex(aChild);
+    bool     isNewChild = (mHeads[childIndex] == kInvalidIndex);
+    uint16_t prev       = kInvalidIndex;
+    uint16_t prevSibling;
+    uint16_t entry;
+
+    VerifyOrExit(FindEntry(childIndex, aMessage, prevSibling) == kInvalidIndex, error = OT_ERROR_ALREADY);
+
+    // The first entry of a message or of a child uses a reserved entry, any other entry needs one not reserved.
+    VerifyOrExit(mNumFreeEntries > 0, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(!aMessage.IsChildPending() || isNewChild || (mNumFreeEntries > GetNumReservedEntries()),
+                 error = OT_ERROR_NO_BUFS);
+
+    // Messages are usually added in order, so check the tail first
+    // before searching for the insertion point from the head.
+
+    if (isNewChild || (mEntries[mTails[childIndex]].mMessage->GetPriority() >= aMessage.GetPriority()))
+    {
+        prev = mTails[childIndex];
+    }
+    else
+    {
+        for (uint16_t cur = mHeads[childIndex];
+             cur != kInvalidIndex && mEntries[cur].mMessage->GetPriority() >= aMessage.GetPriority();
+             cur = mEntries[cur].mNext)
+        {
+            prev = cur;
+        }
+    }
+
+    if (isNewChild)
+    {
+        mNumEmptyChildren--;
+    }
+
+    if (!aMessage.IsChildPending())
+    {
+        mNumPendingMessages++;
+        aMessage.SetIndirectEntry(kInvalidIndex);
+    }
+
+    entry        = mFreeEntries;
+    mFreeEntries = mEntries[entry].mNext;
+    mNumFreeEntries--;
+
+    mEntries[entry].mMessage     = &aMessage;
+    mEntries[entry].mChildIndex  = childIndex;
+    mEntries[entry].mNextSibling = aMessage.GetIndirectEntry();
+    mEntries[entry].mPrev        = prev;
+    aMessage.SetIndirectEntry(entry);
+
+    if (prev == kInvalidIndex)
+    {
+        mEntries[entry].mNext = mHeads[childIndex];
+        mHeads[childIndex]    = entry;
+    }
+    else
+    {
+        mEntries[entry].mNext = mEntries[prev].mNext;
+        mEntries[prev].mNext  = entry;
+    }
+
+    if (mEntries[entry].mNext == kInvalidIndex)
+    {
+        mTails[childIndex] = entry;
+    }
+    else
+    {
+        mEntries[mEntries[entry].mNext].mPrev = entry;
+    }
+
+    aMessage.IncrementChildPendingCount();
+
+exit:
+    return error;
+}
+
+otError IndirectQueue::Remove(const Child &aChild, Message &aMessage)
+{
+    otError  error      = OT_ERROR_NONE;
+    uint8_t  childIndex = GetChildIndex(aChild);
+    uint16_t prevSibling;
+    uint16_t entry;
+    uint16_t prev;
+    uint16_t next;
+
+    entry = FindEntry(childIndex, aMessage, prevSibling);
+    VerifyOrExit(entry != kInvalidIndex, error = OT_ERROR_NOT_FOUND);
+
+    if (prevSibling == kInvalidIndex)
+    {
+        aMessage.SetIndirectEntry(mEntries[entry].mNextSibling);
+    }
+    else
+    {
+        mEntries[prevSibling].mNextSibling = mEntries[entry].mNextSibling;
+    }
+
+    prev = mEntries[entry].mPrev;
+    next = mEntries[entry].mNext;
+
+    if (prev == kInvalidIndex)
+    {
+        mHeads[childIndex] = next;
+    }
+    else
+    {
+        mEntries[prev].mNext = next;
+    }
+
+    if (next == kInvalidIndex)
+    {
+        mTails[childIndex] = prev;
+    }
+    else
+    {
+        mEntries[next].mPrev = prev;
+    }
+
+    mEntries[entry].mMessage = NULL;
+    mEntries[entry].mNext    = mFreeEntries;
+    mFreeEntries             = entry;
+    mNumFreeEntries++;
+
+    if (mHeads[childIndex] == kInvalidIndex)
+    {
+        mNumEmptyChildren++;
+    }
+
+    aMessage.DecrementChildPendingCount();
+
+    if (!aMessage.IsChildPending())
+    {
+        mNumPendingMessages--;
+    }
+
+exit:
+    return error;
+}
+
+Child *IndirectQueue::GetChild(const Message &aMessage)
+{
+    Child *child = NULL;
+
+    VerifyOrExit(aMessage.IsChildPending());
+    child = Get<ChildTable>().GetChildAtIndex(mEntries[aMessage.GetIndirectEntry()].mChildIndex);
+
+exit:
+    return child;
+}
+
+bool IndirectQueue::Contains(const Child &aChild, const Message &aMessage) const
+{
+    uint16_t prevSibling;
+
+    return FindEntry(GetChildIndex(aChild), aMessage, prevSibling) != kInvalidIndex;
+}
+
+Message *IndirectQueue::GetHead(const Child &aChild) const
+{
+    uint16_t head = mHeads[GetChildIndex(aChild)];
+
+    return (head == kInvalidIndex) ? NULL : mEntries[head].mMessage;
+}
+
+IndirectQueue::Iterator::Iterator(const IndirectQueue &aQueue, const Child &aChild)
+    : mQueue(aQueue)
+    , mMessage(NULL)
+    , mNextEntry(kInvalidIndex)
+{
+    Update(aQueue.mHeads[aQueue.GetChildIndex(aChild)]);
+}
+
+void IndirectQueue::Iterator::Advance(void)
+{
+    Update(mNextEntry);
+}
+
+void IndirectQueue::Iterator::Update(uint16_t aEntryIndex)
+{
+    if (aEntryIndex == kInvalidIndex)
+    {
+        mMessage   = NULL;
+        mNextEntry = kInvalidIndex;
+    }
+    else
+    {
+        mMessage   = mQueue.mEntries[aEntryIndex].mMessage;
+        mNextEntry = mQueue.mEntries[aEntryIndex].mNext;
+    }
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_FTD
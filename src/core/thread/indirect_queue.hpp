@@ -0,0 +1,256 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the per-child indirect message queues.
+ */
+
+#ifndef INDIRECT_QUEUE_HPP_
+#define INDIRECT_QUEUE_HPP_
+
+#include "openthread-core-config.h"
+
+#include "common/locator.hpp"
+#include "common/message.hpp"
+#include "thread/topology.hpp"
+#include "utils/static_assert.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-indirect-queue
+ *
+ * @brief
+ *   This module includes definitions for the per-child indirect message queues.
+ *
+ * @{
+ */
+
+/**
+ * This class implements the per-child queues of messages pending indirect transmission to sleepy children.
+ *
+ * The messages themselves stay in the `MeshForwarder` send queue. Each child has its own ordered list of entries
+ * referring to those messages, in the same order (by priority, then first-in first-out) as the send queue, so the
+ * next message for a polling child is always at the head of its list. A multicast message shared by several children
+ * uses a single message buffer and one small entry per child.
+ *
+ * Besides the shared entries, one entry is reserved for each message buffer and one for each child. A message not
+ * yet queued for any child can always be queued, and every queued message uses at least one buffer, so a unicast
+ * message to a sleepy child never fails for lack of entries. A child with an empty queue can always have a message
+ * queued, so a multicast fan-out reaches every sleepy child even when other children used up the shared entries.
+ *
+ * The entries of a message are also linked together, starting from `Message::GetIndirectEntry()`, so finding or
+ * removing the entries of a message only visits the children it is queued for. The queue also tracks on each message
+ * the number of children for which it is pending (`Message::IsChildPending()`).
+ *
+ */
+class IndirectQueue : public InstanceLocator
+{
+public:
+    /**
+     * This class represents an iterator over the messages queued for a child.
+     *
+     * The current message can be removed from the queue while iterating.
+     *
+     */
+    class Iterator
+    {
+    public:
+        /**
+         * This constructor initializes the iterator to the first message queued for a child.
+         *
+         * @param[in]  aQueue  A reference to the indirect queue.
+         * @param[in]  aChild  A reference to the child.
+         *
+         */
+        Iterator(const IndirectQueue &aQueue, const Child &aChild);
+
+        /**
+         * This method indicates whether there are no more messages to iterate over.
+         *
+         * @retval TRUE   There are no more messages.
+         * @retval FALSE  There are more messages (the current message is valid).
+         *
+         */
+        bool IsDone(void) const { return (mMessage == NULL); }
+
+        /**
+         * This method returns the current message.
+         *
+         * @returns A pointer to the current message, or NULL if iteration is done.
+         *
+         */
+        Message *GetMessage(void) const { return mMessage; }
+
+        /**
+         * This method advances the iterator to the next message.
+         *
+         */
+        void Advance(void);
+
+        /**
+         * This method overloads `++` operator (pre-increment) to advance the iterator.
+         *
+         */
+        void operator++(void) { Advance(); }
+
+        /**
+         * This method overloads `++` operator (post-increment) to advance the iterator.
+         *
+         */
+        void operator++(int) { Advance(); }
+
+    private:
+        void Update(uint16_t aEntryIndex);
+
+        const IndirectQueue &mQueue;
+        Message *            mMessage;
+        uint16_t             mNextEntry;
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit IndirectQueue(Instance &aInstance);
+
+    /**
+     * This method removes all entries for all children.
+     *
+     * The pending child count of the messages is left unchanged, so this method should only be used when the messages
+     * themselves are being freed.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method queues a message for indirect transmission to a child.
+     *
+     * The message is placed after all messages queued for the child with the same or higher priority.
+     *
+     * @param[in]  aChild    A reference to the child.
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * Queuing a message that is not queued for any other child, or queuing for a child with an empty queue, always
+     * succeeds. Only a multicast fan-out to a child with other queued messages can fail with `OT_ERROR_NO_BUFS`.
+     *
+     * @retval OT_ERROR_NONE      Successfully queued the message for the child.
+     * @retval OT_ERROR_ALREADY   The message is already queued for the child.
+     * @retval OT_ERROR_NO_BUFS   No free entries are available (other than entries reserved for other messages or
+     *                            children).
+     *
+     */
+    otError Add(const Child &aChild, Message &aMessage);
+
+    /**
+     * This method removes a message from the queue of a child.
+     *
+     * @param[in]  aChild    A reference to the child.
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @retval OT_ERROR_NONE       Successfully removed the message.
+     * @retval OT_ERROR_NOT_FOUND  The message is not queued for the child.
+     *
+     */
+    otError Remove(const Child &aChild, Message &aMessage);
+
+    /**
+     * This method returns one of the children a message is queued for.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @returns A pointer to a child @p aMessage is queued for, or NULL if it is not queued for any child.
+     *
+     */
+    Child *GetChild(const Message &aMessage);
+
+    /**
+     * This method indicates whether a message is queued for a child.
+     *
+     * @param[in]  aChild    A reference to the child.
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @retval TRUE   @p aMessage is queued for @p aChild.
+     * @retval FALSE  @p aMessage is not queued for @p aChild.
+     *
+     */
+    bool Contains(const Child &aChild, const Message &aMessage) const;
+
+    /**
+     * This method returns the first message queued for a child.
+     *
+     * @param[in]  aChild    A reference to the child.
+     *
+     * @returns A pointer to the first message queued for @p aChild, or NULL if there is none.
+     *
+     */
+    Message *GetHead(const Child &aChild) const;
+
+private:
+    enum
+    {
+        kMaxChildren  = OPENTHREAD_CONFIG_MAX_CHILDREN,
+        kMaxMessages  = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+        kNumEntries   = OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES + kMaxMessages + kMaxChildren,
+        kInvalidIndex = Message::kInvalidIndirectEntry,
+    };
+
+    OT_STATIC_ASSERT(kNumEntries < kInvalidIndex, "OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES is too large");
+
+    struct Entry
+    {
+        Message *mMessage;
+        uint16_t mNext;        // Next entry of the child.
+        uint16_t mPrev;        // Previous entry of the child.
+        uint16_t mNextSibling; // Next entry of the message.
+        uint8_t  mChildIndex;
+    };
+
+    uint8_t  GetChildIndex(const Child &aChild) const;
+    uint16_t FindEntry(uint8_t aChildIndex, const Message &aMessage, uint16_t &aPrevSibling) const;
+    uint16_t GetNumReservedEntries(void) const;
+
+    Entry    mEntries[kNumEntries];
+    uint16_t mFreeEntries;
+    uint16_t mNumFreeEntries;
+    uint16_t mNumEmptyChildren;   // Number of children with an empty queue, each has a free entry reserved.
+    uint16_t mNumPendingMessages; // Number of queued messages, the other message buffers have a free entry reserved.
+    uint16_t mHeads[kMaxChildren];
+    uint16_t mTails[kMaxChildren];
+};
+
+/**
+ * @}
+ */
+
+} // namespace ot
+
+#endif // INDIRECT_QUEUE_HPP_
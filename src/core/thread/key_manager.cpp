@@ -84,7 +84,9 @@ KeyManager::KeyManager(Instance &aInstance)
     , mIsPSKcSet(false)
 {
     memset(&mPSKc, 0, sizeof(mPSKc));
+    ComputeHmacStates();
     ComputeKey(mKeySequence, mKey);
+    UpdateKeySchedules();
 }
 
 void KeyManager::Start(void)
@@ -125,7 +127,9 @@ otError KeyManager::SetMasterKey(const otMasterKey &aKey)
 
     mMasterKey   = aKey;
     mKeySequence = 0;
+    ComputeHmacStates();
     ComputeKey(mKeySequence, mKey);
+    UpdateKeySchedules();
 
     // reset parent frame counters
     routers = Get<Mle::MleRouter>().GetParent();
@@ -155,21 +159,142 @@ exit:
     return error;
 }
 
+void KeyManager::ComputeHmacStates(void)
+{
+    uint8_t pad[kHmacBlockSize];
+
+    // the master key is shorter than a block, it is padded with zeros (RFC 2104)
+    for (uint8_t i = 0; i < sizeof(pad); i++)
+    {
+        pad[i] = ((i < sizeof(mMasterKey.m8)) ? mMasterKey.m8[i] : 0) ^ 0x36;
+    }
+
+    mInnerHashState.Start();
+    mInnerHashState.Update(pad, sizeof(pad));
+
+    for (uint8_t i = 0; i < sizeof(pad); i++)
+    {
+        pad[i] = ((i < sizeof(mMasterKey.m8)) ? mMasterKey.m8[i] : 0) ^ 0x5c;
+    }
+
+    mOuterHashState.Start();
+    mOuterHashState.Update(pad, sizeof(pad));
+
+    memset(pad, 0, sizeof(pad));
+
+#if OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE
+    mNumDerivedKeys = 0;
+#endif
+}
+
 void KeyManager::ComputeKey(uint32_t aKeySequence, uint8_t *aKey)
 {
-    Crypto::HmacSha256 hmac;
-    uint8_t            keySequenceBytes[4];
+#if OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE
+    uint8_t index;
+
+    for (index = 0; index < mNumDerivedKeys; index++)
+    {
+        if (mDerivedKeys[index].mKeySequence == aKeySequence)
+        {
+            break;
+        }
+    }
 
-    hmac.Start(mMasterKey.m8, sizeof(mMasterKey.m8));
+    if (index == mNumDerivedKeys)
+    {
+        // replaces the least recently used key when all entries are in use
+        if (mNumDerivedKeys < OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE)
+        {
+            mNumDerivedKeys++;
+        }
+
+        index = mNumDerivedKeys - 1;
+        DeriveKey(aKeySequence, mDerivedKeys[index].mKey);
+        mDerivedKeys[index].mKeySequence = aKeySequence;
+    }
+
+    if (index > 0)
+    {
+        DerivedKey derivedKey = mDerivedKeys[index];
+
+        memmove(&mDerivedKeys[1], &mDerivedKeys[0], index * sizeof(DerivedKey));
+        mDerivedKeys[0] = derivedKey;
+    }
+
+    memcpy(aKey, mDerivedKeys[0].mKey, sizeof(mDerivedKeys[0].mKey));
+#else
+    DeriveKey(aKeySequence, aKey);
+#endif
+}
+
+void KeyManager::DeriveKey(uint32_t aKeySequence, uint8_t *aKey)
+{
+    Crypto::Sha256 sha256;
+    uint8_t        keySequenceBytes[4];
+    uint8_t        innerHash[Crypto::Sha256::kHashSize];
 
     keySequenceBytes[0] = (aKeySequence >> 24) & 0xff;
     keySequenceBytes[1] = (aKeySequence >> 16) & 0xff;
     keySequenceBytes[2] = (aKeySequence >> 8) & 0xff;
     keySequenceBytes[3] = aKeySequence & 0xff;
-    hmac.Update(keySequenceBytes, sizeof(keySequenceBytes));
-    hmac.Update(kThreadString, sizeof(kThreadString));
 
-    hmac.Finish(aKey);
+    // HMAC-SHA256(master key, key sequence || "Thread"), resumed from the states after the pads
+    sha256.Clone(mInnerHashState);
+    sha256.Update(keySequenceBytes, sizeof(keySequenceBytes));
+    sha256.Update(kThreadString, sizeof(kThreadString));
+    sha256.Finish(innerHash);
+
+    sha256.Clone(mOuterHashState);
+    sha256.Update(innerHash, sizeof(innerHash));
+    sha256.Finish(aKey);
+}
+
+void KeyManager::UpdateKeySchedules(void)
+{
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    for (uint8_t i = 0; i < kNumKeySchedules; i++)
+    {
+        uint32_t       keySequence = mKeySequence + i - kCurrentKeySchedule;
+        const uint8_t *key         = mKey;
+
+        if (keySequence != mKeySequence)
+        {
+            ComputeKey(keySequence, mTemporaryKey);
+            key = mTemporaryKey;
+        }
+
+        mMleKeySchedules[i].SetKey(key + kMleKeyOffset, 8 * kKeySize);
+        mMacKeySchedules[i].SetKey(key + kMacKeyOffset, 8 * kKeySize);
+    }
+#endif
+}
+
+Crypto::AesEcb &KeyManager::GetKeySchedule(uint32_t aKeySequence, uint8_t aKeyOffset)
+{
+    Crypto::AesEcb *keySchedule = &mTemporaryKeySchedule;
+    const uint8_t * key         = mKey;
+
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    // wraps around to a large index for key sequences other than the previous, current and next ones
+    uint32_t index = aKeySequence - mKeySequence + kCurrentKeySchedule;
+
+    if (index < kNumKeySchedules)
+    {
+        keySchedule = (aKeyOffset == kMacKeyOffset) ? &mMacKeySchedules[index] : &mMleKeySchedules[index];
+    }
+    else
+#endif
+    {
+        if (aKeySequence != mKeySequence)
+        {
+            ComputeKey(aKeySequence, mTemporaryKey);
+            key = mTemporaryKey;
+        }
+
+        keySchedule->SetKey(key + aKeyOffset, 8 * kKeySize);
+    }
+
+    return *keySchedule;
 }
 
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
@@ -185,6 +310,7 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 
     mKeySequence = aKeySequence;
     ComputeKey(mKeySequence, mKey);
+    UpdateKeySchedules();
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
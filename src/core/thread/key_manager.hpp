@@ -42,7 +42,9 @@
 
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
+#include "crypto/sha256.hpp"
 
 namespace ot {
 
@@ -183,6 +185,34 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the expanded AES key schedule of the MAC key for a given key sequence.
+     *
+     * The key schedules of the current, previous and next key sequences are kept up to date (see
+     * `OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE`). For any other key sequence, the key is computed and expanded into
+     * a temporary key schedule which remains valid until the next call.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES key schedule of the MAC key.
+     *
+     */
+    Crypto::AesEcb &GetMacKeySchedule(uint32_t aKeySequence) { return GetKeySchedule(aKeySequence, kMacKeyOffset); }
+
+    /**
+     * This method returns the expanded AES key schedule of the MLE key for a given key sequence.
+     *
+     * The key schedules of the current, previous and next key sequences are kept up to date (see
+     * `OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE`). For any other key sequence, the key is computed and expanded into
+     * a temporary key schedule which remains valid until the next call.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES key schedule of the MLE key.
+     *
+     */
+    Crypto::AesEcb &GetMleKeySchedule(uint32_t aKeySequence) { return GetKeySchedule(aKeySequence, kMleKeyOffset); }
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -344,11 +374,26 @@ private:
         kMinKeyRotationTime        = 1,
         kDefaultKeyRotationTime    = 672,
         kDefaultKeySwitchGuardTime = 624,
+        kMleKeyOffset              = 0,
         kMacKeyOffset              = 16,
+        kKeySize                   = 16,
+        kHmacBlockSize             = 64, ///< SHA-256 block size (bytes), the size of the HMAC pads.
         kOneHourIntervalInMsec     = 3600u * 1000u,
     };
 
-    void ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    enum
+    {
+        kPreviousKeySchedule = 0,
+        kCurrentKeySchedule  = 1,
+        kNextKeySchedule     = 2,
+        kNumKeySchedules     = 3,
+    };
+
+    void            ComputeHmacStates(void);
+    void            ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    void            DeriveKey(uint32_t aKeySequence, uint8_t *aKey);
+    void            UpdateKeySchedules(void);
+    Crypto::AesEcb &GetKeySchedule(uint32_t aKeySequence, uint8_t aKeyOffset);
 
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
@@ -361,6 +406,27 @@ private:
 
     uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
 
+    // HMAC-SHA256 states after hashing the master key XORed with the inner and the outer pad
+    Crypto::Sha256 mInnerHashState;
+    Crypto::Sha256 mOuterHashState;
+
+#if OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE
+    struct DerivedKey
+    {
+        uint32_t mKeySequence;
+        uint8_t  mKey[Crypto::HmacSha256::kHashSize];
+    };
+
+    DerivedKey mDerivedKeys[OPENTHREAD_CONFIG_DERIVED_KEY_CACHE_SIZE]; // most recently used first
+    uint8_t    mNumDerivedKeys;
+#endif
+
+#if OPENTHREAD_CONFIG_ENABLE_KEY_SCHEDULE_CACHE
+    Crypto::AesEcb mMacKeySchedules[kNumKeySchedules];
+    Crypto::AesEcb mMleKeySchedules[kNumKeySchedules];
+#endif
+    Crypto::AesEcb mTemporaryKeySchedule;
+
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
     uint32_t mStoredMacFrameCounter;
@@ -78,6 +78,7 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mRestorePanId(Mac::kPanIdBroadcast)
     , mScanning(false)
 #if OPENTHREAD_FTD
+    , mIndirectQueue(aInstance)
     , mSourceMatchController(aInstance)
     , mSendMessageFrameCounter(0)
     , mSendMessageKeyId(0)
@@ -127,6 +128,10 @@ void MeshForwarder::Stop(void)
         message->Free();
     }
 
+#if OPENTHREAD_FTD
+    mIndirectQueue.Clear();
+#endif
+
     while ((message = mReassemblyList.GetHead()) != NULL)
     {
         mReassemblyList.Dequeue(*message);
@@ -148,9 +153,9 @@ exit:
 void MeshForwarder::RemoveMessage(Message &aMessage)
 {
 #if OPENTHREAD_FTD
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
+    while (aMessage.IsChildPending())
     {
-        IgnoreReturnValue(RemoveMessageFromSleepyChild(aMessage, *iter.GetChild()));
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(aMessage, *mIndirectQueue.GetChild(aMessage)));
     }
 #endif
 
@@ -286,9 +291,19 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #endif
 
         default:
-            mSendQueue.Dequeue(*curMessage);
             LogMessage(kMessageDrop, *curMessage, NULL, error);
-            curMessage->Free();
+
+            if (curMessage->IsChildPending())
+            {
+                // Keep the message for its pending indirect transmissions.
+                curMessage->ClearDirectTransmission();
+            }
+            else
+            {
+                mSendQueue.Dequeue(*curMessage);
+                curMessage->Free();
+            }
+
             continue;
         }
     }
@@ -43,6 +43,7 @@
 #include "net/ip6.hpp"
 #include "thread/address_resolver.hpp"
 #include "thread/data_poll_manager.hpp"
+#include "thread/indirect_queue.hpp"
 #include "thread/lowpan.hpp"
 #include "thread/network_data_leader.hpp"
 #include "thread/src_match_controller.hpp"
@@ -311,6 +312,14 @@ public:
      *
      */
     const MessageQueue &GetResolvingQueue(void) const { return mResolvingQueue; }
+
+    /**
+     * This method returns a reference to the per-child indirect transmission queues.
+     *
+     * @returns  A reference to the indirect queue.
+     *
+     */
+    const IndirectQueue &GetIndirectQueue(void) const { return mIndirectQueue; }
 #endif
 
 private:
@@ -419,7 +428,10 @@ private:
                                    uint8_t                 aPriority);
     otError HandleDatagram(Message &aMessage, const otThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void    ClearReassemblyList(void);
+    otError AddMessageToSleepyChild(Message &aMessage, Child &aChild);
+    void    AddMulticastMessageToSleepyChild(Message &aMessage, Child &aChild);
     otError RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild);
+    void    RemoveMessageIfNoPendingTx(Message &aMessage);
     void    RemoveMessage(Message &aMessage);
     void    HandleDiscoverComplete(void);
 
@@ -549,6 +561,7 @@ private:
 #if OPENTHREAD_FTD
     FragmentPriorityEntry mFragmentEntries[kNumFragmentPriorityEntries];
     MessageQueue          mResolvingQueue;
+    IndirectQueue         mIndirectQueue;
     SourceMatchController mSourceMatchController;
     uint32_t              mSendMessageFrameCounter;
     uint8_t               mSendMessageKeyId;
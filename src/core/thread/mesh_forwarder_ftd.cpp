@@ -48,9 +48,8 @@ namespace ot {
 
 otError MeshForwarder::SendMessage(Message &aMessage)
 {
-    Mle::MleRouter &mle        = Get<Mle::MleRouter>();
-    ChildTable &    childTable = Get<ChildTable>();
-    otError         error      = OT_ERROR_NONE;
+    Mle::MleRouter &mle   = Get<Mle::MleRouter>();
+    otError         error = OT_ERROR_NONE;
     Neighbor *      neighbor;
 
     switch (aMessage.GetType())
@@ -86,8 +85,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
 
                         if (!child.IsRxOnWhenIdle())
                         {
-                            aMessage.SetChildMask(childTable.GetChildIndex(child));
-                            mSourceMatchController.IncrementMessageCount(child);
+                            AddMulticastMessageToSleepyChild(aMessage, child);
                         }
                     }
                 }
@@ -101,8 +99,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
 
                         if (mle.IsSleepyChildSubscribed(ip6Header.GetDestination(), child))
                         {
-                            aMessage.SetChildMask(childTable.GetChildIndex(child));
-                            mSourceMatchController.IncrementMessageCount(child);
+                            AddMulticastMessageToSleepyChild(aMessage, child);
                         }
                     }
                 }
@@ -113,8 +110,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
         {
             // destined for a sleepy child
             Child &child = *static_cast<Child *>(neighbor);
-            aMessage.SetChildMask(childTable.GetChildIndex(child));
-            mSourceMatchController.IncrementMessageCount(child);
+            SuccessOrExit(error = AddMessageToSleepyChild(aMessage, child));
         }
         else
         {
@@ -131,8 +127,7 @@ otError MeshForwarder::SendMessage(Message &aMessage)
         VerifyOrExit(child != NULL, error = OT_ERROR_DROP);
         VerifyOrExit(!child->IsRxOnWhenIdle(), error = OT_ERROR_DROP);
 
-        aMessage.SetChildMask(childTable.GetChildIndex(*child));
-        mSourceMatchController.IncrementMessageCount(*child);
+        SuccessOrExit(error = AddMessageToSleepyChild(aMessage, *child));
         break;
     }
 
@@ -192,26 +187,14 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, otError aError)
 
 void MeshForwarder::ClearChildIndirectMessages(Child &aChild)
 {
-    Message *nextMessage;
-
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    for (IndirectQueue::Iterator iter(mIndirectQueue, aChild); !iter.IsDone(); iter++)
     {
-        nextMessage = message->GetNext();
-
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        Message *message = iter.GetMessage();
 
-        if (!message->IsChildPending() && !message->GetDirectTransmission())
-        {
-            if (mSendMessage == message)
-            {
-                mSendMessage = NULL;
-            }
-
-            mSendQueue.Dequeue(*message);
-            message->Free();
-        }
+        IgnoreReturnValue(mIndirectQueue.Remove(aChild, *message));
+        RemoveMessageIfNoPendingTx(*message);
     }
 
     aChild.SetIndirectMessage(NULL);
@@ -270,14 +253,40 @@ exit:
     return error;
 }
 
-otError MeshForwarder::RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild)
+otError MeshForwarder::AddMessageToSleepyChild(Message &aMessage, Child &aChild)
 {
-    otError error      = OT_ERROR_NONE;
-    uint8_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    otError error;
+
+    SuccessOrExit(error = mIndirectQueue.Add(aChild, aMessage));
+    mSourceMatchController.IncrementMessageCount(aChild);
+
+exit:
 
-    VerifyOrExit(aMessage.GetChildMask(childIndex) == true, error = OT_ERROR_NOT_FOUND);
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnMac("Failed to queue indirect message for child 0x%04x: %s", aChild.GetRloc16(),
+                     otThreadErrorToString(error));
+    }
 
-    aMessage.ClearChildMask(childIndex);
+    return error;
+}
+
+void MeshForwarder::AddMulticastMessageToSleepyChild(Message &aMessage, Child &aChild)
+{
+    // The multicast message is still sent to the other children (and directly), so a child that cannot be queued is
+    // only counted as a transmit failure (`AddMessageToSleepyChild()` logs it).
+    if (AddMessageToSleepyChild(aMessage, aChild) != OT_ERROR_NONE)
+    {
+        mIpCounters.mTxFailure++;
+    }
+}
+
+otError MeshForwarder::RemoveMessageFromSleepyChild(Message &aMessage, Child &aChild)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aMessage.IsChildPending(), error = OT_ERROR_NOT_FOUND);
+    SuccessOrExit(error = mIndirectQueue.Remove(aChild, aMessage));
     mSourceMatchController.DecrementMessageCount(aChild);
 
     if (aChild.GetIndirectMessage() == &aMessage)
@@ -289,89 +298,110 @@ exit:
     return error;
 }
 
+void MeshForwarder::RemoveMessageIfNoPendingTx(Message &aMessage)
+{
+    VerifyOrExit(!aMessage.IsChildPending() && !aMessage.GetDirectTransmission());
+
+    if (mSendMessage == &aMessage)
+    {
+        mSendMessage = NULL;
+    }
+
+    mSendQueue.Dequeue(aMessage);
+    aMessage.Free();
+
+exit:
+    return;
+}
+
 void MeshForwarder::RemoveMessages(Child &aChild, uint8_t aSubType)
 {
     Mle::MleRouter &mle = Get<Mle::MleRouter>();
     Message *       nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    for (IndirectQueue::Iterator iter(mIndirectQueue, aChild); !iter.IsDone(); iter++)
     {
-        nextMessage = message->GetNext();
+        Message *message = iter.GetMessage();
 
         if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
         {
             continue;
         }
 
-        if (RemoveMessageFromSleepyChild(*message, aChild) != OT_ERROR_NONE)
-        {
-            switch (message->GetType())
-            {
-            case Message::kTypeIp6:
-            {
-                Ip6::Header ip6header;
-
-                IgnoreReturnValue(message->Read(0, sizeof(ip6header), &ip6header));
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, aChild));
+        RemoveMessageIfNoPendingTx(*message);
+    }
 
-                if (&aChild == static_cast<Child *>(mle.GetNeighbor(ip6header.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
-                }
+    // `SendMessage()` only queues unicast messages to a sleepy child indirectly, so the send queue is searched for
+    // direct messages only when the child is rx-on-when-idle.
+    VerifyOrExit(aChild.IsRxOnWhenIdle());
 
-                break;
-            }
+    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    {
+        nextMessage = message->GetNext();
 
-            case Message::kType6lowpan:
-            {
-                Lowpan::MeshHeader meshHeader;
+        if ((aSubType != Message::kSubTypeNone) && (aSubType != message->GetSubType()))
+        {
+            continue;
+        }
 
-                IgnoreReturnValue(meshHeader.Init(*message));
+        switch (message->GetType())
+        {
+        case Message::kTypeIp6:
+        {
+            Ip6::Header ip6header;
 
-                if (&aChild == static_cast<Child *>(mle.GetNeighbor(meshHeader.GetDestination())))
-                {
-                    message->ClearDirectTransmission();
-                }
+            IgnoreReturnValue(message->Read(0, sizeof(ip6header), &ip6header));
 
-                break;
+            if (&aChild == static_cast<Child *>(mle.GetNeighbor(ip6header.GetDestination())))
+            {
+                message->ClearDirectTransmission();
             }
 
-            default:
-                break;
-            }
+            break;
         }
 
-        if (!message->IsChildPending() && !message->GetDirectTransmission())
+        case Message::kType6lowpan:
         {
-            if (mSendMessage == message)
+            Lowpan::MeshHeader meshHeader;
+
+            IgnoreReturnValue(meshHeader.Init(*message));
+
+            if (&aChild == static_cast<Child *>(mle.GetNeighbor(meshHeader.GetDestination())))
             {
-                mSendMessage = NULL;
+                message->ClearDirectTransmission();
             }
 
-            mSendQueue.Dequeue(*message);
-            message->Free();
+            break;
+        }
+
+        default:
+            break;
         }
+
+        RemoveMessageIfNoPendingTx(*message);
     }
+
+exit:
+    return;
 }
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
     {
+        nextMessage = message->GetNext();
+
         if (message->GetSubType() != Message::kSubTypeMleDataResponse)
         {
             continue;
         }
 
-        message->Read(0, sizeof(ip6Header), &ip6Header);
-
-        if (!(ip6Header.GetDestination().IsMulticast()))
+        while (message->IsChildPending())
         {
-            for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
-            {
-                IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, *iter.GetChild()));
-            }
+            IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, *mIndirectQueue.GetChild(*message)));
         }
 
         if (mSendMessage == message)
@@ -444,29 +474,21 @@ exit:
 
 Message *MeshForwarder::GetIndirectTransmission(Child &aChild)
 {
-    Message *message = NULL;
-    Message *next;
-    uint8_t  childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    Message *message;
 
-    for (message = mSendQueue.GetHead(); message; message = next)
+    while ((message = mIndirectQueue.GetHead(aChild)) != NULL)
     {
-        next = message->GetNext();
+        // Skip and remove the supervision message if there are other messages queued for the child.
 
-        if (message->GetChildMask(childIndex))
+        if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
         {
-            // Skip and remove the supervision message if there are other messages queued for the child.
-
-            if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
-            {
-                message->ClearChildMask(childIndex);
-                mSourceMatchController.DecrementMessageCount(aChild);
-                mSendQueue.Dequeue(*message);
-                message->Free();
-                continue;
-            }
-
-            break;
+            IgnoreReturnValue(RemoveMessageFromSleepyChild(*message, aChild));
+            mSendQueue.Dequeue(*message);
+            message->Free();
+            continue;
         }
+
+        break;
     }
 
     aChild.SetIndirectMessage(message);
@@ -678,7 +700,6 @@ void MeshForwarder::HandleSentFrameToChild(const Mac::Frame &aFrame, otError aEr
     else
     {
         otError txError = aError;
-        uint8_t childIndex;
 
         if (mSendMessage == child->GetIndirectMessage())
         {
@@ -714,13 +735,7 @@ void MeshForwarder::HandleSentFrameToChild(const Mac::Frame &aFrame, otError aEr
 #endif
         }
 
-        childIndex = Get<ChildTable>().GetChildIndex(*child);
-
-        if (mSendMessage->GetChildMask(childIndex))
-        {
-            mSendMessage->ClearChildMask(childIndex);
-            mSourceMatchController.DecrementMessageCount(*child);
-        }
+        IgnoreReturnValue(RemoveMessageFromSleepyChild(*mSendMessage, *child));
 
         if (!mSendMessage->GetDirectTransmission())
         {
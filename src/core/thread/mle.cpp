@@ -2393,16 +2393,16 @@ exit:
 
 otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
 {
-    otError          error = OT_ERROR_NONE;
-    Header           header;
-    uint32_t         keySequence;
-    uint8_t          nonce[13];
-    uint8_t          tag[4];
-    uint8_t          tagLength;
-    Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
-    uint16_t         length;
-    Ip6::MessageInfo messageInfo;
+    otError                error = OT_ERROR_NONE;
+    Header                 header;
+    uint32_t               keySequence;
+    uint8_t                nonce[13];
+    uint8_t                tag[4];
+    uint8_t                tagLength;
+    Crypto::AesCcm         aesCcm;
+    Message::WritableChunk chunk;
+    uint16_t               length;
+    Ip6::MessageInfo       messageInfo;
 
     aMessage.Read(0, sizeof(header), &header);
 
@@ -2418,7 +2418,7 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(), Mac::Frame::kSecEncMic32,
                       nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey(), 16);
+        aesCcm.SetKey(Get<KeyManager>().GetMleKeySchedule(keySequence));
         error = aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1),
                             sizeof(tag), nonce, sizeof(nonce));
         assert(error == OT_ERROR_NONE);
@@ -2427,16 +2427,16 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         aesCcm.Header(&aDestination, sizeof(aDestination));
         aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
-        aMessage.SetOffset(header.GetLength() - 1);
+        length = aMessage.GetLength() - (header.GetLength() - 1);
 
-        while (aMessage.GetOffset() < aMessage.GetLength())
+        for (aMessage.GetFirstChunk(header.GetLength() - 1, length, chunk); chunk.GetLength() > 0;
+             aMessage.GetNextChunk(length, chunk))
         {
-            length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-            aesCcm.Payload(buf, buf, length, true);
-            aMessage.Write(aMessage.GetOffset(), length, buf);
-            aMessage.MoveOffset(length);
+            aesCcm.Payload(chunk.GetData(), chunk.GetData(), chunk.GetLength(), true);
         }
 
+        aMessage.SetOffset(aMessage.GetLength());
+
         tagLength = sizeof(tag);
         aesCcm.Finalize(tag, &tagLength);
         SuccessOrExit(error = aMessage.Append(tag, tagLength));
@@ -2495,21 +2495,23 @@ void Mle::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageI
 
 void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    Header          header;
-    uint32_t        keySequence;
-    const uint8_t * mleKey;
-    uint32_t        frameCounter;
-    uint8_t         messageTag[4];
-    uint8_t         nonce[13];
-    Mac::ExtAddress macAddr;
-    Crypto::AesCcm  aesCcm;
-    uint16_t        mleOffset;
-    uint8_t         buf[64];
-    uint16_t        length;
-    uint8_t         tag[4];
-    uint8_t         tagLength;
-    uint8_t         command;
-    Neighbor *      neighbor;
+    Header                 header;
+    uint32_t               keySequence;
+    uint32_t               frameCounter;
+    uint8_t                messageTag[4];
+    uint8_t                nonce[13];
+    Mac::ExtAddress        macAddr;
+    Crypto::AesCcm         aesCcm;
+    uint16_t               mleOffset;
+    Message::WritableChunk chunk;
+    uint16_t               length;
+    uint8_t                tag[4];
+    uint8_t                tagLength;
+    uint8_t                command;
+    Neighbor *             neighbor;
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+    uint8_t buf[64];
+#endif
 
     VerifyOrExit(aMessageInfo.GetLinkInfo() != NULL);
     VerifyOrExit(aMessageInfo.GetHopLimit() == kMleHopLimit);
@@ -2542,15 +2544,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     keySequence = header.GetKeyId();
 
-    if (keySequence == Get<KeyManager>().GetCurrentKeySequence())
-    {
-        mleKey = Get<KeyManager>().GetCurrentMleKey();
-    }
-    else
-    {
-        mleKey = Get<KeyManager>().GetTemporaryMleKey(keySequence);
-    }
-
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength());
     aMessage.MoveOffset(header.GetLength() - 1);
 
@@ -2561,7 +2554,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     GenerateNonce(macAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(mleKey, 16);
+    aesCcm.SetKey(Get<KeyManager>().GetMleKeySchedule(keySequence));
     SuccessOrExit(
         aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                     aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce)));
@@ -2571,15 +2564,27 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
     mleOffset = aMessage.GetOffset();
+    length    = aMessage.GetLength() - mleOffset;
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
+    for (aMessage.GetFirstChunk(mleOffset, length, chunk); chunk.GetLength() > 0; aMessage.GetNextChunk(length, chunk))
     {
-        length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-        aesCcm.Payload(buf, buf, length, false);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.Write(aMessage.GetOffset(), length, buf);
+        aesCcm.Payload(chunk.GetData(), chunk.GetData(), chunk.GetLength(), false);
+#else
+        // Leave the message unmodified, decrypting only to update the tag.
+        for (uint16_t offset = 0; offset < chunk.GetLength(); offset += sizeof(buf))
+        {
+            uint16_t bufLength = chunk.GetLength() - offset;
+
+            if (bufLength > sizeof(buf))
+            {
+                bufLength = sizeof(buf);
+            }
+
+            memcpy(buf, chunk.GetData() + offset, bufLength);
+            aesCcm.Payload(buf, buf, bufLength, false);
+        }
 #endif
-        aMessage.MoveOffset(length);
     }
 
     tagLength = sizeof(tag);
@@ -1632,11 +1632,11 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
         memset(child, 0, sizeof(*child));
 
         // MAC Address
-        child->SetExtAddress(macAddr);
+        mChildTable.SetChildExtAddress(*child, macAddr);
         child->GetLinkInfo().Clear();
         child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
         child->ResetLinkFailures();
-        child->SetState(Neighbor::kStateParentRequest);
+        mChildTable.SetChildState(*child, Neighbor::kStateParentRequest);
         child->SetDataRequestPending(false);
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
         if (Tlv::GetTlv(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
@@ -2149,7 +2149,7 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
 
     if (child->GetState() != Neighbor::kStateValid)
     {
-        child->SetState(Neighbor::kStateChildIdRequest);
+        mChildTable.SetChildState(*child, Neighbor::kStateChildIdRequest);
     }
     else
     {
@@ -2198,7 +2198,7 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
         break;
 
     case OT_DEVICE_ROLE_CHILD:
-        child->SetState(Neighbor::kStateChildIdRequest);
+        mChildTable.SetChildState(*child, Neighbor::kStateChildIdRequest);
         BecomeRouter(ThreadStatusTlv::kHaveChildIdRequest);
         break;
 
@@ -2820,7 +2820,7 @@ otError MleRouter::SendChildIdResponse(Child &aChild)
         } while (mChildTable.FindChild(rloc16, ChildTable::kInStateAnyExceptInvalid) != NULL);
 
         // allocate Child ID
-        aChild.SetRloc16(rloc16);
+        mChildTable.SetChildRloc16(aChild, rloc16);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild.GetRloc16()));
@@ -2895,11 +2895,11 @@ otError MleRouter::SendChildUpdateRequest(Child &aChild)
 
     if (!aChild.IsRxOnWhenIdle())
     {
-        uint8_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
-
-        for (message = Get<MeshForwarder>().GetSendQueue().GetHead(); message; message = message->GetNext())
+        for (IndirectQueue::Iterator iter(Get<MeshForwarder>().GetIndirectQueue(), aChild); !iter.IsDone(); iter++)
         {
-            if (message->GetChildMask(childIndex) && message->GetSubType() == Message::kSubTypeMleChildUpdateRequest)
+            message = iter.GetMessage();
+
+            if (message->GetSubType() == Message::kSubTypeMleChildUpdateRequest)
             {
                 // No need to send the resync "Child Update Request" to the sleepy child
                 // if there is one already queued.
@@ -2939,7 +2939,7 @@ otError MleRouter::SendChildUpdateRequest(Child &aChild)
     if (aChild.IsRxOnWhenIdle())
     {
         // only try to send a single Child Update Request message to an rx-on-when-idle child
-        aChild.SetState(Child::kStateChildUpdateRequest);
+        mChildTable.SetChildState(aChild, Child::kStateChildUpdateRequest);
     }
 
     LogMleMessage("Send Child Update Request to child", destination, aChild.GetRloc16());
@@ -3157,7 +3157,7 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
                 SignalChildUpdated(OT_THREAD_CHILD_TABLE_EVENT_CHILD_REMOVED, static_cast<Child &>(aNeighbor));
             }
 
-            aNeighbor.SetState(Neighbor::kStateInvalid);
+            mChildTable.SetChildState(static_cast<Child &>(aNeighbor), Neighbor::kStateInvalid);
 
             Get<MeshForwarder>().ClearChildIndirectMessages(static_cast<Child &>(aNeighbor));
             Get<NetworkData::Leader>().SendServerDataNotification(aNeighbor.GetRloc16());
@@ -3179,7 +3179,15 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
     }
 
     aNeighbor.GetLinkInfo().Clear();
-    aNeighbor.SetState(Neighbor::kStateInvalid);
+
+    if (mChildTable.Contains(aNeighbor))
+    {
+        mChildTable.SetChildState(static_cast<Child &>(aNeighbor), Neighbor::kStateInvalid);
+    }
+    else
+    {
+        aNeighbor.SetState(Neighbor::kStateInvalid);
+    }
 }
 
 Neighbor *MleRouter::GetNeighbor(uint16_t aAddress)
@@ -3525,12 +3533,12 @@ void MleRouter::RestoreChildren(void)
 
         memset(child, 0, sizeof(*child));
 
-        child->SetExtAddress(*static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
+        mChildTable.SetChildExtAddress(*child, *static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
         child->GetLinkInfo().Clear();
-        child->SetRloc16(childInfo.mRloc16);
+        mChildTable.SetChildRloc16(*child, childInfo.mRloc16);
         child->SetTimeout(childInfo.mTimeout);
         child->SetDeviceMode(childInfo.mMode);
-        child->SetState(Neighbor::kStateRestored);
+        mChildTable.SetChildState(*child, Neighbor::kStateRestored);
         child->SetLastHeard(TimerMilli::GetNow());
         Get<SourceMatchController>().SetSrcMatchAsShort(*child, true);
         numChildren++;
@@ -3569,8 +3577,11 @@ exit:
 
 otError MleRouter::StoreChild(const Child &aChild)
 {
+    otError             error;
     Settings::ChildInfo childInfo;
 
+    Get<Settings>().BeginChange();
+
     IgnoreReturnValue(RemoveStoredChild(aChild.GetRloc16()));
 
     memset(&childInfo, 0, sizeof(childInfo));
@@ -3579,13 +3590,19 @@ otError MleRouter::StoreChild(const Child &aChild)
     childInfo.mRloc16     = aChild.GetRloc16();
     childInfo.mMode       = aChild.GetDeviceMode();
 
-    return Get<Settings>().AddChildInfo(childInfo);
+    error = Get<Settings>().AddChildInfo(childInfo);
+
+    Get<Settings>().CommitChange();
+
+    return error;
 }
 
 otError MleRouter::RefreshStoredChildren(void)
 {
     otError error = OT_ERROR_NONE;
 
+    Get<Settings>().BeginChange();
+
     SuccessOrExit(error = Get<Settings>().DeleteChildInfo());
 
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
@@ -3594,6 +3611,7 @@ otError MleRouter::RefreshStoredChildren(void)
     }
 
 exit:
+    Get<Settings>().CommitChange();
     return error;
 }
 
@@ -4542,7 +4560,7 @@ void MleRouter::SetChildStateToValid(Child &aChild)
 {
     VerifyOrExit(aChild.GetState() != Neighbor::kStateValid);
 
-    aChild.SetState(Neighbor::kStateValid);
+    mChildTable.SetChildState(aChild, Neighbor::kStateValid);
     StoreChild(aChild);
     SignalChildUpdated(OT_THREAD_CHILD_TABLE_EVENT_CHILD_ADDED, aChild);
 
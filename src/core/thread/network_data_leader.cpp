@@ -58,6 +58,9 @@ namespace NetworkData {
 
 LeaderBase::LeaderBase(Instance &aInstance)
     : NetworkData(aInstance, kTypeLeader)
+    , mNumPrefixEntries(0)
+    , mNumContextEntries(0)
+    , mIndexValid(false)
 {
     Reset();
 }
@@ -67,23 +70,34 @@ void LeaderBase::Reset(void)
     mVersion       = static_cast<uint8_t>(otPlatRandomGet());
     mStableVersion = static_cast<uint8_t>(otPlatRandomGet());
     mLength        = 0;
+    mIndexValid    = false;
     Get<Notifier>().Signal(OT_CHANGED_THREAD_NETDATA);
 }
 
-otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+void LeaderBase::Insert(uint8_t *aStart, uint8_t aLength)
 {
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    NetworkData::Insert(aStart, aLength);
+    mIndexValid = false;
+}
 
-    aContext.mPrefixLength = 0;
+void LeaderBase::Remove(uint8_t *aStart, uint8_t aLength)
+{
+    NetworkData::Remove(aStart, aLength);
+    mIndexValid = false;
+}
 
-    if (PrefixMatch(Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, aAddress.mFields.m8, 64) >= 0)
-    {
-        aContext.mPrefix       = Get<Mle::MleRouter>().GetMeshLocalPrefix().m8;
-        aContext.mPrefixLength = 64;
-        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
-        aContext.mCompressFlag = true;
-    }
+void LeaderBase::UpdateIndex(void)
+{
+    PrefixTlv *      prefix;
+    ContextTlv *     contextTlv;
+    BorderRouterTlv *borderRouter;
+    PrefixEntry *    entry;
+
+    VerifyOrExit(!mIndexValid);
+
+    mNumPrefixEntries  = 0;
+    mNumContextEntries = 0;
+    memset(mContextIdEntries, kInvalidEntry, sizeof(mContextIdEntries));
 
     for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
          cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
@@ -94,74 +108,171 @@ otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aC
         }
 
         prefix = static_cast<PrefixTlv *>(cur);
+        entry  = &mPrefixEntries[mNumPrefixEntries];
+
+        entry->mPrefixOffset  = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(prefix) - mTlvs);
+        entry->mContextOffset = 0;
+        entry->mFlags         = 0;
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        for (NetworkDataTlv *subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
         {
-            continue;
-        }
+            switch (subCur->GetType())
+            {
+            case NetworkDataTlv::kTypeContext:
+                if ((entry->mFlags & kFlagContext) == 0)
+                {
+                    entry->mContextOffset = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(subCur) - mTlvs);
+                    entry->mFlags |= kFlagContext;
+                }
 
-        contextTlv = FindContext(*prefix);
+                break;
 
-        if (contextTlv == NULL)
-        {
-            continue;
+            case NetworkDataTlv::kTypeBorderRouter:
+                borderRouter = static_cast<BorderRouterTlv *>(subCur);
+                entry->mFlags |= kFlagBorderRouter;
+
+                for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
+                {
+                    if (borderRouter->GetEntry(i)->IsDefaultRoute())
+                    {
+                        entry->mFlags |= kFlagDefaultRoute;
+                        break;
+                    }
+                }
+
+                break;
+
+            case NetworkDataTlv::kTypeHasRoute:
+                entry->mFlags |= kFlagHasRoute;
+                break;
+
+            default:
+                break;
+            }
         }
 
-        if (prefix->GetPrefixLength() > aContext.mPrefixLength)
+        if (entry->mFlags & kFlagContext)
         {
-            aContext.mPrefix       = prefix->GetPrefix();
-            aContext.mPrefixLength = prefix->GetPrefixLength();
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            uint8_t index;
+
+            contextTlv = &GetContextTlv(*entry);
+
+            if (mContextIdEntries[contextTlv->GetContextId()] == kInvalidEntry)
+            {
+                mContextIdEntries[contextTlv->GetContextId()] = mNumPrefixEntries;
+            }
+
+            // Keep the context entries sorted by prefix length (longest first), and in Network Data order among
+            // prefixes of equal length.
+            for (index = mNumContextEntries; index > 0; index--)
+            {
+                if (GetPrefixTlv(mPrefixEntries[mContextEntries[index - 1]]).GetPrefixLength() >=
+                    prefix->GetPrefixLength())
+                {
+                    break;
+                }
+
+                mContextEntries[index] = mContextEntries[index - 1];
+            }
+
+            mContextEntries[index] = mNumPrefixEntries;
+            mNumContextEntries++;
         }
+
+        mNumPrefixEntries++;
     }
 
-    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+    mIndexValid = true;
+
+exit:
+    return;
 }
 
-otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+bool LeaderBase::ContainsAddress(PrefixTlv &aPrefix, const Ip6::Address &aAddress)
 {
-    otError     error = OT_ERROR_NOT_FOUND;
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    uint8_t bytes = aPrefix.GetPrefixLength() / CHAR_BIT;
+    uint8_t bits  = aPrefix.GetPrefixLength() % CHAR_BIT;
+    bool    rval;
 
-    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    rval = (memcmp(aPrefix.GetPrefix(), aAddress.mFields.m8, bytes) == 0);
+
+    if (rval && bits != 0)
+    {
+        uint8_t mask = static_cast<uint8_t>(0xff << (CHAR_BIT - bits));
+
+        rval = ((aPrefix.GetPrefix()[bytes] ^ aAddress.mFields.m8[bytes]) & mask) == 0;
+    }
+
+    return rval;
+}
+
+void LeaderBase::FillContext(const PrefixEntry &aEntry, Lowpan::Context &aContext)
+{
+    PrefixTlv & prefix     = GetPrefixTlv(aEntry);
+    ContextTlv &contextTlv = GetContextTlv(aEntry);
+
+    aContext.mPrefix       = prefix.GetPrefix();
+    aContext.mPrefixLength = prefix.GetPrefixLength();
+    aContext.mContextId    = contextTlv.GetContextId();
+    aContext.mCompressFlag = contextTlv.IsCompress();
+}
+
+otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+{
+    aContext.mPrefixLength = 0;
+
+    if (memcmp(Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, aAddress.mFields.m8, sizeof(otMeshLocalPrefix)) == 0)
     {
         aContext.mPrefix       = Get<Mle::MleRouter>().GetMeshLocalPrefix().m8;
         aContext.mPrefixLength = 64;
         aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
         aContext.mCompressFlag = true;
-        ExitNow(error = OT_ERROR_NONE);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateIndex();
 
-        prefix     = static_cast<PrefixTlv *>(cur);
-        contextTlv = FindContext(*prefix);
+    // Context entries are sorted by prefix length, so the first match is the longest one.
+    for (uint8_t i = 0; i < mNumContextEntries; i++)
+    {
+        const PrefixEntry &entry  = mPrefixEntries[mContextEntries[i]];
+        PrefixTlv &        prefix = GetPrefixTlv(entry);
 
-        if (contextTlv == NULL)
+        if (prefix.GetPrefixLength() <= aContext.mPrefixLength)
         {
-            continue;
+            break;
         }
 
-        if (contextTlv->GetContextId() != aContextId)
+        if (ContainsAddress(prefix, aAddress))
         {
-            continue;
+            FillContext(entry, aContext);
+            break;
         }
+    }
+
+    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+}
+
+otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+{
+    otError error = OT_ERROR_NOT_FOUND;
 
-        aContext.mPrefix       = prefix->GetPrefix();
-        aContext.mPrefixLength = prefix->GetPrefixLength();
-        aContext.mContextId    = contextTlv->GetContextId();
-        aContext.mCompressFlag = contextTlv->IsCompress();
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        aContext.mPrefix       = Get<Mle::MleRouter>().GetMeshLocalPrefix().m8;
+        aContext.mPrefixLength = 64;
+        aContext.mContextId    = Mle::kMeshLocalPrefixContextId;
+        aContext.mCompressFlag = true;
         ExitNow(error = OT_ERROR_NONE);
     }
 
+    VerifyOrExit(aContextId < kNumContextIds);
+
+    UpdateIndex();
+
+    VerifyOrExit(mContextIdEntries[aContextId] != kInvalidEntry);
+    FillContext(mPrefixEntries[mContextIdEntries[aContextId]], aContext);
+    error = OT_ERROR_NONE;
+
 exit:
     return error;
 }
@@ -195,35 +306,26 @@ exit:
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress)
 {
-    PrefixTlv *prefix;
-    bool       rval = false;
+    bool rval = false;
 
     if (memcmp(aAddress.mFields.m8, Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, sizeof(otMeshLocalPrefix)) == 0)
     {
         ExitNow(rval = true);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
-
-        prefix = static_cast<PrefixTlv *>(cur);
+    UpdateIndex();
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
+    {
+        if ((mPrefixEntries[i].mFlags & kFlagBorderRouter) == 0)
         {
             continue;
         }
 
-        if (FindBorderRouter(*prefix) == NULL)
+        if (ContainsAddress(GetPrefixTlv(mPrefixEntries[i]), aAddress))
         {
-            continue;
+            ExitNow(rval = true);
         }
-
-        ExitNow(rval = true);
     }
 
 exit:
@@ -238,24 +340,20 @@ otError LeaderBase::RouteLookup(const Ip6::Address &aSource,
     otError    error = OT_ERROR_NO_ROUTE;
     PrefixTlv *prefix;
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateIndex();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
+    {
+        prefix = &GetPrefixTlv(mPrefixEntries[i]);
 
-        if (PrefixMatch(prefix->GetPrefix(), aSource.mFields.m8, prefix->GetPrefixLength()) >= 0)
+        if (ContainsAddress(*prefix, aSource))
         {
             if (ExternalRouteLookup(prefix->GetDomainId(), aDestination, aPrefixMatch, aRloc16) == OT_ERROR_NONE)
             {
                 ExitNow(error = OT_ERROR_NONE);
             }
 
-            if (DefaultRouteLookup(*prefix, aRloc16) == OT_ERROR_NONE)
+            if ((mPrefixEntries[i].mFlags & kFlagDefaultRoute) && DefaultRouteLookup(*prefix, aRloc16) == OT_ERROR_NONE)
             {
                 if (aPrefixMatch)
                 {
@@ -283,20 +381,19 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
     HasRouteEntry * rvalRoute = NULL;
     uint8_t         rval_plen = 0;
     int8_t          plen;
-    NetworkDataTlv *cur;
     NetworkDataTlv *subCur;
 
-    for (cur = reinterpret_cast<NetworkDataTlv *>(mTlvs); cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
+    // The caller is responsible for updating the lookup index.
+    for (uint8_t i = 0; i < mNumPrefixEntries; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
+        if ((mPrefixEntries[i].mFlags & kFlagHasRoute) == 0)
         {
             continue;
         }
 
-        prefix = static_cast<PrefixTlv *>(cur);
+        prefix = &GetPrefixTlv(mPrefixEntries[i]);
 
-        if (prefix->GetDomainId() != aDomainId)
+        if (prefix->GetDomainId() != aDomainId || !ContainsAddress(*prefix, aDestination))
         {
             continue;
         }
@@ -315,9 +412,9 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
 
                 hasRoute = static_cast<HasRouteTlv *>(subCur);
 
-                for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+                for (uint8_t j = 0; j < hasRoute->GetNumEntries(); j++)
                 {
-                    entry = hasRoute->GetEntry(i);
+                    entry = hasRoute->GetEntry(j);
 
                     if (rvalRoute == NULL || entry->GetPreference() > rvalRoute->GetPreference() ||
                         (entry->GetPreference() == rvalRoute->GetPreference() &&
@@ -414,6 +511,8 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     length = aMessage.Read(aMessageOffset, sizeof(tlv), &tlv);
     VerifyOrExit(length == sizeof(tlv), error = OT_ERROR_PARSE);
 
+    mIndexValid = false;
+
     length = aMessage.Read(aMessageOffset + sizeof(tlv), tlv.GetLength(), mTlvs);
     VerifyOrExit(length == tlv.GetLength(), error = OT_ERROR_PARSE);
 
@@ -232,10 +232,67 @@ public:
 #endif // OPENTHREAD_ENABLE_DHCP6_SERVER || OPENTHREAD_ENABLE_DHCP6_CLIENT
 
 protected:
+    /**
+     * This method inserts bytes into the Network Data and invalidates the lookup index.
+     *
+     * @param[in]  aStart   A pointer to the beginning of the insertion.
+     * @param[in]  aLength  The number of bytes to insert.
+     *
+     */
+    void Insert(uint8_t *aStart, uint8_t aLength);
+
+    /**
+     * This method removes bytes from the Network Data and invalidates the lookup index.
+     *
+     * @param[in]  aStart   A pointer to the beginning of the removal.
+     * @param[in]  aLength  The number of bytes to remove.
+     *
+     */
+    void Remove(uint8_t *aStart, uint8_t aLength);
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
+    enum
+    {
+        kMaxPrefixEntries = kMaxSize / sizeof(PrefixTlv), ///< Maximum number of Prefix TLVs in the Network Data.
+        kNumContextIds    = 16,                           ///< Number of 6LoWPAN Context IDs.
+        kInvalidEntry     = 0xff,                         ///< Invalid index into `mPrefixEntries`.
+    };
+
+    enum
+    {
+        kFlagContext      = 1 << 0, ///< Prefix TLV contains a Context sub-TLV.
+        kFlagBorderRouter = 1 << 1, ///< Prefix TLV contains a Border Router sub-TLV.
+        kFlagDefaultRoute = 1 << 2, ///< Prefix TLV contains a Border Router entry offering a default route.
+        kFlagHasRoute     = 1 << 3, ///< Prefix TLV contains a Has Route sub-TLV.
+    };
+
+    /**
+     * This structure represents a Prefix TLV in the lookup index.
+     *
+     */
+    struct PrefixEntry
+    {
+        uint8_t mPrefixOffset;  ///< Offset of the Prefix TLV in `mTlvs`.
+        uint8_t mContextOffset; ///< Offset of the Context sub-TLV in `mTlvs` (valid with `kFlagContext`).
+        uint8_t mFlags;         ///< Flags describing the sub-TLVs of the Prefix TLV.
+    };
+
+    void       UpdateIndex(void);
+    PrefixTlv &GetPrefixTlv(const PrefixEntry &aEntry)
+    {
+        return *reinterpret_cast<PrefixTlv *>(mTlvs + aEntry.mPrefixOffset);
+    }
+    ContextTlv &GetContextTlv(const PrefixEntry &aEntry)
+    {
+        return *reinterpret_cast<ContextTlv *>(mTlvs + aEntry.mContextOffset);
+    }
+    void FillContext(const PrefixEntry &aEntry, Lowpan::Context &aContext);
+
+    static bool ContainsAddress(PrefixTlv &aPrefix, const Ip6::Address &aAddress);
+
     otError RemoveCommissioningData(void);
 
     otError ExternalRouteLookup(uint8_t             aDomainId,
@@ -243,6 +300,15 @@ private:
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16);
     otError DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16);
+
+    // The lookup index is a compiled view of the Prefix TLVs in `mTlvs` used by the per-packet lookups. It is
+    // invalidated whenever the Network Data changes and rebuilt on the next lookup.
+    PrefixEntry mPrefixEntries[kMaxPrefixEntries]; // Prefix TLVs in Network Data order.
+    uint8_t     mContextEntries[kMaxPrefixEntries]; // Prefix TLVs with context, longest prefix first.
+    uint8_t     mContextIdEntries[kNumContextIds];  // Maps a Context ID to its Prefix TLV.
+    uint8_t     mNumPrefixEntries;
+    uint8_t     mNumContextEntries;
+    bool        mIndexValid;
 };
 
 /**
@@ -392,6 +392,8 @@ private:
  */
 class Child : public Neighbor
 {
+    friend class ChildTable;
+
 public:
     enum
     {
@@ -818,6 +820,13 @@ public:
 #endif // #if OPENTHREAD_ENABLE_CHILD_SUPERVISION
 
 private:
+    // The child table indexes its entries by state, RLOC16 and extended address, so these only change through the
+    // `ChildTable::SetChild*()` setters.
+    using Neighbor::ClearExtAddress;
+    using Neighbor::SetExtAddress;
+    using Neighbor::SetRloc16;
+    using Neighbor::SetState;
+
 #if OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD < 2
 #error OPENTHREAD_CONFIG_IP_ADDRS_PER_CHILD should be at least set to 2.
 #endif
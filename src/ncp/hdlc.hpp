@@ -97,6 +97,31 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aData    A pointer to the bytes to write.
+     * @param[in]  aLength  The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     *
+     */
+    otError WriteBytes(const uint8_t *aData, uint16_t aLength)
+    {
+        return CanWrite(aLength) ? (memcpy(mWritePointer, aData, aLength), mWritePointer += aLength,
+                                    mRemainingLength -= aLength, OT_ERROR_NONE)
+                                 : OT_ERROR_NO_BUFS;
+    }
+
+    /**
+     * This method returns the number of bytes that can still be written into the buffer.
+     *
+     * @returns The remaining buffer space in bytes.
+     *
+     */
+    uint16_t GetRemainingLength(void) const { return mRemainingLength; }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
@@ -426,6 +451,20 @@ public:
      */
     otError Encode(const uint8_t *aData, uint16_t aLength);
 
+    /**
+     * This method encodes as much of a given block of data as fits into current frame.
+     *
+     * Unlike `Encode()`, this method keeps the encoded leading part of the block when there is not enough space for all
+     * of it, so the caller can continue from the returned position once the frame buffer has been drained.
+     *
+     * @param[in]    aData       A pointer to a buffer containing the data to encode.
+     * @param[in]    aLength     The number of bytes in @p aData.
+     *
+     * @returns The number of bytes from @p aData encoded and added to frame.
+     *
+     */
+    uint16_t EncodeUpTo(const uint8_t *aData, uint16_t aLength);
+
     /**
      * This method ends/finalizes the HDLC frame.
      *
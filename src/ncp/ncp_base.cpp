@@ -252,8 +252,12 @@ NcpBase::NcpBase(Instance *aInstance)
     , mRxSpinelOutOfOrderTidCounter(0)
     , mTxSpinelFrameCounter(0)
     , mDidInitialUpdates(false)
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    , mTxBatchingEnabled(false)
+#endif
 {
     assert(mInstance != NULL);
+    assert(AreHandlerTablesSorted());
 
     sNcpInstance = this;
 
@@ -447,6 +451,25 @@ bool NcpBase::ShouldDeferHostSend(void)
     return (mHostPowerState == SPINEL_HOST_POWER_STATE_DEEP_SLEEP && !mHostPowerStateInProgress);
 }
 
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+
+uint16_t NcpBase::ReadBatchedTxFrame(uint8_t *aBuffer, uint16_t aBufferSize)
+{
+    uint16_t length = 0;
+
+    // The host power state reply is tracked by its frame tag, so
+    // nothing is batched while a host power state change is ongoing.
+
+    VerifyOrExit(mTxBatchingEnabled && !mHostPowerStateInProgress);
+
+    length = SpinelBatcher(mTxFrameBuffer).ReadFrame(aBuffer, aBufferSize);
+
+exit:
+    return length;
+}
+
+#endif // OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+
 void NcpBase::IncrementFrameErrorCounter(void)
 {
     mFramingErrorCounter++;
@@ -943,13 +966,13 @@ exit:
 
 otError NcpBase::HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey)
 {
-    otError         error   = OT_ERROR_NONE;
-    PropertyHandler handler = FindSetPropertyHandler(aKey);
+    otError             error = OT_ERROR_NONE;
+    const HandlerEntry *entry = FindSetPropertyHandler(aKey);
 
-    if (handler != NULL)
+    if (entry != NULL)
     {
         mDisableStreamWrite = false;
-        error               = (this->*handler)();
+        error               = CallPropertyHandler(*entry);
         mDisableStreamWrite = true;
     }
     else
@@ -996,21 +1019,21 @@ exit:
 
 otError NcpBase::HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_key_t aKey, unsigned int aCommand)
 {
-    otError         error           = OT_ERROR_NONE;
-    PropertyHandler handler         = NULL;
-    unsigned int    responseCommand = 0;
-    const uint8_t * valuePtr;
-    uint16_t        valueLen;
+    otError             error           = OT_ERROR_NONE;
+    const HandlerEntry *entry           = NULL;
+    unsigned int        responseCommand = 0;
+    const uint8_t *     valuePtr;
+    uint16_t            valueLen;
 
     switch (aCommand)
     {
     case SPINEL_CMD_PROP_VALUE_INSERT:
-        handler         = FindInsertPropertyHandler(aKey);
+        entry           = FindInsertPropertyHandler(aKey);
         responseCommand = SPINEL_CMD_PROP_VALUE_INSERTED;
         break;
 
     case SPINEL_CMD_PROP_VALUE_REMOVE:
-        handler         = FindRemovePropertyHandler(aKey);
+        entry           = FindRemovePropertyHandler(aKey);
         responseCommand = SPINEL_CMD_PROP_VALUE_REMOVED;
         break;
 
@@ -1019,7 +1042,7 @@ otError NcpBase::HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_
         break;
     }
 
-    VerifyOrExit(handler != NULL, error = PrepareLastStatusResponse(aHeader, SPINEL_STATUS_PROP_NOT_FOUND));
+    VerifyOrExit(entry != NULL, error = PrepareLastStatusResponse(aHeader, SPINEL_STATUS_PROP_NOT_FOUND));
 
     // Save current read position in the decoder. Read the entire
     // content as a data blob (which is used in forming the response
@@ -1032,7 +1055,7 @@ otError NcpBase::HandleCommandPropertyInsertRemove(uint8_t aHeader, spinel_prop_
 
     mDisableStreamWrite = false;
 
-    error = (this->*handler)();
+    error = CallPropertyHandler(*entry);
 
     mDisableStreamWrite = true;
 
@@ -1075,13 +1098,13 @@ exit:
 
 otError NcpBase::WritePropertyValueIsFrame(uint8_t aHeader, spinel_prop_key_t aPropKey, bool aIsGetResponse)
 {
-    otError         error   = OT_ERROR_NONE;
-    PropertyHandler handler = FindGetPropertyHandler(aPropKey);
+    otError             error = OT_ERROR_NONE;
+    const HandlerEntry *entry = FindGetPropertyHandler(aPropKey);
 
-    if (handler != NULL)
+    if (entry != NULL)
     {
         SuccessOrExit(error = mEncoder.BeginFrame(aHeader, SPINEL_CMD_PROP_VALUE_IS, aPropKey));
-        SuccessOrExit(error = (this->*handler)());
+        SuccessOrExit(error = CallPropertyHandler(*entry));
         ExitNow(error = mEncoder.EndFrame());
     }
 
@@ -1611,6 +1634,18 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_UNSOL_BATCHING_ENABLED>(void)
+{
+    return mEncoder.WriteBool(mTxBatchingEnabled);
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_UNSOL_BATCHING_ENABLED>(void)
+{
+    return mDecoder.ReadBool(mTxBatchingEnabled);
+}
+#endif
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_UNSOL_UPDATE_FILTER>(void)
 {
     otError                       error = OT_ERROR_NONE;
@@ -1720,6 +1755,10 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_COUNTERS));
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_UPDATE_FILTER));
 
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_UNSOL_BATCHING));
+#endif
+
 #if OPENTHREAD_CONFIG_NCP_ENABLE_MCU_POWER_STATE_CONTROL
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_MCU_POWER_STATE));
 #endif
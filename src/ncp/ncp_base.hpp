@@ -50,6 +50,7 @@
 #include "common/instance.hpp"
 #include "common/tasklet.hpp"
 #include "ncp/ncp_buffer.hpp"
+#include "ncp/spinel_batcher.hpp"
 #include "ncp/spinel_decoder.hpp"
 #include "ncp/spinel_encoder.hpp"
 #include "utils/static_assert.hpp"
@@ -171,9 +172,70 @@ public:
      */
     bool ShouldDeferHostSend(void);
 
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    /**
+     * Called by the subclass to learn whether the host has enabled batching of unsolicited frames.
+     */
+    bool IsTxBatchingEnabled(void) const { return mTxBatchingEnabled; }
+
+    /**
+     * Called by the subclass to read the next outbound frame, coalescing it with the unsolicited `VALUE_IS` frames
+     * queued behind it into a single `VALUES_ARE` frame.
+     *
+     * The frames copied into @p aBuffer are removed from the tx frame buffer. When zero is returned nothing is
+     * removed, and the subclass reads the frame at the head of the tx frame buffer as usual.
+     *
+     * @param[out] aBuffer      A pointer to a buffer to write the frame to.
+     * @param[in]  aBufferSize  The size of @p aBuffer (the maximum batched frame length).
+     *
+     * @returns The length of the frame written to @p aBuffer, or zero if the head frame is not batched.
+     */
+    uint16_t ReadBatchedTxFrame(uint8_t *aBuffer, uint16_t aBufferSize);
+#endif
+
 protected:
     typedef otError (NcpBase::*PropertyHandler)(void);
 
+    /**
+     * This struct represents a property handler table entry.
+     *
+     * The handler tables are sorted by property key so that a handler can be looked up using a binary search.
+     *
+     */
+    struct HandlerEntry
+    {
+        spinel_prop_key_t mKey;     ///< The property key.
+        PropertyHandler   mHandler; ///< The handler for the property.
+    };
+
+    /**
+     * This struct describes a property handler table.
+     *
+     */
+    struct HandlerTable
+    {
+        uint8_t             mCommand; ///< The spinel command served by the handlers (e.g. `SPINEL_CMD_PROP_VALUE_GET`).
+        const HandlerEntry *mEntries; ///< The handler entries, sorted by property key.
+        uint16_t            mLength;  ///< Number of entries in `mEntries`.
+    };
+
+    enum
+    {
+        kNumHandlerTables = 4, ///< One table for each of the get, set, insert and remove commands.
+    };
+
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    /**
+     * This struct represents the call statistics of a property handler.
+     *
+     */
+    struct PropertyStats
+    {
+        uint32_t mCount; ///< Number of calls to the handler.
+        uint32_t mTime;  ///< Cumulative time spent in the handler (in microseconds).
+    };
+#endif
+
     /**
      * This enumeration represents the `ResponseEntry` type.
      *
@@ -201,10 +263,17 @@ protected:
 
     otError HandleCommand(uint8_t aHeader);
 
-    PropertyHandler FindGetPropertyHandler(spinel_prop_key_t aKey);
-    PropertyHandler FindSetPropertyHandler(spinel_prop_key_t aKey);
-    PropertyHandler FindInsertPropertyHandler(spinel_prop_key_t aKey);
-    PropertyHandler FindRemovePropertyHandler(spinel_prop_key_t aKey);
+    static const HandlerEntry *FindHandlerEntry(const HandlerEntry *aTable, uint16_t aLength, spinel_prop_key_t aKey);
+    static const HandlerEntry *FindGetPropertyHandler(spinel_prop_key_t aKey);
+    static const HandlerEntry *FindSetPropertyHandler(spinel_prop_key_t aKey);
+    static const HandlerEntry *FindInsertPropertyHandler(spinel_prop_key_t aKey);
+    static const HandlerEntry *FindRemovePropertyHandler(spinel_prop_key_t aKey);
+    static bool                AreHandlerTablesSorted(void);
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    static PropertyStats *FindPropertyStats(const HandlerEntry &aEntry);
+#endif
+
+    otError CallPropertyHandler(const HandlerEntry &aEntry);
 
     bool    HandlePropertySetForSpecialProperties(uint8_t aHeader, spinel_prop_key_t aKey, otError &aError);
     otError HandleCommandPropertySet(uint8_t aHeader, spinel_prop_key_t aKey);
@@ -584,6 +653,19 @@ protected:
     uint32_t mTxSpinelFrameCounter;         // Number of sent (outbound) spinel frames.
 
     bool mDidInitialUpdates;
+
+    static const HandlerEntry sGetHandlerTable[];
+    static const HandlerEntry sSetHandlerTable[];
+    static const HandlerEntry sInsertHandlerTable[];
+    static const HandlerEntry sRemoveHandlerTable[];
+    static const HandlerTable sHandlerTables[kNumHandlerTables];
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    static PropertyStats sPropertyStats[];
+#endif
+
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    bool mTxBatchingEnabled;
+#endif
 };
 
 } // namespace Ncp
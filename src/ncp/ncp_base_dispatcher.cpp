@@ -32,1149 +32,765 @@
 
 #include "ncp_base.hpp"
 
+#include "common/code_utils.hpp"
+#include "common/timer.hpp"
+
 namespace ot {
 namespace Ncp {
 
-NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
-{
-    NcpBase::PropertyHandler handler;
+#define OT_NCP_GET_HANDLER_ENTRY(aPropertyName) {aPropertyName, &NcpBase::HandlePropertyGet<aPropertyName>}
 
-    switch (aKey)
-    {
-        // --------------------------------------------------------------------------
-        // Common Properties (Get Handler)
+#define OT_NCP_SET_HANDLER_ENTRY(aPropertyName) {aPropertyName, &NcpBase::HandlePropertySet<aPropertyName>}
 
-    case SPINEL_PROP_CAPS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>;
-        break;
-    case SPINEL_PROP_DEBUG_TEST_ASSERT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_TEST_ASSERT>;
-        break;
-    case SPINEL_PROP_DEBUG_TEST_WATCHDOG:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_TEST_WATCHDOG>;
-        break;
-    case SPINEL_PROP_DEBUG_NCP_LOG_LEVEL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_LOG_LEVEL>;
-        break;
-    case SPINEL_PROP_HWADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_HWADDR>;
-        break;
-    case SPINEL_PROP_HOST_POWER_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_HOST_POWER_STATE>;
-        break;
-    case SPINEL_PROP_INTERFACE_COUNT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_INTERFACE_COUNT>;
-        break;
-    case SPINEL_PROP_INTERFACE_TYPE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_INTERFACE_TYPE>;
-        break;
-    case SPINEL_PROP_LAST_STATUS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_LAST_STATUS>;
-        break;
-    case SPINEL_PROP_LOCK:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_LOCK>;
-        break;
-    case SPINEL_PROP_PHY_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_ENABLED>;
-        break;
-    case SPINEL_PROP_PHY_CHAN:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_CHAN>;
-        break;
-    case SPINEL_PROP_PHY_RSSI:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_RSSI>;
-        break;
-    case SPINEL_PROP_PHY_RX_SENSITIVITY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_RX_SENSITIVITY>;
-        break;
-    case SPINEL_PROP_PHY_TX_POWER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_TX_POWER>;
-        break;
-    case SPINEL_PROP_POWER_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_POWER_STATE>;
-        break;
-    case SPINEL_PROP_MCU_POWER_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MCU_POWER_STATE>;
-        break;
-    case SPINEL_PROP_PROTOCOL_VERSION:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PROTOCOL_VERSION>;
-        break;
-    case SPINEL_PROP_MAC_15_4_PANID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_15_4_PANID>;
-        break;
-    case SPINEL_PROP_MAC_15_4_LADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_15_4_LADDR>;
-        break;
-    case SPINEL_PROP_MAC_15_4_SADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_15_4_SADDR>;
-        break;
-    case SPINEL_PROP_MAC_RAW_STREAM_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_RAW_STREAM_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_PROMISCUOUS_MODE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_PROMISCUOUS_MODE>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SCAN_STATE>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_MASK:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SCAN_MASK>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_PERIOD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SCAN_PERIOD>;
-        break;
-    case SPINEL_PROP_NCP_VERSION:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NCP_VERSION>;
-        break;
-    case SPINEL_PROP_UNSOL_UPDATE_FILTER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_UNSOL_UPDATE_FILTER>;
-        break;
-    case SPINEL_PROP_UNSOL_UPDATE_LIST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_UNSOL_UPDATE_LIST>;
-        break;
-    case SPINEL_PROP_VENDOR_ID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_VENDOR_ID>;
-        break;
-    case SPINEL_PROP_PHY_CHAN_SUPPORTED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_CHAN_SUPPORTED>;
-        break;
-    case SPINEL_PROP_PHY_CHAN_PREFERRED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_CHAN_PREFERRED>;
-        break;
+#define OT_NCP_INSERT_HANDLER_ENTRY(aPropertyName) {aPropertyName, &NcpBase::HandlePropertyInsert<aPropertyName>}
 
-        // --------------------------------------------------------------------------
-        // MTD (or FTD) Properties (Get Handler)
+#define OT_NCP_REMOVE_HANDLER_ENTRY(aPropertyName) {aPropertyName, &NcpBase::HandlePropertyRemove<aPropertyName>}
+
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS>(void);
+#endif
 
+// ----------------------------------------------------------------------------
+// MARK: Property Handler Tables
+// ----------------------------------------------------------------------------
+
+// The tables below MUST be kept sorted by property key (`FindHandlerEntry()`
+// performs a binary search). This is verified by `AreHandlerTablesSorted()`
+// (asserted when `NcpBase` is constructed).
+
+const NcpBase::HandlerEntry NcpBase::sGetHandlerTable[] = {
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_LAST_STATUS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PROTOCOL_VERSION),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NCP_VERSION),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_INTERFACE_TYPE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_VENDOR_ID),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CAPS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_INTERFACE_COUNT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_POWER_STATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_HWADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_LOCK),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_HOST_POWER_STATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MCU_POWER_STATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_ENABLED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_CHAN),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_CHAN_SUPPORTED),
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-    case SPINEL_PROP_PHY_PCAP_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_PCAP_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_DATA_POLL_PERIOD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_DATA_POLL_PERIOD>;
-        break;
-    case SPINEL_PROP_MAC_EXTENDED_ADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_EXTENDED_ADDR>;
-        break;
-    case SPINEL_PROP_MAC_CCA_FAILURE_RATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_CCA_FAILURE_RATE>;
-        break;
-#if OPENTHREAD_ENABLE_MAC_FILTER
-    case SPINEL_PROP_MAC_BLACKLIST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_BLACKLIST>;
-        break;
-    case SPINEL_PROP_MAC_BLACKLIST_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_BLACKLIST_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_FIXED_RSS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_FIXED_RSS>;
-        break;
-    case SPINEL_PROP_MAC_WHITELIST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_WHITELIST>;
-        break;
-    case SPINEL_PROP_MAC_WHITELIST_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_WHITELIST_ENABLED>;
-        break;
-#endif
-    case SPINEL_PROP_MSG_BUFFER_COUNTERS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MSG_BUFFER_COUNTERS>;
-        break;
-    case SPINEL_PROP_PHY_FREQ:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_PHY_FREQ>;
-        break;
-    case SPINEL_PROP_NET_IF_UP:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_IF_UP>;
-        break;
-    case SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER>;
-        break;
-    case SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME>;
-        break;
-    case SPINEL_PROP_NET_MASTER_KEY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_MASTER_KEY>;
-        break;
-    case SPINEL_PROP_NET_NETWORK_NAME:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_NETWORK_NAME>;
-        break;
-    case SPINEL_PROP_NET_PARTITION_ID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_PARTITION_ID>;
-        break;
-    case SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING>;
-        break;
-    case SPINEL_PROP_NET_ROLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_ROLE>;
-        break;
-    case SPINEL_PROP_NET_SAVED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_SAVED>;
-        break;
-    case SPINEL_PROP_NET_STACK_UP:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_STACK_UP>;
-        break;
-    case SPINEL_PROP_NET_XPANID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_XPANID>;
-        break;
-    case SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE>;
-        break;
-    case SPINEL_PROP_THREAD_ASSISTING_PORTS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ASSISTING_PORTS>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_TIMEOUT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CHILD_TIMEOUT>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID>;
-        break;
-    case SPINEL_PROP_THREAD_LEADER_ADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_LEADER_ADDR>;
-        break;
-    case SPINEL_PROP_THREAD_LEADER_NETWORK_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_LEADER_NETWORK_DATA>;
-        break;
-    case SPINEL_PROP_THREAD_LEADER_RID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_LEADER_RID>;
-        break;
-    case SPINEL_PROP_THREAD_MODE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_MODE>;
-        break;
-    case SPINEL_PROP_THREAD_NEIGHBOR_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NEIGHBOR_TABLE>;
-        break;
-#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
-    case SPINEL_PROP_THREAD_NEIGHBOR_TABLE_ERROR_RATES:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NEIGHBOR_TABLE_ERROR_RATES>;
-        break;
-#endif
-    case SPINEL_PROP_THREAD_NETWORK_DATA_VERSION:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NETWORK_DATA_VERSION>;
-        break;
-    case SPINEL_PROP_THREAD_OFF_MESH_ROUTES:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_OFF_MESH_ROUTES>;
-        break;
-    case SPINEL_PROP_THREAD_ON_MESH_NETS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ON_MESH_NETS>;
-        break;
-    case SPINEL_PROP_THREAD_PARENT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_PARENT>;
-        break;
-    case SPINEL_PROP_THREAD_RLOC16:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_RLOC16>;
-        break;
-    case SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU>;
-        break;
-    case SPINEL_PROP_THREAD_STABLE_LEADER_NETWORK_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_STABLE_LEADER_NETWORK_DATA>;
-        break;
-    case SPINEL_PROP_THREAD_STABLE_NETWORK_DATA_VERSION:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_STABLE_NETWORK_DATA_VERSION>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_FREQ),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_TX_POWER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_RSSI),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_RX_SENSITIVITY),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_PCAP_ENABLED),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_PHY_CHAN_PREFERRED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_STATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_MASK),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_PERIOD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_LADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_SADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_PANID),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_RAW_STREAM_ENABLED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_PROMISCUOUS_MODE),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_DATA_POLL_PERIOD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_SAVED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_IF_UP),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_STACK_UP),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_ROLE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_NETWORK_NAME),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_XPANID),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_MASTER_KEY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_PARTITION_ID),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NET_PSKC),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LEADER_ADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_PARENT),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_TABLE),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LEADER_RID),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LEADER_WEIGHT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_BORDER_ROUTER
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NETWORK_DATA),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NETWORK_DATA_VERSION),
 #if OPENTHREAD_ENABLE_BORDER_ROUTER
-    case SPINEL_PROP_THREAD_NETWORK_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NETWORK_DATA>;
-        break;
-    case SPINEL_PROP_THREAD_STABLE_NETWORK_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_STABLE_NETWORK_DATA>;
-        break;
-#endif
-    case SPINEL_PROP_THREAD_ACTIVE_DATASET:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ACTIVE_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_PENDING_DATASET:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_PENDING_DATASET>;
-        break;
-    case SPINEL_PROP_IPV6_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ADDRESS_TABLE>;
-        break;
-    case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD>;
-        break;
-    case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE>;
-        break;
-    case SPINEL_PROP_IPV6_LL_ADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_LL_ADDR>;
-        break;
-    case SPINEL_PROP_IPV6_ML_PREFIX:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ML_PREFIX>;
-        break;
-    case SPINEL_PROP_IPV6_ML_ADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ML_ADDR>;
-        break;
-    case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE>;
-        break;
-    case SPINEL_PROP_IPV6_ROUTE_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_IPV6_ROUTE_TABLE>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_STABLE_NETWORK_DATA),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_STABLE_NETWORK_DATA_VERSION),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ON_MESH_NETS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_OFF_MESH_ROUTES),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ASSISTING_PORTS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MODE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_LL_ADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ML_ADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ML_PREFIX),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ADDRESS_TABLE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ROUTE_TABLE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE),
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_JOINER
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_JOINER_STATE),
+#endif
+#if OPENTHREAD_ENABLE_COMMISSIONER
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_STATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_SESSION_ID),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_SERVICE
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_SERVER_SERVICES),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_SERVER_LEADER_SERVICES),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_ACK_REQ),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_ACKED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_NO_ACK_REQ),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_DATA),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_DATA_POLL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_BEACON),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_BEACON_REQ),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_OTHER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_RETRY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_ERR_CCA),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_UNICAST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_PKT_BROADCAST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_ERR_ABORT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_DATA),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_DATA_POLL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_BEACON),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_BEACON_REQ),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_OTHER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_FILT_WL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_FILT_DA),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_EMPTY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_UKWN_NBR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_NVLD_SADDR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_SECURITY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_BAD_FCS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_ERR_OTHER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_DUP),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_UNICAST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_PKT_BROADCAST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_IP_INSEC_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_IP_DROPPED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_IP_SEC_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_IP_INSEC_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_IP_DROPPED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_TX_SPINEL_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_SPINEL_TOTAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RX_SPINEL_ERR),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_IP_TX_SUCCESS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_IP_RX_SUCCESS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_IP_TX_FAILURE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_IP_RX_FAILURE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MSG_BUFFER_COUNTERS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_ALL_MAC_COUNTERS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CNTR_MLE_COUNTERS),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_LIST),
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_BATCHING_ENABLED),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_ENABLE_JAM_DETECTION
-    case SPINEL_PROP_JAM_DETECT_ENABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_ENABLE>;
-        break;
-    case SPINEL_PROP_JAM_DETECTED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECTED>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_WINDOW:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_WINDOW>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_BUSY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_BUSY>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_HISTORY_BITMAP:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_JAM_DETECT_HISTORY_BITMAP>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_ENABLE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECTED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_WINDOW),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_BUSY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_HISTORY_BITMAP),
 #endif
 #if OPENTHREAD_ENABLE_CHANNEL_MONITOR
-    case SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_INTERVAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_INTERVAL>;
-        break;
-    case SPINEL_PROP_CHANNEL_MONITOR_RSSI_THRESHOLD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MONITOR_RSSI_THRESHOLD>;
-        break;
-    case SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_WINDOW:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_WINDOW>;
-        break;
-    case SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_COUNT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_COUNT>;
-        break;
-    case SPINEL_PROP_CHANNEL_MONITOR_CHANNEL_OCCUPANCY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MONITOR_CHANNEL_OCCUPANCY>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_INTERVAL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MONITOR_RSSI_THRESHOLD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_WINDOW),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MONITOR_SAMPLE_COUNT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MONITOR_CHANNEL_OCCUPANCY),
 #endif
-#if OPENTHREAD_ENABLE_LEGACY
-    case SPINEL_PROP_NEST_LEGACY_ULA_PREFIX:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NEST_LEGACY_ULA_PREFIX>;
-        break;
-    case SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED>;
-        break;
-#endif
-        // MAC counters
-    case SPINEL_PROP_CNTR_TX_PKT_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_ACK_REQ:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_ACK_REQ>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_ACKED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_ACKED>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_NO_ACK_REQ:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_NO_ACK_REQ>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_DATA>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_DATA_POLL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_DATA_POLL>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_BEACON:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_BEACON>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_BEACON_REQ:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_BEACON_REQ>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_OTHER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_OTHER>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_RETRY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_RETRY>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_UNICAST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_UNICAST>;
-        break;
-    case SPINEL_PROP_CNTR_TX_PKT_BROADCAST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_PKT_BROADCAST>;
-        break;
-    case SPINEL_PROP_CNTR_TX_ERR_CCA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_ERR_CCA>;
-        break;
-    case SPINEL_PROP_CNTR_TX_ERR_ABORT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_ERR_ABORT>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_DATA>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_DATA_POLL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_DATA_POLL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_BEACON:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_BEACON>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_BEACON_REQ:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_BEACON_REQ>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_OTHER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_OTHER>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_FILT_WL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_FILT_WL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_FILT_DA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_FILT_DA>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_UNICAST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_UNICAST>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_BROADCAST:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_BROADCAST>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_EMPTY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_EMPTY>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_UKWN_NBR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_UKWN_NBR>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_NVLD_SADDR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_NVLD_SADDR>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_SECURITY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_SECURITY>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_BAD_FCS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_BAD_FCS>;
-        break;
-    case SPINEL_PROP_CNTR_RX_ERR_OTHER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_ERR_OTHER>;
-        break;
-    case SPINEL_PROP_CNTR_RX_PKT_DUP:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_PKT_DUP>;
-        break;
-    case SPINEL_PROP_CNTR_ALL_MAC_COUNTERS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_ALL_MAC_COUNTERS>;
-        break;
-    case SPINEL_PROP_CNTR_MLE_COUNTERS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MLE_COUNTERS>;
-        break;
-        // NCP counters
-    case SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_TX_IP_INSEC_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_IP_INSEC_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_TX_IP_DROPPED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_IP_DROPPED>;
-        break;
-    case SPINEL_PROP_CNTR_RX_IP_SEC_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_IP_SEC_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_IP_INSEC_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_IP_INSEC_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_IP_DROPPED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_IP_DROPPED>;
-        break;
-    case SPINEL_PROP_CNTR_TX_SPINEL_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_SPINEL_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_SPINEL_TOTAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_SPINEL_TOTAL>;
-        break;
-    case SPINEL_PROP_CNTR_RX_SPINEL_ERR:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_RX_SPINEL_ERR>;
-        break;
-        // IP counters
-    case SPINEL_PROP_CNTR_IP_TX_SUCCESS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_TX_SUCCESS>;
-        break;
-    case SPINEL_PROP_CNTR_IP_RX_SUCCESS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_RX_SUCCESS>;
-        break;
-    case SPINEL_PROP_CNTR_IP_TX_FAILURE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_TX_FAILURE>;
-        break;
-    case SPINEL_PROP_CNTR_IP_RX_FAILURE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_IP_RX_FAILURE>;
-        break;
-#if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-    case SPINEL_PROP_THREAD_NETWORK_TIME:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NETWORK_TIME>;
-        break;
 #endif
-#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
-    case SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT>;
-        break;
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RADIO_CAPS),
 #endif
-#if OPENTHREAD_PLATFORM_POSIX_APP
-    case SPINEL_PROP_RCP_VERSION:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_RCP_VERSION>;
-        break;
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST_ENABLED),
 #endif
-#if OPENTHREAD_CONFIG_ENABLE_SLAAC
-    case SPINEL_PROP_SLAAC_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_SLAAC_ENABLED>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_EXTENDED_ADDR),
+#endif
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_ENABLED),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST_ENABLED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_FIXED_RSS),
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_MAC_CCA_FAILURE_RATE),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_TIMEOUT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_RLOC16),
 #endif
-#if OPENTHREAD_ENABLE_SERVICE
-    case SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE>;
-        break;
-    case SPINEL_PROP_SERVER_SERVICES:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_SERVER_SERVICES>;
-        break;
-    case SPINEL_PROP_SERVER_LEADER_SERVICES:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_SERVER_LEADER_SERVICES>;
-        break;
-#endif
-#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
-
-        // --------------------------------------------------------------------------
-        // FTD Only Properties (Get Handler)
-
 #if OPENTHREAD_FTD
-    case SPINEL_PROP_NET_PSKC:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_NET_PSKC>;
-        break;
-    case SPINEL_PROP_THREAD_LEADER_WEIGHT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_LEADER_WEIGHT>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CHILD_TABLE>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_TABLE_ADDRESSES:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CHILD_TABLE_ADDRESSES>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_TABLE>;
-        break;
-    case SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_COUNT_MAX:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CHILD_COUNT_MAX>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD>;
-        break;
-    case SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY>;
-        break;
-    case SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER>;
-        break;
-    case SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID>;
-        break;
-    case SPINEL_PROP_THREAD_ADDRESS_CACHE_TABLE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ADDRESS_CACHE_TABLE>;
-        break;
-#if OPENTHREAD_ENABLE_JOINER
-    case SPINEL_PROP_MESHCOP_JOINER_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MESHCOP_JOINER_STATE>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NEIGHBOR_TABLE),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_COUNT_MAX),
 #endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LEADER_NETWORK_DATA),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_STABLE_LEADER_NETWORK_DATA),
+#endif
+#if OPENTHREAD_FTD
 #if OPENTHREAD_ENABLE_COMMISSIONER
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_STATE:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MESHCOP_COMMISSIONER_STATE>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_SESSION_ID:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MESHCOP_COMMISSIONER_SESSION_ID>;
-        break;
-    case SPINEL_PROP_THREAD_COMMISSIONER_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_COMMISSIONER_ENABLED>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_COMMISSIONER_ENABLED),
+#endif
 #endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID),
+#endif
+#if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
-    case SPINEL_PROP_THREAD_STEERING_DATA:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_STEERING_DATA>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_STEERING_DATA),
 #endif
-#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
-    case SPINEL_PROP_CHILD_SUPERVISION_INTERVAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHILD_SUPERVISION_INTERVAL>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_TABLE),
 #endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ACTIVE_DATASET),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_PENDING_DATASET),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_TABLE_ADDRESSES),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_CONFIG_ENABLE_TX_ERROR_RATE_TRACKING
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NEIGHBOR_TABLE_ERROR_RATES),
+#endif
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ADDRESS_CACHE_TABLE),
 #if OPENTHREAD_ENABLE_CHANNEL_MANAGER
-    case SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_DELAY:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_DELAY>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL>;
-        break;
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_DELAY),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL),
 #endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-    case SPINEL_PROP_TIME_SYNC_PERIOD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_TIME_SYNC_PERIOD>;
-        break;
-    case SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD>;
-        break;
-#endif // OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-#endif // OPENTHREAD_FTD
-
-        // --------------------------------------------------------------------------
-        // Raw Link or Radio Mode Properties (Get Handler)
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NETWORK_TIME),
+#endif
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_TIME_SYNC_PERIOD),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD),
+#endif
+#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHILD_SUPERVISION_INTERVAL),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT),
+#endif
+#if OPENTHREAD_PLATFORM_POSIX_APP
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_RCP_VERSION),
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_SLAAC
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_SLAAC_ENABLED),
+#endif
+#if OPENTHREAD_ENABLE_LEGACY
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NEST_LEGACY_ULA_PREFIX),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_NEST_LEGACY_LAST_NODE_JOINED),
+#endif
+#endif
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_TEST_ASSERT),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_NCP_LOG_LEVEL),
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_TEST_WATCHDOG),
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    OT_NCP_GET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS),
+#endif
+};
 
+const NcpBase::HandlerEntry NcpBase::sSetHandlerTable[] = {
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_POWER_STATE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MCU_POWER_STATE),
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
-    case SPINEL_PROP_RADIO_CAPS:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_RADIO_CAPS>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_ENABLED:
-        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_SRC_MATCH_ENABLED>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PHY_ENABLED),
 #endif
-
-    default:
-        handler = NULL;
-    }
-
-    return handler;
-}
-
-NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
-{
-    NcpBase::PropertyHandler handler;
-
-    switch (aKey)
-    {
-        // --------------------------------------------------------------------------
-        // Common Properties (Set Handler)
-
-    case SPINEL_PROP_POWER_STATE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_POWER_STATE>;
-        break;
-    case SPINEL_PROP_MCU_POWER_STATE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MCU_POWER_STATE>;
-        break;
-    case SPINEL_PROP_UNSOL_UPDATE_FILTER:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_UNSOL_UPDATE_FILTER>;
-        break;
-    case SPINEL_PROP_PHY_TX_POWER:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_TX_POWER>;
-        break;
-    case SPINEL_PROP_PHY_CHAN:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_CHAN>;
-        break;
-    case SPINEL_PROP_MAC_PROMISCUOUS_MODE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_PROMISCUOUS_MODE>;
-        break;
-    case SPINEL_PROP_MAC_15_4_PANID:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_15_4_PANID>;
-        break;
-    case SPINEL_PROP_MAC_15_4_LADDR:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_15_4_LADDR>;
-        break;
-    case SPINEL_PROP_MAC_RAW_STREAM_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_RAW_STREAM_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_MASK:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_MASK>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_STATE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_STATE>;
-        break;
-    case SPINEL_PROP_MAC_SCAN_PERIOD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SCAN_PERIOD>;
-        break;
-
-        // --------------------------------------------------------------------------
-        // MTD (or FTD) Properties (Set Handler)
-
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PHY_CHAN),
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-    case SPINEL_PROP_PHY_PCAP_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_PCAP_ENABLED>;
-        break;
-    case SPINEL_PROP_PHY_CHAN_SUPPORTED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_CHAN_SUPPORTED>;
-        break;
-    case SPINEL_PROP_MAC_DATA_POLL_PERIOD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_DATA_POLL_PERIOD>;
-        break;
-    case SPINEL_PROP_NET_IF_UP:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_IF_UP>;
-        break;
-    case SPINEL_PROP_NET_STACK_UP:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_STACK_UP>;
-        break;
-    case SPINEL_PROP_NET_ROLE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_ROLE>;
-        break;
-    case SPINEL_PROP_NET_NETWORK_NAME:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_NETWORK_NAME>;
-        break;
-    case SPINEL_PROP_NET_XPANID:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_XPANID>;
-        break;
-    case SPINEL_PROP_NET_MASTER_KEY:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_MASTER_KEY>;
-        break;
-    case SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER>;
-        break;
-    case SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME>;
-        break;
-    case SPINEL_PROP_THREAD_ASSISTING_PORTS:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ASSISTING_PORTS>;
-        break;
-    case SPINEL_PROP_STREAM_NET_INSECURE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET_INSECURE>;
-        break;
-    case SPINEL_PROP_STREAM_NET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET>;
-        break;
-    case SPINEL_PROP_IPV6_ML_PREFIX:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_ML_PREFIX>;
-        break;
-    case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD>;
-        break;
-    case SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_TIMEOUT:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_CHILD_TIMEOUT>;
-        break;
-#if OPENTHREAD_ENABLE_JOINER
-    case SPINEL_PROP_MESHCOP_JOINER_COMMISSIONING:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_JOINER_COMMISSIONING>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PHY_CHAN_SUPPORTED),
 #endif
-    case SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU>;
-        break;
-#if OPENTHREAD_ENABLE_MAC_FILTER
-    case SPINEL_PROP_MAC_WHITELIST:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_WHITELIST>;
-        break;
-    case SPINEL_PROP_MAC_WHITELIST_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_WHITELIST_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_BLACKLIST:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_BLACKLIST>;
-        break;
-    case SPINEL_PROP_MAC_BLACKLIST_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_BLACKLIST_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_FIXED_RSS:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_FIXED_RSS>;
-        break;
-#endif
-    case SPINEL_PROP_THREAD_MODE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_MODE>;
-        break;
-    case SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING>;
-        break;
-    case SPINEL_PROP_DEBUG_NCP_LOG_LEVEL:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_DEBUG_NCP_LOG_LEVEL>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING>;
-        break;
-    case SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PHY_TX_POWER),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_PHY_PCAP_ENABLED),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_STATE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_MASK),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SCAN_PERIOD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_LADDR),
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_SADDR),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_15_4_PANID),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_RAW_STREAM_ENABLED),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_PROMISCUOUS_MODE),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_DATA_POLL_PERIOD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_IF_UP),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_STACK_UP),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_ROLE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_NETWORK_NAME),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_XPANID),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_MASTER_KEY),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_KEY_SEQUENCE_COUNTER),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_REQUIRE_JOIN_EXISTING),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_KEY_SWITCH_GUARDTIME),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NET_PSKC),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ASSISTING_PORTS),
 #if OPENTHREAD_ENABLE_BORDER_ROUTER
-    case SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ALLOW_LOCAL_NET_DATA_CHANGE),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MODE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ML_PREFIX),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_IPV6_ICMP_PING_OFFLOAD_MODE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_STREAM_NET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_STREAM_NET_INSECURE),
+#if OPENTHREAD_ENABLE_JOINER
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_JOINER_COMMISSIONING),
 #endif
-
-    case SPINEL_PROP_THREAD_ACTIVE_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ACTIVE_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_PENDING_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_PENDING_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_MGMT_SET_ACTIVE_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_MGMT_SET_ACTIVE_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_MGMT_GET_ACTIVE_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_MGMT_GET_ACTIVE_DATASET>;
-        break;
-    case SPINEL_PROP_THREAD_MGMT_GET_PENDING_DATASET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_MGMT_GET_PENDING_DATASET>;
-        break;
-
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_COMMISSIONER
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_STATE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_SERVICE
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CNTR_RESET),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_UNSOL_BATCHING_ENABLED),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_ENABLE_JAM_DETECTION
-    case SPINEL_PROP_JAM_DETECT_ENABLE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_JAM_DETECT_ENABLE>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_WINDOW:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_JAM_DETECT_WINDOW>;
-        break;
-    case SPINEL_PROP_JAM_DETECT_BUSY:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_JAM_DETECT_BUSY>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_ENABLE),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_RSSI_THRESHOLD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_WINDOW),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_JAM_DETECT_BUSY),
 #endif
-#if OPENTHREAD_ENABLE_LEGACY
-    case SPINEL_PROP_NEST_LEGACY_ULA_PREFIX:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NEST_LEGACY_ULA_PREFIX>;
-        break;
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST_ENABLED),
 #endif
-    case SPINEL_PROP_CNTR_RESET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_RESET>;
-        break;
-#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
-    case SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT>;
-        break;
 #endif
-#if OPENTHREAD_CONFIG_ENABLE_SLAAC
-    case SPINEL_PROP_SLAAC_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_SLAAC_ENABLED>;
-        break;
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_ENABLED),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES),
 #endif
-#if OPENTHREAD_ENABLE_SERVICE
-    case SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_SERVER_ALLOW_LOCAL_DATA_CHANGE>;
-        break;
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST_ENABLED),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MAC_FIXED_RSS),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_TIMEOUT),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_RLOC16_DEBUG_PASSTHRU),
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_CHILD_COUNT_MAX),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_JOINER_FLAG),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_ENABLE_FILTERING),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_DISCOVERY_SCAN_PANID),
 #endif
-#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
-
-        // --------------------------------------------------------------------------
-        // FTD Only Properties (Set Handler)
-
 #if OPENTHREAD_FTD
-    case SPINEL_PROP_NET_PSKC:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_PSKC>;
-        break;
-    case SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_NETWORK_ID_TIMEOUT>;
-        break;
-    case SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_LOCAL_LEADER_WEIGHT>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ROUTER_ROLE_ENABLED>;
-        break;
-    case SPINEL_PROP_THREAD_CHILD_COUNT_MAX:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_CHILD_COUNT_MAX>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ROUTER_UPGRADE_THRESHOLD>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ROUTER_DOWNGRADE_THRESHOLD>;
-        break;
-    case SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_CONTEXT_REUSE_DELAY>;
-        break;
-    case SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_ROUTER_SELECTION_JITTER>;
-        break;
-    case SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_PREFERRED_ROUTER_ID>;
-        break;
 #if OPENTHREAD_CONFIG_ENABLE_STEERING_DATA_SET_OOB
-    case SPINEL_PROP_THREAD_STEERING_DATA:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_STEERING_DATA>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_STEERING_DATA),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_ACTIVE_DATASET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_PENDING_DATASET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MGMT_SET_ACTIVE_DATASET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET),
 #endif
+#if OPENTHREAD_FTD
 #if OPENTHREAD_ENABLE_UDP_FORWARD
-    case SPINEL_PROP_THREAD_UDP_FORWARD_STREAM:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_THREAD_UDP_FORWARD_STREAM>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_UDP_FORWARD_STREAM),
 #endif
-#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
-    case SPINEL_PROP_CHILD_SUPERVISION_INTERVAL:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHILD_SUPERVISION_INTERVAL>;
-        break;
 #endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MGMT_GET_ACTIVE_DATASET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_THREAD_MGMT_GET_PENDING_DATASET),
+#endif
+#if OPENTHREAD_FTD
 #if OPENTHREAD_ENABLE_COMMISSIONER
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_STATE:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_STATE>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_PROVISIONING_URL>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_ANNOUNCE_BEGIN:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_ANNOUNCE_BEGIN>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_ENERGY_SCAN:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_ENERGY_SCAN>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_PAN_ID_QUERY:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_PAN_ID_QUERY>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_GET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_GET>;
-        break;
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_SET:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_SET>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_ANNOUNCE_BEGIN),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_ENERGY_SCAN),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_PAN_ID_QUERY),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_GET),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_MGMT_SET),
 #endif
 #if OPENTHREAD_ENABLE_CHANNEL_MANAGER
-    case SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_DELAY:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_DELAY>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED>;
-        break;
-    case SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL>;
-        break;
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_NEW_CHANNEL),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_DELAY),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_SUPPORTED_CHANNELS),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_FAVORED_CHANNELS),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_CHANNEL_SELECT),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_ENABLED),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHANNEL_MANAGER_AUTO_SELECT_INTERVAL),
 #endif
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
-    case SPINEL_PROP_TIME_SYNC_PERIOD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_TIME_SYNC_PERIOD>;
-        break;
-    case SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD>;
-        break;
-#endif
-#endif // #if OPENTHREAD_FTD
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_TIME_SYNC_PERIOD),
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_TIME_SYNC_XTAL_THRESHOLD),
+#endif
+#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHILD_SUPERVISION_INTERVAL),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_CHILD_SUPERVISION
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT),
+#endif
+#if OPENTHREAD_CONFIG_ENABLE_SLAAC
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_SLAAC_ENABLED),
+#endif
+#if OPENTHREAD_ENABLE_LEGACY
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_NEST_LEGACY_ULA_PREFIX),
+#endif
+    OT_NCP_SET_HANDLER_ENTRY(SPINEL_PROP_DEBUG_NCP_LOG_LEVEL),
+#endif
+};
 
-        // --------------------------------------------------------------------------
-        // Raw Link API Properties (Set Handler)
+const NcpBase::HandlerEntry NcpBase::sInsertHandlerTable[] = {
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_BORDER_ROUTER
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_THREAD_ON_MESH_NETS),
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_THREAD_OFF_MESH_ROUTES),
+#endif
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_THREAD_ASSISTING_PORTS),
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_IPV6_ADDRESS_TABLE),
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE),
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_COMMISSIONER
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_SERVICE
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_SERVER_SERVICES),
+#endif
+#endif
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST),
+#endif
+#endif
+#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES),
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST),
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_MAC_FIXED_RSS),
+#endif
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_COMMISSIONER
+    OT_NCP_INSERT_HANDLER_ENTRY(SPINEL_PROP_THREAD_JOINERS),
+#endif
+#endif
+};
 
+const NcpBase::HandlerEntry NcpBase::sRemoveHandlerTable[] = {
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_BORDER_ROUTER
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_THREAD_ON_MESH_NETS),
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_THREAD_OFF_MESH_ROUTES),
+#endif
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_THREAD_ASSISTING_PORTS),
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_IPV6_ADDRESS_TABLE),
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE),
+#endif
+#if OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_COMMISSIONER
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS),
+#endif
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_SERVICE
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_SERVER_SERVICES),
+#endif
+#endif
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_UNSOL_UPDATE_FILTER),
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MAC_WHITELIST),
+#endif
+#endif
 #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
-    case SPINEL_PROP_MAC_15_4_SADDR:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_15_4_SADDR>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_ENABLED>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>;
-        break;
-    case SPINEL_PROP_PHY_ENABLED:
-        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_ENABLED>;
-        break;
-#endif // #if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES),
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES),
+#endif
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+#if OPENTHREAD_ENABLE_MAC_FILTER
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MAC_BLACKLIST),
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_MAC_FIXED_RSS),
+#endif
+#endif
+#if OPENTHREAD_FTD
+    OT_NCP_REMOVE_HANDLER_ENTRY(SPINEL_PROP_THREAD_ACTIVE_ROUTER_IDS),
+#endif
+};
 
-    default:
-        handler = NULL;
-    }
+const NcpBase::HandlerTable NcpBase::sHandlerTables[kNumHandlerTables] = {
+    {SPINEL_CMD_PROP_VALUE_GET, sGetHandlerTable, OT_ARRAY_LENGTH(sGetHandlerTable)},
+    {SPINEL_CMD_PROP_VALUE_SET, sSetHandlerTable, OT_ARRAY_LENGTH(sSetHandlerTable)},
+    {SPINEL_CMD_PROP_VALUE_INSERT, sInsertHandlerTable, OT_ARRAY_LENGTH(sInsertHandlerTable)},
+    {SPINEL_CMD_PROP_VALUE_REMOVE, sRemoveHandlerTable, OT_ARRAY_LENGTH(sRemoveHandlerTable)},
+};
 
-    return handler;
-}
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+NcpBase::PropertyStats NcpBase::sPropertyStats[OT_ARRAY_LENGTH(sGetHandlerTable) + OT_ARRAY_LENGTH(sSetHandlerTable) +
+                                               OT_ARRAY_LENGTH(sInsertHandlerTable) +
+                                               OT_ARRAY_LENGTH(sRemoveHandlerTable)];
+#endif
 
-NcpBase::PropertyHandler NcpBase::FindInsertPropertyHandler(spinel_prop_key_t aKey)
+// ----------------------------------------------------------------------------
+// MARK: Property Handler Lookup
+// ----------------------------------------------------------------------------
+
+const NcpBase::HandlerEntry *NcpBase::FindHandlerEntry(const HandlerEntry *aTable,
+                                                       uint16_t            aLength,
+                                                       spinel_prop_key_t   aKey)
 {
-    NcpBase::PropertyHandler handler;
+    const HandlerEntry *entry = NULL;
+    uint16_t            low   = 0;
+    uint16_t            high  = aLength;
 
-    switch (aKey)
+    while (low < high)
     {
-        // --------------------------------------------------------------------------
-        // Common Properties (Insert Handler)
+        uint16_t mid = low + (high - low) / 2;
+
+        if (aTable[mid].mKey < aKey)
+        {
+            low = mid + 1;
+        }
+        else if (aTable[mid].mKey > aKey)
+        {
+            high = mid;
+        }
+        else
+        {
+            ExitNow(entry = &aTable[mid]);
+        }
+    }
 
-    case SPINEL_PROP_UNSOL_UPDATE_FILTER:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_UNSOL_UPDATE_FILTER>;
-        break;
+exit:
+    return entry;
+}
 
-        // --------------------------------------------------------------------------
-        // MTD (or FTD) Properties (Insert Handler)
+const NcpBase::HandlerEntry *NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
+{
+    return FindHandlerEntry(sGetHandlerTable, OT_ARRAY_LENGTH(sGetHandlerTable), aKey);
+}
 
-#if OPENTHREAD_MTD || OPENTHREAD_FTD
-    case SPINEL_PROP_IPV6_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_IPV6_ADDRESS_TABLE>;
-        break;
-    case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE>;
-        break;
-    case SPINEL_PROP_THREAD_ASSISTING_PORTS:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_THREAD_ASSISTING_PORTS>;
-        break;
-#if OPENTHREAD_ENABLE_BORDER_ROUTER
-    case SPINEL_PROP_THREAD_OFF_MESH_ROUTES:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_THREAD_OFF_MESH_ROUTES>;
-        break;
-    case SPINEL_PROP_THREAD_ON_MESH_NETS:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_THREAD_ON_MESH_NETS>;
-        break;
-#endif
-#if OPENTHREAD_ENABLE_MAC_FILTER
-    case SPINEL_PROP_MAC_WHITELIST:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_WHITELIST>;
-        break;
-    case SPINEL_PROP_MAC_BLACKLIST:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_BLACKLIST>;
-        break;
-    case SPINEL_PROP_MAC_FIXED_RSS:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_FIXED_RSS>;
-        break;
-#endif
-#if OPENTHREAD_ENABLE_SERVICE
-    case SPINEL_PROP_SERVER_SERVICES:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_SERVER_SERVICES>;
-        break;
-#endif
-#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+const NcpBase::HandlerEntry *NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
+{
+    return FindHandlerEntry(sSetHandlerTable, OT_ARRAY_LENGTH(sSetHandlerTable), aKey);
+}
 
-        // --------------------------------------------------------------------------
-        // FTD Only Properties (Insert Handler)
+const NcpBase::HandlerEntry *NcpBase::FindInsertPropertyHandler(spinel_prop_key_t aKey)
+{
+    return FindHandlerEntry(sInsertHandlerTable, OT_ARRAY_LENGTH(sInsertHandlerTable), aKey);
+}
 
-#if OPENTHREAD_FTD
-#if OPENTHREAD_ENABLE_COMMISSIONER
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS>;
-        break;
-    case SPINEL_PROP_THREAD_JOINERS:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_THREAD_JOINERS>;
-        break;
-#endif
-#endif // OPENTHREAD_FTD
+const NcpBase::HandlerEntry *NcpBase::FindRemovePropertyHandler(spinel_prop_key_t aKey)
+{
+    return FindHandlerEntry(sRemoveHandlerTable, OT_ARRAY_LENGTH(sRemoveHandlerTable), aKey);
+}
 
-        // --------------------------------------------------------------------------
-        // Raw Link API Properties (Insert Handler)
+bool NcpBase::AreHandlerTablesSorted(void)
+{
+    bool isSorted = true;
 
-#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
-    case SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES:
-        handler = &NcpBase::HandlePropertyInsert<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>;
-        break;
-#endif
+    for (uint8_t tableIndex = 0; tableIndex < OT_ARRAY_LENGTH(sHandlerTables); tableIndex++)
+    {
+        const HandlerTable &table = sHandlerTables[tableIndex];
 
-    default:
-        handler = NULL;
+        for (uint16_t index = 1; index < table.mLength; index++)
+        {
+            VerifyOrExit(table.mEntries[index - 1].mKey < table.mEntries[index].mKey, isSorted = false);
+        }
     }
 
-    return handler;
+exit:
+    return isSorted;
 }
 
-NcpBase::PropertyHandler NcpBase::FindRemovePropertyHandler(spinel_prop_key_t aKey)
+// ----------------------------------------------------------------------------
+// MARK: Property Handler Invocation
+// ----------------------------------------------------------------------------
+
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+
+NcpBase::PropertyStats *NcpBase::FindPropertyStats(const HandlerEntry &aEntry)
 {
-    NcpBase::PropertyHandler handler;
+    PropertyStats *stats = sPropertyStats;
 
-    switch (aKey)
+    for (uint8_t tableIndex = 0; tableIndex < OT_ARRAY_LENGTH(sHandlerTables); tableIndex++)
     {
-        // --------------------------------------------------------------------------
-        // Common Properties (Remove Handler)
+        const HandlerTable &table = sHandlerTables[tableIndex];
 
-    case SPINEL_PROP_UNSOL_UPDATE_FILTER:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_UNSOL_UPDATE_FILTER>;
-        break;
+        if (&aEntry >= table.mEntries && &aEntry < table.mEntries + table.mLength)
+        {
+            ExitNow(stats += &aEntry - table.mEntries);
+        }
 
-        // --------------------------------------------------------------------------
-        // MTD (or FTD) Properties (Remove Handler)
+        stats += table.mLength;
+    }
 
-#if OPENTHREAD_MTD || OPENTHREAD_FTD
-    case SPINEL_PROP_IPV6_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_IPV6_ADDRESS_TABLE>;
-        break;
-    case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE>;
-        break;
-#if OPENTHREAD_ENABLE_BORDER_ROUTER
-    case SPINEL_PROP_THREAD_OFF_MESH_ROUTES:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_THREAD_OFF_MESH_ROUTES>;
-        break;
-    case SPINEL_PROP_THREAD_ON_MESH_NETS:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_THREAD_ON_MESH_NETS>;
-        break;
-#endif
-    case SPINEL_PROP_THREAD_ASSISTING_PORTS:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_THREAD_ASSISTING_PORTS>;
-        break;
-#if OPENTHREAD_ENABLE_MAC_FILTER
-    case SPINEL_PROP_MAC_WHITELIST:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_WHITELIST>;
-        break;
-    case SPINEL_PROP_MAC_BLACKLIST:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_BLACKLIST>;
-        break;
-    case SPINEL_PROP_MAC_FIXED_RSS:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_FIXED_RSS>;
-        break;
-#endif
-#if OPENTHREAD_ENABLE_SERVICE
-    case SPINEL_PROP_SERVER_SERVICES:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_SERVER_SERVICES>;
-        break;
-#endif
-#endif // OPENTHREAD_MTD || OPENTHREAD_FTD
+    stats = NULL;
 
-        // --------------------------------------------------------------------------
-        // FTD Only Properties (Remove Handler)
+exit:
+    return stats;
+}
 
-#if OPENTHREAD_FTD
-    case SPINEL_PROP_THREAD_ACTIVE_ROUTER_IDS:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_THREAD_ACTIVE_ROUTER_IDS>;
-        break;
-#if OPENTHREAD_ENABLE_COMMISSIONER
-    case SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MESHCOP_COMMISSIONER_JOINERS>;
-        break;
-#endif
-#endif // OPENTHREAD_FTD
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS>(void)
+{
+    otError        error = OT_ERROR_NONE;
+    PropertyStats *stats = sPropertyStats;
 
-        // --------------------------------------------------------------------------
-        // Raw Link API Properties (Remove Handler)
+    for (uint8_t tableIndex = 0; tableIndex < OT_ARRAY_LENGTH(sHandlerTables); tableIndex++)
+    {
+        const HandlerTable &table = sHandlerTables[tableIndex];
+
+        for (uint16_t index = 0; index < table.mLength; index++, stats++)
+        {
+            if (stats->mCount == 0)
+            {
+                continue;
+            }
+
+            SuccessOrExit(error = mEncoder.OpenStruct());
+            SuccessOrExit(error = mEncoder.WriteUint8(table.mCommand));
+            SuccessOrExit(error = mEncoder.WriteUintPacked(table.mEntries[index].mKey));
+            SuccessOrExit(error = mEncoder.WriteUint32(stats->mCount));
+            SuccessOrExit(error = mEncoder.WriteUint32(stats->mTime));
+            SuccessOrExit(error = mEncoder.CloseStruct());
+        }
+    }
 
-#if OPENTHREAD_RADIO || OPENTHREAD_ENABLE_RAW_LINK_API
-    case SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES>;
-        break;
-    case SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES:
-        handler = &NcpBase::HandlePropertyRemove<SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES>;
-        break;
+exit:
+    return error;
+}
+
+static uint32_t GetPropertyStatsTime(void)
+{
+#if OPENTHREAD_CONFIG_ENABLE_PLATFORM_USEC_TIMER
+    return TimerMicro::GetNow();
+#else
+    return TimerMilli::GetNow() * 1000U;
 #endif
+}
 
-    default:
-        handler = NULL;
+otError NcpBase::CallPropertyHandler(const HandlerEntry &aEntry)
+{
+    PropertyStats *stats = FindPropertyStats(aEntry);
+    uint32_t       start = GetPropertyStatsTime();
+    otError        error;
+
+    error = (this->*aEntry.mHandler)();
+
+    if (stats != NULL)
+    {
+        stats->mCount++;
+        stats->mTime += GetPropertyStatsTime() - start;
     }
 
-    return handler;
+    return error;
+}
+
+#else // OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+
+otError NcpBase::CallPropertyHandler(const HandlerEntry &aEntry)
+{
+    return (this->*aEntry.mHandler)();
 }
 
+#endif // OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+
 } // namespace Ncp
 } // namespace ot
@@ -833,7 +833,7 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ADDRESS_CACHE_
     otError         error = OT_ERROR_NONE;
     otEidCacheEntry entry;
 
-    for (uint8_t index = 0;; index++)
+    for (uint16_t index = 0;; index++)
     {
         SuccessOrExit(otThreadGetEidCacheEntry(mInstance, index, &entry));
 
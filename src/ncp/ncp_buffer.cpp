@@ -79,10 +79,12 @@ void NcpFrameBuffer::Clear(void)
     mReadSegmentHead               = mBuffer;
     mReadSegmentTail               = mBuffer;
     mReadPointer                   = mBuffer;
+    mReadDataTail                  = mBuffer;
 
-    mReadMessage       = NULL;
-    mReadMessageOffset = 0;
-    mReadMessageTail   = mMessageBuffer;
+    mReadMessage        = NULL;
+    mReadMessageLength  = 0;
+    mReadMessagePointer = NULL;
+    mReadMessageTail    = NULL;
 
     // Free all messages in the queues.
 
@@ -498,6 +500,11 @@ otError NcpFrameBuffer::InFrameEnd(void)
     // End/Close the current segment (if any).
     InFrameEndSegment(kSegmentHeaderNoFlag);
 
+    if (mWriteDirection == kBackward)
+    {
+        InFrameReverseSegmentData();
+    }
+
     // Save and use the frame start pointer as the tag associated with the frame.
     mWriteFrameTag = mWriteFrameStart[mWriteDirection];
 
@@ -522,6 +529,34 @@ exit:
     return error;
 }
 
+// This method reverses the data bytes of all segments in the current (finished) frame being written in backward
+// direction, so that the segment data of all frames is stored and read in forward direction.
+void NcpFrameBuffer::InFrameReverseSegmentData(void)
+{
+    uint8_t *segmentHead = mWriteFrameStart[mWriteDirection];
+
+    while (segmentHead != mWriteSegmentHead)
+    {
+        uint16_t length = ReadUint16At(segmentHead, mWriteDirection) & kSegmentHeaderLengthMask;
+        uint8_t *first  = GetUpdatedBufPtr(segmentHead, kSegmentHeaderSize, mWriteDirection);
+        uint8_t *last;
+
+        segmentHead = GetUpdatedBufPtr(first, length, mWriteDirection);
+        last        = GetUpdatedBufPtr(segmentHead, 1, kForward);
+
+        for (length /= 2; length > 0; length--)
+        {
+            uint8_t byte = *first;
+
+            *first = *last;
+            *last  = byte;
+
+            first = GetUpdatedBufPtr(first, 1, mWriteDirection);
+            last  = GetUpdatedBufPtr(last, 1, kForward);
+        }
+    }
+}
+
 NcpFrameBuffer::FrameTag NcpFrameBuffer::InFrameGetLastTag(void) const
 {
     return mWriteFrameTag;
@@ -573,11 +608,22 @@ otError NcpFrameBuffer::OutFramePrepareSegment(void)
         mReadSegmentTail = GetUpdatedBufPtr(mReadSegmentHead, kSegmentHeaderSize + (header & kSegmentHeaderLengthMask),
                                             mReadDirection);
 
-        // Update the current read pointer to skip the segment header.
-        mReadPointer = GetUpdatedBufPtr(mReadSegmentHead, kSegmentHeaderSize, mReadDirection);
+        // Update the current read pointer to the first data byte after the segment header. Segment data is always
+        // stored in forward direction (see `InFrameReverseSegmentData()`), so for a segment in backward direction
+        // the data starts right after the segment tail and ends right before the segment header.
+        if (mReadDirection == kForward)
+        {
+            mReadPointer  = GetUpdatedBufPtr(mReadSegmentHead, kSegmentHeaderSize, kForward);
+            mReadDataTail = mReadSegmentTail;
+        }
+        else
+        {
+            mReadPointer  = GetUpdatedBufPtr(mReadSegmentTail, 1, kForward);
+            mReadDataTail = GetUpdatedBufPtr(mReadSegmentHead, kSegmentHeaderSize - 1, kBackward);
+        }
 
-        // Check if there are data bytes to be read in this segment (i.e. read pointer not at the tail).
-        if (mReadPointer != mReadSegmentTail)
+        // Check if there are data bytes to be read in this segment (i.e. read pointer not at the data tail).
+        if (mReadPointer != mReadDataTail)
         {
             // Update the state to `InSegment` and return.
             mReadState = kReadStateInSegment;
@@ -604,7 +650,7 @@ exit:
     return error;
 }
 
-// This method prepares an associated message in current segment and fills the message buffer. It returns
+// This method prepares an associated message in current segment and its first chunk of content. It returns
 // ThreadError_NotFound if there is no message or if the message has no content.
 otError NcpFrameBuffer::OutFramePrepareMessage(void)
 {
@@ -623,11 +669,14 @@ otError NcpFrameBuffer::OutFramePrepareMessage(void)
 
     VerifyOrExit(mReadMessage != NULL, error = OT_ERROR_NOT_FOUND);
 
-    // Reset the offset for reading the message.
-    mReadMessageOffset = 0;
+    // Start reading the message content from its first chunk.
+    mReadMessageLength = otMessageGetLength(mReadMessage);
+    static_cast<Message *>(mReadMessage)->GetFirstChunk(0, mReadMessageLength, mReadMessageChunk);
 
-    // Fill the content from current message into the message buffer.
-    SuccessOrExit(error = OutFrameFillMessageBuffer());
+    VerifyOrExit(mReadMessageChunk.GetLength() > 0, error = OT_ERROR_NOT_FOUND);
+
+    mReadMessagePointer = mReadMessageChunk.GetData();
+    mReadMessageTail    = mReadMessagePointer + mReadMessageChunk.GetLength();
 
     // If all successful, set the state to `InMessage`.
     mReadState = kReadStateInMessage;
@@ -636,29 +685,20 @@ exit:
     return error;
 }
 
-// This method fills content from current message into the message buffer. It returns OT_ERROR_NOT_FOUND if no more
-// content in the current message.
-otError NcpFrameBuffer::OutFrameFillMessageBuffer(void)
+// This method moves to the next chunk of the current message, reading the message content in place. It returns
+// OT_ERROR_NOT_FOUND if no more content in the current message.
+otError NcpFrameBuffer::OutFrameNextMessageChunk(void)
 {
     otError error = OT_ERROR_NONE;
-    int     readLength;
 
     VerifyOrExit(mReadMessage != NULL, error = OT_ERROR_NOT_FOUND);
 
-    VerifyOrExit(mReadMessageOffset < otMessageGetLength(mReadMessage), error = OT_ERROR_NOT_FOUND);
-
-    // Read portion of current message from the offset into message buffer.
-    readLength = otMessageRead(mReadMessage, mReadMessageOffset, mMessageBuffer, sizeof(mMessageBuffer));
+    static_cast<Message *>(mReadMessage)->GetNextChunk(mReadMessageLength, mReadMessageChunk);
 
-    VerifyOrExit(readLength > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(mReadMessageChunk.GetLength() > 0, error = OT_ERROR_NOT_FOUND);
 
-    // Update the message offset, set up the message tail, and set read pointer to start of message buffer.
-
-    mReadMessageOffset += readLength;
-
-    mReadMessageTail = mMessageBuffer + readLength;
-
-    mReadPointer = mMessageBuffer;
+    mReadMessagePointer = mReadMessageChunk.GetData();
+    mReadMessageTail    = mReadMessagePointer + mReadMessageChunk.GetLength();
 
 exit:
     return error;
@@ -689,10 +729,9 @@ bool NcpFrameBuffer::OutFrameHasEnded(void)
     return (mReadState == kReadStateDone) || (mReadState == kReadStateNotActive);
 }
 
-uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+uint16_t NcpFrameBuffer::OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan)
 {
-    otError error;
-    uint8_t retval = kReadByteAfterFrameHasEnded;
+    uint16_t length = 0;
 
     switch (mReadState)
     {
@@ -702,24 +741,28 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateDone:
 
-        retval = kReadByteAfterFrameHasEnded;
-
         break;
 
     case kReadStateInSegment:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte in the read direction.
-        retval       = *mReadPointer;
-        mReadPointer = GetUpdatedBufPtr(mReadPointer, 1, mReadDirection);
+        // The span ends at the end of the segment data or at the end of the buffer (when the data wraps around).
+        aSpan  = mReadPointer;
+        length = static_cast<uint16_t>((mReadDataTail > mReadPointer) ? (mReadDataTail - mReadPointer)
+                                                                       : (mBufferEnd - mReadPointer));
 
-        // Check if at end of current segment.
-        if (mReadPointer == mReadSegmentTail)
+        if (length > aMaxLength)
         {
-            // Prepare any message associated with this segment.
-            error = OutFramePrepareMessage();
+            length = aMaxLength;
+        }
+
+        mReadPointer = GetUpdatedBufPtr(mReadPointer, length, kForward);
 
-            // If there is no message, move to next segment (if any).
-            if (error != OT_ERROR_NONE)
+        // Check if at end of current segment.
+        if (mReadPointer == mReadDataTail)
+        {
+            // Prepare any message associated with this segment, if there is no message, move to next segment (if
+            // any).
+            if (OutFramePrepareMessage() != OT_ERROR_NONE)
             {
                 OutFramePrepareSegment();
             }
@@ -729,18 +772,23 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateInMessage:
 
-        // Read a byte from current read pointer and move the read pointer by 1 byte.
-        retval = *mReadPointer;
-        mReadPointer++;
+        // The span ends at the end of the current message chunk.
+        aSpan  = mReadMessagePointer;
+        length = static_cast<uint16_t>(mReadMessageTail - mReadMessagePointer);
 
-        // Check if at the end of content in message buffer.
-        if (mReadPointer == mReadMessageTail)
+        if (length > aMaxLength)
         {
-            // Fill more bytes from current message into message buffer.
-            error = OutFrameFillMessageBuffer();
+            length = aMaxLength;
+        }
 
-            // If no more bytes in the message, move to next segment (if any).
-            if (error != OT_ERROR_NONE)
+        mReadMessagePointer += length;
+
+        // Check if at the end of current message chunk.
+        if (mReadMessagePointer == mReadMessageTail)
+        {
+            // Move to the next chunk of the current message, if no more bytes in the message, move to next segment
+            // (if any).
+            if (OutFrameNextMessageChunk() != OT_ERROR_NONE)
             {
                 OutFramePrepareSegment();
             }
@@ -749,16 +797,32 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
         break;
     }
 
+    return length;
+}
+
+uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+{
+    const uint8_t *span;
+    uint8_t        retval = kReadByteAfterFrameHasEnded;
+
+    if (OutFrameReadSpan(1, span) != 0)
+    {
+        retval = *span;
+    }
+
     return retval;
 }
 
 uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
-    uint16_t bytesRead = 0;
+    uint16_t       bytesRead = 0;
+    const uint8_t *span;
+    uint16_t       spanLength;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && (spanLength = OutFrameReadSpan(aReadLength - bytesRead, span)) != 0)
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        memcpy(aDataBuffer + bytesRead, span, spanLength);
+        bytesRead += spanLength;
     }
 
     return bytesRead;
@@ -37,6 +37,8 @@
 
 #include <openthread/message.h>
 
+#include "common/message.hpp"
+
 namespace ot {
 namespace Ncp {
 
@@ -394,6 +396,26 @@ public:
      */
     uint16_t OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer);
 
+    /**
+     * This method reads the next contiguous span of bytes from the current output frame.
+     *
+     * The NCP buffer maintains a read offset for the current output frame being read. This method provides a pointer
+     * to the bytes at the read offset which are contiguous in memory (within the frame buffer or within a chunk of an
+     * associated message), up to @p aMaxLength bytes, and moves the read offset forward past them. If read offset is
+     * already at the end of current output frame, this method returns zero.
+     *
+     * The content of a span stays valid until the current output frame is removed (using `OutFrameRemove()`), so a
+     * frame can be handed over as a list of spans (e.g. to a scatter-gather transfer) without copying it.
+     *
+     * @param[in]  aMaxLength           Maximum number of bytes to read.
+     * @param[out] aSpan                A reference to a pointer to output the start of the span.
+     *
+     * @returns The number of bytes in the span, or zero if current output frame has ended or there is no
+     * prepared/active output frame.
+     *
+     */
+    uint16_t OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan);
+
     /**
      * This method removes the current or front output frame from the buffer.
      *
@@ -492,7 +514,9 @@ private:
      * `NcpFrameBuffer` uses the `mBuffer` as a circular/ring buffer. To support two frame priorities the buffer is
      * divided into two high-priority and low-priority regions. The high priority frames are stored in buffer in
      * backward direction while the low-priority frames use the buffer in forward direction. This model ensures the
-     * available buffer space is utilized efficiently between all frame types.
+     * available buffer space is utilized efficiently between all frame types. Once a high-priority frame is finished
+     * (`InFrameEnd()`), the data bytes within each of its segments are reversed in place, so the data of any segment
+     * can be read in forward direction as (at most two, due to wrap-around) contiguous spans.
      *
      *                                       mReadFrameStart[kPriorityLow]
      *                                                 |
@@ -566,7 +590,6 @@ private:
     enum
     {
         kReadByteAfterFrameHasEnded = 0,      // Value returned by ReadByte() when frame has ended.
-        kMessageReadBufferSize      = 16,     // Size of message buffer array `mMessageBuffer`.
         kUnknownFrameLength         = 0xffff, // Value used when frame length is unknown.
         kSegmentHeaderSize          = 2,      // Length of the segment header.
         kSegmentHeaderLengthMask    = 0x3fff, // Bit mask to get the length from the segment header
@@ -608,12 +631,13 @@ private:
     void    InFrameEndSegment(uint16_t aSegmentHeaderFlags);
     void    InFrameDiscard(void);
     bool    InFrameIsWriting(Priority aPriority) const;
+    void    InFrameReverseSegmentData(void);
 
     void    OutFrameSelectReadDirection(void);
     otError OutFramePrepareSegment(void);
     void    OutFrameMoveToNextSegment(void);
     otError OutFramePrepareMessage(void);
-    otError OutFrameFillMessageBuffer(void);
+    otError OutFrameNextMessageChunk(void);
 
     uint8_t *const mBuffer;       // Pointer to the buffer used to store the data.
     uint8_t *const mBufferEnd;    // Points to after the end of buffer.
@@ -640,13 +664,15 @@ private:
     uint8_t *mReadFrameStart[kNumPrios]; // Pointer to start of current frame being read.
     uint8_t *mReadSegmentHead;           // Pointer to start of current segment in the frame being read.
     uint8_t *mReadSegmentTail;           // Pointer to end of current segment in the frame being read.
-    uint8_t *mReadPointer;               // Pointer to next byte to read (either in segment or in msg buffer).
+    uint8_t *mReadPointer;               // Pointer to next byte to read in segment.
+    uint8_t *mReadDataTail;              // Pointer to end of the data in current segment (in forward direction).
 
     otMessage *mReadMessage;       // Current Message in the frame being read.
-    uint16_t   mReadMessageOffset; // Offset within current message being read.
+    uint16_t   mReadMessageLength; // Number of bytes in current message following the current chunk.
 
-    uint8_t  mMessageBuffer[kMessageReadBufferSize]; // Buffer to hold part of current message being read.
-    uint8_t *mReadMessageTail;                       // Pointer to end of current part in mMessageBuffer.
+    Message::Chunk mReadMessageChunk;   // Current chunk of the message being read.
+    const uint8_t *mReadMessagePointer; // Pointer to next byte to read in the current message chunk.
+    const uint8_t *mReadMessageTail;    // Pointer to end of the current message chunk.
 };
 
 } // namespace Ncp
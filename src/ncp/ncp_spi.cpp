@@ -81,7 +81,11 @@ NcpSpi::NcpSpi(Instance *aInstance)
     , mHandlingRxFrame(false)
     , mResetFlag(true)
     , mPrepareTxFrameTask(*aInstance, &NcpSpi::PrepareTxFrame, this)
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    , mTxBatchTimer(*aInstance, &NcpSpi::HandleTxBatchTimer, this)
+#endif
     , mSendFrameLength(0)
+    , mSendFrameBatched(false)
 {
     SpiFrame sendFrame(mSendFrame);
     SpiFrame emptyFullAccept(mEmptySendFrameFullAccept);
@@ -245,10 +249,42 @@ void NcpSpi::HandleFrameAddedToTxBuffer(void *                   aContext,
 {
     OT_UNUSED_VARIABLE(aNcpFrameBuffer);
     OT_UNUSED_VARIABLE(aTag);
+
+    static_cast<NcpSpi *>(aContext)->HandleFrameAddedToTxBuffer(aPriority);
+}
+
+void NcpSpi::HandleFrameAddedToTxBuffer(NcpFrameBuffer::Priority aPriority)
+{
+    bool shouldHold = false;
+
     OT_UNUSED_VARIABLE(aPriority);
 
-    static_cast<NcpSpi *>(aContext)->mPrepareTxFrameTask.Post();
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    // Hold unsolicited frames back for up to the flush deadline,
+    // so that the frames which follow can be batched with them.
+    // Responses (high priority) still go out immediately.
+
+    shouldHold = (kTxBatchFlushDeadline > 0) && (aPriority == NcpFrameBuffer::kPriorityLow) && IsTxBatchingEnabled();
+
+    if (shouldHold && !mTxBatchTimer.IsRunning())
+    {
+        mTxBatchTimer.Start(kTxBatchFlushDeadline);
+    }
+#endif
+
+    if (!shouldHold)
+    {
+        mPrepareTxFrameTask.Post();
+    }
+}
+
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+void NcpSpi::HandleTxBatchTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    static_cast<NcpSpi *>(GetNcpInstance())->mPrepareTxFrameTask.Post();
 }
+#endif
 
 void NcpSpi::PrepareNextSpiSendFrame(void)
 {
@@ -257,27 +293,44 @@ void NcpSpi::PrepareNextSpiSendFrame(void)
     uint16_t readLength;
     SpiFrame sendFrame(mSendFrame);
 
-    VerifyOrExit(!mTxFrameBuffer.IsEmpty());
+    VerifyOrExit(!mTxFrameBuffer.IsEmpty() || mSendFrameBatched);
 
     if (ShouldWakeHost())
     {
         otPlatWakeHost();
     }
 
-    SuccessOrExit(error = mTxFrameBuffer.OutFrameBegin());
+    // A batched frame is no longer in `mTxFrameBuffer`, so if a
+    // previous attempt to prepare its transaction failed, it is
+    // still in `mSendFrame` and is sent as is.
 
-    frameLength = mTxFrameBuffer.OutFrameGetLength();
-    assert(frameLength <= kSpiBufferSize - kSpiHeaderSize);
+    if (!mSendFrameBatched)
+    {
+        // The "accept length" in `mSendFrame` is already updated based
+        // on current state of receive. It is changed either from the
+        // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
+
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+        frameLength       = ReadBatchedTxFrame(sendFrame.GetData(), kTxBatchSize);
+        mSendFrameBatched = (frameLength > 0);
+#else
+        frameLength = 0;
+#endif
 
-    // The "accept length" in `mSendFrame` is already updated based
-    // on current state of receive. It is changed either from the
-    // `SpiTransactionComplete()` callback or from `HandleRxFrame()`.
+        if (!mSendFrameBatched)
+        {
+            SuccessOrExit(error = mTxFrameBuffer.OutFrameBegin());
 
-    readLength = mTxFrameBuffer.OutFrameRead(frameLength, sendFrame.GetData());
-    assert(readLength == frameLength);
+            frameLength = mTxFrameBuffer.OutFrameGetLength();
+            assert(frameLength <= kSpiBufferSize - kSpiHeaderSize);
 
-    sendFrame.SetHeaderDataLen(frameLength);
-    mSendFrameLength = frameLength + kSpiHeaderSize;
+            readLength = mTxFrameBuffer.OutFrameRead(frameLength, sendFrame.GetData());
+            assert(readLength == frameLength);
+        }
+
+        sendFrame.SetHeaderDataLen(frameLength);
+        mSendFrameLength = frameLength + kSpiHeaderSize;
+    }
 
     mTxState = kTxStateSending;
 
@@ -300,7 +353,14 @@ void NcpSpi::PrepareNextSpiSendFrame(void)
         ExitNow();
     }
 
-    mTxFrameBuffer.OutFrameRemove();
+    if (mSendFrameBatched)
+    {
+        mSendFrameBatched = false;
+    }
+    else
+    {
+        mTxFrameBuffer.OutFrameRemove();
+    }
 
 exit:
     return;
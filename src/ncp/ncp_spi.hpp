@@ -35,6 +35,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/timer.hpp"
 #include "ncp/ncp_base.hpp"
 
 namespace ot {
@@ -168,6 +169,20 @@ private:
          *
          */
         kSpiHeaderSize = SpiFrame::kHeaderSize,
+
+        /**
+         * Max length of a batched spinel frame (limited by the SPI buffer size).
+         *
+         */
+        kTxBatchSize = (OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE < kSpiBufferSize - kSpiHeaderSize)
+                           ? OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE
+                           : kSpiBufferSize - kSpiHeaderSize,
+
+        /**
+         * Max time (in milliseconds) an unsolicited frame is held back to be batched with the ones that follow.
+         *
+         */
+        kTxBatchFlushDeadline = OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_FLUSH_DEADLINE,
     };
 
     enum TxState
@@ -199,6 +214,11 @@ private:
                                            NcpFrameBuffer::FrameTag aFrameTag,
                                            NcpFrameBuffer::Priority aPriority,
                                            NcpFrameBuffer *         aNcpFrameBuffer);
+    void        HandleFrameAddedToTxBuffer(NcpFrameBuffer::Priority aPriority);
+
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    static void HandleTxBatchTimer(Timer &aTimer);
+#endif
 
     static void PrepareTxFrame(Tasklet &aTasklet);
     void        PrepareTxFrame(void);
@@ -210,8 +230,12 @@ private:
     volatile bool    mResetFlag;
 
     Tasklet mPrepareTxFrameTask;
+#if OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    TimerMilli mTxBatchTimer;
+#endif
 
     uint16_t         mSendFrameLength;
+    bool             mSendFrameBatched; // `mSendFrame` holds frames already removed from `mTxFrameBuffer`.
     LargeFrameBuffer mSendFrame;
     EmptyFrameBuffer mEmptySendFrameFullAccept;
     EmptyFrameBuffer mEmptySendFrameZeroAccept;
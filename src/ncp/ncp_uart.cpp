@@ -33,6 +33,7 @@
 #include "ncp_uart.hpp"
 
 #include <stdio.h>
+#include <string.h>
 
 #include <openthread/ncp.h>
 #include <openthread/platform/logging.h>
@@ -82,12 +83,16 @@ NcpUart::NcpUart(Instance *aInstance)
     , mFrameDecoder(mRxBuffer, &NcpUart::HandleFrame, this)
     , mUartBuffer()
     , mState(kStartingFrame)
-    , mByte(0)
+    , mTxSpan(NULL)
+    , mTxSpanLength(0)
     , mRxBuffer()
     , mUartSendImmediate(false)
     , mUartSendTask(*aInstance, EncodeAndSendToUart, this)
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
     , mTxFrameBufferEncrypterReader(mTxFrameBuffer)
+#elif OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    , mTxFrameBufferBatchReader(*this, mTxFrameBuffer)
+    , mTxBatchTimer(*aInstance, &NcpUart::HandleTxBatchTimer, this)
 #endif // OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
 {
     mTxFrameBuffer.SetFrameAddedCallback(HandleFrameAddedToNcpBuffer, this);
@@ -102,18 +107,50 @@ void NcpUart::HandleFrameAddedToNcpBuffer(void *                   aContext,
 {
     OT_UNUSED_VARIABLE(aNcpFrameBuffer);
     OT_UNUSED_VARIABLE(aTag);
+
+    static_cast<NcpUart *>(aContext)->HandleFrameAddedToNcpBuffer(aPriority);
+}
+
+void NcpUart::HandleFrameAddedToNcpBuffer(NcpFrameBuffer::Priority aPriority)
+{
+    bool shouldHold = false;
+
     OT_UNUSED_VARIABLE(aPriority);
 
-    static_cast<NcpUart *>(aContext)->HandleFrameAddedToNcpBuffer();
+#if !OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER && OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    // Hold unsolicited frames back for up to the flush deadline,
+    // so that the frames which follow can be batched with them.
+    // Responses (high priority) still go out immediately.
+
+    shouldHold = (kTxBatchFlushDeadline > 0) && (aPriority == NcpFrameBuffer::kPriorityLow) && IsTxBatchingEnabled();
+
+    if (shouldHold && !mTxBatchTimer.IsRunning())
+    {
+        mTxBatchTimer.Start(kTxBatchFlushDeadline);
+    }
+#endif
+
+    if (!shouldHold && mUartBuffer.IsEmpty())
+    {
+        mUartSendTask.Post();
+    }
+}
+
+#if !OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER && OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+void NcpUart::HandleTxBatchTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+    static_cast<NcpUart *>(GetNcpInstance())->HandleTxBatchTimer();
 }
 
-void NcpUart::HandleFrameAddedToNcpBuffer(void)
+void NcpUart::HandleTxBatchTimer(void)
 {
     if (mUartBuffer.IsEmpty())
     {
         mUartSendTask.Post();
     }
 }
+#endif
 
 void NcpUart::EncodeAndSendToUart(Tasklet &aTasklet)
 {
@@ -122,14 +159,17 @@ void NcpUart::EncodeAndSendToUart(Tasklet &aTasklet)
 }
 
 // This method encodes a frame from the tx frame buffer (mTxFrameBuffer) into the uart buffer and sends it over uart.
-// If the uart buffer gets full, it sends the current encoded portion. This method remembers current state, so on
-// sub-sequent calls, it restarts encoding the bytes from where it left of in the frame .
+// The frame is read as contiguous spans which are encoded a run at a time. If the uart buffer gets full, it sends the
+// current encoded portion. This method remembers current state, so on sub-sequent calls, it restarts encoding the
+// bytes from where it left of in the frame .
 void NcpUart::EncodeAndSendToUart(void)
 {
     uint16_t len;
     bool     prevHostPowerState;
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
     NcpFrameBufferEncrypterReader &txFrameBuffer = mTxFrameBufferEncrypterReader;
+#elif OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    NcpFrameBufferBatchReader &txFrameBuffer = mTxFrameBufferBatchReader;
 #else
     NcpFrameBuffer &txFrameBuffer = mTxFrameBuffer;
 #endif // OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
@@ -154,11 +194,16 @@ void NcpUart::EncodeAndSendToUart(void)
 
             while (!txFrameBuffer.OutFrameHasEnded())
             {
-                mByte = txFrameBuffer.OutFrameReadByte();
+                // The frame bytes are encoded in place from the tx frame buffer (a span stays valid until the
+                // frame is removed), no more than fits in an empty uart buffer at a time.
+                mTxSpanLength = txFrameBuffer.OutFrameReadSpan(kUartTxBufferSize, mTxSpan);
 
             case kEncodingFrame:
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte));
+                len = mFrameEncoder.EncodeUpTo(mTxSpan, mTxSpanLength);
+                mTxSpan += len;
+                mTxSpanLength -= len;
+                VerifyOrExit(mTxSpanLength == 0);
             }
 
             // track the change of mHostPowerStateInProgress by the
@@ -352,9 +397,19 @@ bool NcpUart::NcpFrameBufferEncrypterReader::OutFrameHasEnded(void)
     return (mDataBufferReadIndex >= mOutputDataLength);
 }
 
-uint8_t NcpUart::NcpFrameBufferEncrypterReader::OutFrameReadByte(void)
+uint16_t NcpUart::NcpFrameBufferEncrypterReader::OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan)
 {
-    return mDataBuffer[mDataBufferReadIndex++];
+    uint16_t length = static_cast<uint16_t>(mOutputDataLength - mDataBufferReadIndex);
+
+    if (length > aMaxLength)
+    {
+        length = aMaxLength;
+    }
+
+    aSpan = &mDataBuffer[mDataBufferReadIndex];
+    mDataBufferReadIndex += length;
+
+    return length;
 }
 
 otError NcpUart::NcpFrameBufferEncrypterReader::OutFrameRemove(void)
@@ -368,6 +423,67 @@ void NcpUart::NcpFrameBufferEncrypterReader::Reset(void)
     mDataBufferReadIndex = 0;
 }
 
+#elif OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+
+NcpUart::NcpFrameBufferBatchReader::NcpFrameBufferBatchReader(NcpBase &aNcpBase, NcpFrameBuffer &aTxFrameBuffer)
+    : mNcpBase(aNcpBase)
+    , mTxFrameBuffer(aTxFrameBuffer)
+    , mBatchReadIndex(0)
+    , mBatchLength(0)
+{
+}
+
+bool NcpUart::NcpFrameBufferBatchReader::IsEmpty(void) const
+{
+    return mTxFrameBuffer.IsEmpty() && (mBatchLength == 0);
+}
+
+otError NcpUart::NcpFrameBufferBatchReader::OutFrameBegin(void)
+{
+    mBatchReadIndex = 0;
+    mBatchLength    = mNcpBase.ReadBatchedTxFrame(mBatchBuffer, sizeof(mBatchBuffer));
+
+    return (mBatchLength > 0) ? OT_ERROR_NONE : mTxFrameBuffer.OutFrameBegin();
+}
+
+bool NcpUart::NcpFrameBufferBatchReader::OutFrameHasEnded(void)
+{
+    return (mBatchLength > 0) ? (mBatchReadIndex >= mBatchLength) : mTxFrameBuffer.OutFrameHasEnded();
+}
+
+uint16_t NcpUart::NcpFrameBufferBatchReader::OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan)
+{
+    uint16_t length;
+
+    VerifyOrExit(mBatchLength > 0, length = mTxFrameBuffer.OutFrameReadSpan(aMaxLength, aSpan));
+
+    length = static_cast<uint16_t>(mBatchLength - mBatchReadIndex);
+
+    if (length > aMaxLength)
+    {
+        length = aMaxLength;
+    }
+
+    aSpan = &mBatchBuffer[mBatchReadIndex];
+    mBatchReadIndex += length;
+
+exit:
+    return length;
+}
+
+otError NcpUart::NcpFrameBufferBatchReader::OutFrameRemove(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    // The batched frames were already removed from `mTxFrameBuffer`.
+    VerifyOrExit(mBatchLength > 0, error = mTxFrameBuffer.OutFrameRemove());
+
+    mBatchLength = 0;
+
+exit:
+    return error;
+}
+
 #endif // OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
 
 } // namespace Ncp
@@ -35,6 +35,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/timer.hpp"
 #include "ncp/hdlc.hpp"
 #include "ncp/ncp_base.hpp"
 
@@ -78,6 +79,12 @@ private:
                         OPENTHREAD_CONFIG_NCP_SPINEL_ENCRYPTER_EXTRA_DATA_SIZE, // one whole (decoded) received frame).
     };
 
+    enum
+    {
+        kTxBatchSize          = OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_MAX_SIZE,       // Max batched frame size.
+        kTxBatchFlushDeadline = OPENTHREAD_CONFIG_NCP_SPINEL_BATCH_FLUSH_DEADLINE, // Max time (ms) a frame is held.
+    };
+
     enum UartTxState
     {
         kStartingFrame,   // Starting a new frame.
@@ -98,11 +105,11 @@ private:
          * Takes a reference to NcpFrameBuffer in order to read spinel frames.
          */
         explicit NcpFrameBufferEncrypterReader(NcpFrameBuffer &aTxFrameBuffer);
-        bool    IsEmpty(void) const;
-        otError OutFrameBegin(void);
-        bool    OutFrameHasEnded(void);
-        uint8_t OutFrameReadByte(void);
-        otError OutFrameRemove(void);
+        bool     IsEmpty(void) const;
+        otError  OutFrameBegin(void);
+        bool     OutFrameHasEnded(void);
+        uint16_t OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan);
+        otError  OutFrameRemove(void);
 
     private:
         void Reset(void);
@@ -112,13 +119,39 @@ private:
         size_t          mDataBufferReadIndex;
         size_t          mOutputDataLength;
     };
+#elif OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    /**
+     * Wraps NcpFrameBuffer allowing to read unsolicited spinel frames batched into a single frame.
+     * Creates an additional buffer to hold the batched frame.
+     */
+    class NcpFrameBufferBatchReader
+    {
+    public:
+        /**
+         * C-tor.
+         * Takes a reference to NcpBase to batch frames, and to NcpFrameBuffer to read the other frames.
+         */
+        NcpFrameBufferBatchReader(NcpBase &aNcpBase, NcpFrameBuffer &aTxFrameBuffer);
+        bool     IsEmpty(void) const;
+        otError  OutFrameBegin(void);
+        bool     OutFrameHasEnded(void);
+        uint16_t OutFrameReadSpan(uint16_t aMaxLength, const uint8_t *&aSpan);
+        otError  OutFrameRemove(void);
+
+    private:
+        NcpBase &       mNcpBase;
+        NcpFrameBuffer &mTxFrameBuffer;
+        uint8_t         mBatchBuffer[kTxBatchSize];
+        uint16_t        mBatchReadIndex;
+        uint16_t        mBatchLength; // Zero when the current frame is read from `mTxFrameBuffer`.
+    };
 #endif // OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
 
     void EncodeAndSendToUart(void);
     void HandleFrame(otError aError);
     void HandleError(otError aError, uint8_t *aBuf, uint16_t aBufLength);
     void TxFrameBufferHasData(void);
-    void HandleFrameAddedToNcpBuffer(void);
+    void HandleFrameAddedToNcpBuffer(NcpFrameBuffer::Priority aPriority);
 
     static void EncodeAndSendToUart(Tasklet &aTasklet);
     static void HandleFrame(void *aContext, otError aError);
@@ -131,13 +164,20 @@ private:
     Hdlc::Decoder                        mFrameDecoder;
     Hdlc::FrameBuffer<kUartTxBufferSize> mUartBuffer;
     UartTxState                          mState;
-    uint8_t                              mByte;
+    const uint8_t *                      mTxSpan;
+    uint16_t                             mTxSpanLength;
     Hdlc::FrameBuffer<kRxBufferSize>     mRxBuffer;
     bool                                 mUartSendImmediate;
     Tasklet                              mUartSendTask;
 
 #if OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
     NcpFrameBufferEncrypterReader mTxFrameBufferEncrypterReader;
+#elif OPENTHREAD_CONFIG_NCP_SPINEL_BATCHING_ENABLE
+    static void HandleTxBatchTimer(Timer &aTimer);
+    void        HandleTxBatchTimer(void);
+
+    NcpFrameBufferBatchReader mTxFrameBufferBatchReader;
+    TimerMilli                mTxBatchTimer;
 #endif // OPENTHREAD_ENABLE_NCP_SPINEL_ENCRYPTER
 };
 
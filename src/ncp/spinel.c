@@ -1259,6 +1259,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "UNSOL_UPDATE_LIST";
         break;
 
+    case SPINEL_PROP_UNSOL_BATCHING_ENABLED:
+        ret = "UNSOL_BATCHING_ENABLED";
+        break;
+
     case SPINEL_PROP_PHY_ENABLED:
         ret = "PHY_ENABLED";
         break;
@@ -2111,6 +2115,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "DEBUG_TEST_WATCHDOG";
         break;
 
+    case SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS:
+        ret = "DEBUG_NCP_PROPERTY_STATS";
+        break;
+
     default:
         break;
     }
@@ -2504,6 +2512,10 @@ const char *spinel_capability_to_cstr(unsigned int capability)
         ret = "SLAAC";
         break;
 
+    case SPINEL_CAP_UNSOL_BATCHING:
+        ret = "UNSOL_BATCHING";
+        break;
+
     case SPINEL_CAP_ERROR_RATE_TRACKING:
         ret = "ERROR_RATE_TRACKING";
         break;
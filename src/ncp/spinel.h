@@ -716,7 +716,22 @@ enum
 
     SPINEL_CMD_PROP_VALUE_MULTI_GET = 21,
     SPINEL_CMD_PROP_VALUE_MULTI_SET = 22,
-    SPINEL_CMD_PROP_VALUES_ARE      = 23,
+
+    /**
+     * Property values notification (NCP -> Host)
+     *
+     * Encoding: `A(t(iD))`
+     *
+     * Carries a sequence of property key/value pairs, each wrapped in a
+     * length-prefixed struct. This command is equivalent to receiving a
+     * separate `CMD_PROP_VALUE_IS` for each entry, in order.
+     *
+     * When `PROP_UNSOL_BATCHING_ENABLED` is set, the NCP uses this command to
+     * coalesce several queued unsolicited `CMD_PROP_VALUE_IS` frames (TID
+     * zero) into one frame.
+     *
+     */
+    SPINEL_CMD_PROP_VALUES_ARE = 23,
 
     SPINEL_CMD_NEST__BEGIN = 15296,
     SPINEL_CMD_NEST__END   = 15360,
@@ -790,6 +805,7 @@ enum
     SPINEL_CAP_CHILD_SUPERVISION       = (SPINEL_CAP_OPENTHREAD__BEGIN + 8),
     SPINEL_CAP_POSIX_APP               = (SPINEL_CAP_OPENTHREAD__BEGIN + 9),
     SPINEL_CAP_SLAAC                   = (SPINEL_CAP_OPENTHREAD__BEGIN + 10),
+    SPINEL_CAP_UNSOL_BATCHING          = (SPINEL_CAP_OPENTHREAD__BEGIN + 11),
     SPINEL_CAP_OPENTHREAD__END         = 640,
 
     SPINEL_CAP_THREAD__BEGIN        = 1024,
@@ -1197,6 +1213,19 @@ typedef enum
      */
     SPINEL_PROP_UNSOL_UPDATE_LIST = SPINEL_PROP_BASE_EXT__BEGIN + 9,
 
+    /// NCP Unsolicited update batching
+    /** Format: `b`
+     *  Type: Read-Write
+     *  Required capability: `CAP_UNSOL_BATCHING`
+     *
+     * When set to true, the NCP may coalesce unsolicited `CMD_PROP_VALUE_IS`
+     * frames which are queued for the host into a single
+     * `CMD_PROP_VALUES_ARE` frame. Responses to host commands are never
+     * batched. This property is false after reset.
+     *
+     */
+    SPINEL_PROP_UNSOL_BATCHING_ENABLED = SPINEL_PROP_BASE_EXT__BEGIN + 10,
+
     SPINEL_PROP_BASE_EXT__END = 0x1100,
 
     SPINEL_PROP_PHY__BEGIN         = 0x20,
@@ -3488,6 +3517,22 @@ typedef enum
      */
     SPINEL_PROP_DEBUG_TEST_WATCHDOG = SPINEL_PROP_DEBUG__BEGIN + 2,
 
+    /// NCP property handler statistics
+    /** Format: `A(t(CiLL))` (read-only)
+     *
+     * This property is only available when the NCP is built with property handler statistics enabled. It is intended
+     * for profiling the host/NCP interaction.
+     *
+     * Each struct entry reports the statistics of one property handler which has been called at least once:
+     *
+     *  `C` : The spinel command the handler serves (`SPINEL_CMD_PROP_VALUE_GET`, `_SET`, `_INSERT` or `_REMOVE`).
+     *  `i` : The property key.
+     *  `L` : Number of times the handler was called.
+     *  `L` : Cumulative time spent in the handler in microseconds.
+     *
+     */
+    SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS = SPINEL_PROP_DEBUG__BEGIN + 3,
+
     SPINEL_PROP_DEBUG__END = 0x4400,
 
     SPINEL_PROP_EXPERIMENTAL__BEGIN = 2000000,
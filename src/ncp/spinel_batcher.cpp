@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ *    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a spinel batcher.
+ */
+
+#include "spinel_batcher.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+
+namespace ot {
+namespace Ncp {
+
+uint16_t SpinelBatcher::ReadFrame(uint8_t *aBuffer, uint16_t aBufferSize)
+{
+    uint16_t length  = 0;
+    bool     isBatch = false;
+    uint16_t frameLength;
+
+    SuccessOrExit(mNcpBuffer.OutFrameBegin());
+
+    frameLength = mNcpBuffer.OutFrameGetLength();
+
+    // Only the header of the head frame is read first, so a frame
+    // which is not batchable is not copied twice by the caller.
+
+    if ((frameLength <= kFrameHeaderSize) || (frameLength > aBufferSize) ||
+        (mNcpBuffer.OutFrameRead(kFrameHeaderSize, aBuffer) != kFrameHeaderSize) || !IsBatchable(aBuffer))
+    {
+        mNcpBuffer.OutFrameBegin();
+        ExitNow();
+    }
+
+    mNcpBuffer.OutFrameRead(frameLength - kFrameHeaderSize, &aBuffer[kFrameHeaderSize]);
+    mNcpBuffer.OutFrameRemove();
+    length = frameLength;
+
+    // Frames are appended while they are unsolicited `VALUE_IS` frames
+    // for the same interface and fit. Any other frame is left at the
+    // head of the frame buffer for the next read.
+
+    while (mNcpBuffer.OutFrameBegin() == OT_ERROR_NONE)
+    {
+        uint8_t  header[kFrameHeaderSize];
+        uint16_t entryLength;
+
+        frameLength = mNcpBuffer.OutFrameGetLength();
+        VerifyOrExit(frameLength > kFrameHeaderSize);
+
+        entryLength = frameLength - kFrameHeaderSize;
+        VerifyOrExit(static_cast<uint32_t>(length) + (isBatch ? 0 : kEntryLengthFieldSize) + kEntryLengthFieldSize +
+                         entryLength <=
+                     aBufferSize);
+
+        mNcpBuffer.OutFrameRead(kFrameHeaderSize, header);
+        VerifyOrExit((header[0] == aBuffer[0]) && IsBatchable(header));
+
+        if (!isBatch)
+        {
+            // Turn the head frame into the first entry of a `VALUES_ARE` frame.
+            memmove(&aBuffer[kFrameHeaderSize + kEntryLengthFieldSize], &aBuffer[kFrameHeaderSize],
+                    length - kFrameHeaderSize);
+            Encoding::LittleEndian::WriteUint16(static_cast<uint16_t>(length - kFrameHeaderSize),
+                                                &aBuffer[kFrameHeaderSize]);
+            aBuffer[1] = SPINEL_CMD_PROP_VALUES_ARE;
+            length += kEntryLengthFieldSize;
+            isBatch = true;
+        }
+
+        Encoding::LittleEndian::WriteUint16(entryLength, &aBuffer[length]);
+        length += kEntryLengthFieldSize;
+        length += mNcpBuffer.OutFrameRead(entryLength, &aBuffer[length]);
+        mNcpBuffer.OutFrameRemove();
+    }
+
+exit:
+    return length;
+}
+
+} // namespace Ncp
+} // namespace ot
@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ *    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file contains the definitions of a spinel batcher.
+ */
+
+#ifndef SPINEL_BATCHER_HPP_
+#define SPINEL_BATCHER_HPP_
+
+#include "openthread-core-config.h"
+
+#include "ncp/ncp_buffer.hpp"
+#include "ncp/spinel.h"
+
+namespace ot {
+namespace Ncp {
+
+/**
+ * This class defines a spinel batcher.
+ *
+ * The batcher reads frames from a `NcpFrameBuffer`, coalescing consecutive unsolicited `CMD_PROP_VALUE_IS` frames
+ * (TID zero) for the same interface into a single `CMD_PROP_VALUES_ARE` frame, whose payload is a sequence of
+ * length-prefixed key/value structs (`A(t(iD))`).
+ *
+ */
+class SpinelBatcher
+{
+public:
+    enum
+    {
+        kFrameHeaderSize      = 2,                ///< Size of a spinel header byte and a one byte command.
+        kEntryLengthFieldSize = sizeof(uint16_t), ///< Size of the length of each `VALUES_ARE` struct.
+    };
+
+    /**
+     * This constructor initializes a `SpinelBatcher` object.
+     *
+     * @param[in] aNcpBuffer   A reference to a `NcpFrameBuffer` where the frames are read from.
+     *
+     */
+    explicit SpinelBatcher(NcpFrameBuffer &aNcpBuffer)
+        : mNcpBuffer(aNcpBuffer)
+    {
+    }
+
+    /**
+     * This method reads the frame at the head of the frame buffer, batched with the frames that follow it.
+     *
+     * If the head frame is an unsolicited `VALUE_IS` frame which fits in @p aBuffer, it is read and removed from the
+     * frame buffer. The unsolicited `VALUE_IS` frames that follow it are then appended (and removed) for as long as
+     * they fit, turning it into a `VALUES_ARE` frame. A lone frame is written unchanged.
+     *
+     * If zero is returned, no frame is removed, and the head frame (if any) is ready to be read from its start with
+     * `NcpFrameBuffer::OutFrameRead()`.
+     *
+     * @param[out] aBuffer      A pointer to a buffer to write the frame to.
+     * @param[in]  aBufferSize  The size of @p aBuffer (the maximum batched frame length).
+     *
+     * @returns The length of the frame written to @p aBuffer, or zero if the head frame is not batchable.
+     *
+     */
+    uint16_t ReadFrame(uint8_t *aBuffer, uint16_t aBufferSize);
+
+    /**
+     * This static method indicates whether a frame starting with a given header can be batched.
+     *
+     * @param[in] aHeader   A pointer to the first `kFrameHeaderSize` bytes of the frame.
+     *
+     * @retval TRUE   The frame is an unsolicited `VALUE_IS` frame.
+     * @retval FALSE  The frame is not an unsolicited `VALUE_IS` frame.
+     *
+     */
+    static bool IsBatchable(const uint8_t *aHeader)
+    {
+        return (SPINEL_HEADER_GET_TID(aHeader[0]) == 0) && (aHeader[1] == SPINEL_CMD_PROP_VALUE_IS);
+    }
+
+private:
+    NcpFrameBuffer &mNcpBuffer;
+};
+
+} // namespace Ncp
+} // namespace ot
+
+#endif // SPINEL_BATCHER_HPP_
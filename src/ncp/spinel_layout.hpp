@@ -0,0 +1,613 @@
+/*
+ *    Copyright (c) 2019, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ *    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY
+ *    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ *    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ *    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ *    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file contains compile-time spinel layouts, a type-safe alternative to `spinel_datatype_pack()` and
+ *   `spinel_datatype_unpack()`.
+ */
+
+#ifndef SPINEL_LAYOUT_HPP_
+#define SPINEL_LAYOUT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "spinel.h"
+
+namespace ot {
+namespace Ncp {
+
+/**
+ * This structure represents a block of data in a spinel frame (`SPINEL_DATATYPE_DATA_C` or
+ * `SPINEL_DATATYPE_DATA_WLEN_C`).
+ *
+ * When unpacking, `mData` points into the frame being unpacked.
+ *
+ */
+struct SpinelData
+{
+    SpinelData(void)
+        : mData(NULL)
+        , mLength(0)
+    {
+    }
+
+    SpinelData(const uint8_t *aData, uint16_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    const uint8_t *mData;   ///< Pointer to the data.
+    uint16_t       mLength; ///< Length of the data (number of bytes).
+};
+
+/**
+ * This class tracks the write position while packing a spinel frame.
+ *
+ * Like `spinel_datatype_pack()`, it keeps counting the packed size once the buffer is full so that the caller can
+ * tell how large a buffer would have been needed.
+ *
+ */
+class SpinelPackCursor
+{
+public:
+    SpinelPackCursor(uint8_t *aBuffer, spinel_size_t aLength)
+        : mCursor(aBuffer)
+        , mRemaining(aLength)
+        , mSize((aLength <= kMaxPackLength) ? 0 : -1)
+    {
+    }
+
+    uint8_t *Reserve(spinel_size_t aLength)
+    {
+        uint8_t *rval = NULL;
+
+        if (mSize >= 0)
+        {
+            mSize += static_cast<spinel_ssize_t>(aLength);
+
+            if (mRemaining >= aLength)
+            {
+                rval = mCursor;
+                mCursor += aLength;
+                mRemaining -= aLength;
+            }
+            else
+            {
+                mRemaining = 0;
+            }
+        }
+
+        return rval;
+    }
+
+    void           SetError(void) { mSize = -1; }
+    spinel_ssize_t GetResult(void) const { return mSize; }
+
+private:
+    enum
+    {
+        kMaxPackLength = 32767, // Same as `SPINEL_MAX_PACK_LENGTH` in `spinel.c`.
+    };
+
+    uint8_t *      mCursor;
+    spinel_size_t  mRemaining;
+    spinel_ssize_t mSize;
+};
+
+/**
+ * This class tracks the read position while unpacking a spinel frame.
+ *
+ */
+class SpinelUnpackCursor
+{
+public:
+    SpinelUnpackCursor(const uint8_t *aBuffer, spinel_size_t aLength)
+        : mCursor(aBuffer)
+        , mRemaining(aLength)
+        , mSize((aLength <= kMaxPackLength) ? 0 : -1)
+    {
+    }
+
+    const uint8_t *Consume(spinel_size_t aLength)
+    {
+        const uint8_t *rval = NULL;
+
+        if (mSize >= 0 && mRemaining >= aLength)
+        {
+            rval = mCursor;
+            mCursor += aLength;
+            mRemaining -= aLength;
+            mSize += static_cast<spinel_ssize_t>(aLength);
+        }
+        else
+        {
+            mSize = -1;
+        }
+
+        return rval;
+    }
+
+    spinel_size_t  GetRemaining(void) const { return (mSize >= 0) ? mRemaining : 0; }
+    void           SetError(void) { mSize = -1; }
+    spinel_ssize_t GetResult(void) const { return mSize; }
+
+private:
+    enum
+    {
+        kMaxPackLength = 32767, // Same as `SPINEL_MAX_PACK_LENGTH` in `spinel.c`.
+    };
+
+    const uint8_t *mCursor;
+    spinel_size_t  mRemaining;
+    spinel_ssize_t mSize;
+};
+
+/**
+ * This namespace defines the field types which can be used in a `SpinelLayout`.
+ *
+ * Each field type provides its spinel format character (`kFormat`), the type passed when packing (`PackType`), the
+ * type filled in when unpacking (`UnpackType`), and inline `Pack()` and `Unpack()` functions.
+ *
+ */
+namespace SpinelField {
+
+/**
+ * This type is used for the unused trailing fields of a `SpinelLayout`.
+ *
+ */
+struct None
+{
+    struct Empty
+    {
+    };
+
+    enum
+    {
+        kFormat = 0,
+    };
+
+    typedef Empty PackType;
+    typedef Empty UnpackType;
+
+    static void Pack(SpinelPackCursor &, PackType) {}
+    static void Unpack(SpinelUnpackCursor &, UnpackType *) {}
+};
+
+/**
+ * This template implements the little-endian integer field types.
+ *
+ */
+template <typename Type, typename UintType, char kFormatChar> struct Integer
+{
+    enum
+    {
+        kFormat = kFormatChar,
+    };
+
+    typedef Type PackType;
+    typedef Type UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, PackType aValue)
+    {
+        UintType value = static_cast<UintType>(aValue);
+        uint8_t *buf   = aCursor.Reserve(sizeof(UintType));
+
+        if (buf != NULL)
+        {
+            for (size_t i = 0; i < sizeof(UintType); i++)
+            {
+                buf[i] = static_cast<uint8_t>(value >> (8 * i));
+            }
+        }
+    }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        const uint8_t *buf = aCursor.Consume(sizeof(UintType));
+
+        if (buf != NULL && aValue != NULL)
+        {
+            UintType value = 0;
+
+            for (size_t i = 0; i < sizeof(UintType); i++)
+            {
+                value |= static_cast<UintType>(static_cast<UintType>(buf[i]) << (8 * i));
+            }
+
+            *aValue = static_cast<Type>(value);
+        }
+    }
+};
+
+typedef Integer<uint8_t, uint8_t, SPINEL_DATATYPE_UINT8_C>    Uint8;  ///< `SPINEL_DATATYPE_UINT8_C`
+typedef Integer<int8_t, uint8_t, SPINEL_DATATYPE_INT8_C>      Int8;   ///< `SPINEL_DATATYPE_INT8_C`
+typedef Integer<uint16_t, uint16_t, SPINEL_DATATYPE_UINT16_C> Uint16; ///< `SPINEL_DATATYPE_UINT16_C`
+typedef Integer<int16_t, uint16_t, SPINEL_DATATYPE_INT16_C>   Int16;  ///< `SPINEL_DATATYPE_INT16_C`
+typedef Integer<uint32_t, uint32_t, SPINEL_DATATYPE_UINT32_C> Uint32; ///< `SPINEL_DATATYPE_UINT32_C`
+typedef Integer<int32_t, uint32_t, SPINEL_DATATYPE_INT32_C>   Int32;  ///< `SPINEL_DATATYPE_INT32_C`
+typedef Integer<uint64_t, uint64_t, SPINEL_DATATYPE_UINT64_C> Uint64; ///< `SPINEL_DATATYPE_UINT64_C`
+typedef Integer<int64_t, uint64_t, SPINEL_DATATYPE_INT64_C>   Int64;  ///< `SPINEL_DATATYPE_INT64_C`
+
+/**
+ * This type implements `SPINEL_DATATYPE_BOOL_C`.
+ *
+ */
+struct Bool
+{
+    enum
+    {
+        kFormat = SPINEL_DATATYPE_BOOL_C,
+    };
+
+    typedef bool PackType;
+    typedef bool UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, PackType aValue)
+    {
+        uint8_t *buf = aCursor.Reserve(sizeof(uint8_t));
+
+        if (buf != NULL)
+        {
+            buf[0] = aValue ? 1 : 0;
+        }
+    }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        const uint8_t *buf = aCursor.Consume(sizeof(uint8_t));
+
+        if (buf != NULL && aValue != NULL)
+        {
+            *aValue = (buf[0] != 0);
+        }
+    }
+};
+
+/**
+ * This type implements `SPINEL_DATATYPE_UINT_PACKED_C`.
+ *
+ */
+struct UintPacked
+{
+    enum
+    {
+        kFormat = SPINEL_DATATYPE_UINT_PACKED_C,
+    };
+
+    typedef unsigned int PackType;
+    typedef unsigned int UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, PackType aValue)
+    {
+        spinel_size_t size = 1;
+        uint8_t *     buf;
+
+        if (aValue >= SPINEL_MAX_UINT_PACKED)
+        {
+            aCursor.SetError();
+            return;
+        }
+
+        for (unsigned int value = aValue >> 7; value != 0; value >>= 7)
+        {
+            size++;
+        }
+
+        buf = aCursor.Reserve(size);
+
+        if (buf != NULL)
+        {
+            for (spinel_size_t i = 0; i < size - 1; i++)
+            {
+                *buf++ = static_cast<uint8_t>((aValue & 0x7f) | 0x80);
+                aValue >>= 7;
+            }
+
+            *buf = static_cast<uint8_t>(aValue & 0x7f);
+        }
+    }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        unsigned int   value = 0;
+        unsigned int   shift = 0;
+        const uint8_t *buf;
+
+        do
+        {
+            buf = aCursor.Consume(sizeof(uint8_t));
+
+            if (buf == NULL || shift >= sizeof(unsigned int) * 8)
+            {
+                aCursor.SetError();
+                return;
+            }
+
+            value |= static_cast<unsigned int>(buf[0] & 0x7f) << shift;
+            shift += 7;
+        } while (buf[0] & 0x80);
+
+        if (value >= SPINEL_MAX_UINT_PACKED)
+        {
+            aCursor.SetError();
+        }
+        else if (aValue != NULL)
+        {
+            *aValue = value;
+        }
+    }
+};
+
+/**
+ * This template implements the fixed-size byte array field types.
+ *
+ * When unpacking, the field is set to point into the frame being unpacked.
+ *
+ */
+template <spinel_size_t kSize, char kFormatChar> struct Bytes
+{
+    enum
+    {
+        kFormat = kFormatChar,
+    };
+
+    typedef const uint8_t *PackType;
+    typedef const uint8_t *UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, PackType aValue)
+    {
+        uint8_t *buf = aCursor.Reserve(kSize);
+
+        if (buf != NULL)
+        {
+            memcpy(buf, aValue, kSize);
+        }
+    }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        const uint8_t *buf = aCursor.Consume(kSize);
+
+        if (buf != NULL && aValue != NULL)
+        {
+            *aValue = buf;
+        }
+    }
+};
+
+typedef Bytes<sizeof(spinel_eui64_t), SPINEL_DATATYPE_EUI64_C>      Eui64;    ///< `SPINEL_DATATYPE_EUI64_C`
+typedef Bytes<sizeof(spinel_ipv6addr_t), SPINEL_DATATYPE_IPv6ADDR_C> Ipv6Addr; ///< `SPINEL_DATATYPE_IPv6ADDR_C`
+
+/**
+ * This type implements `SPINEL_DATATYPE_DATA_WLEN_C`, data prefixed by its 16-bit length.
+ *
+ * A spinel struct (`SPINEL_DATATYPE_STRUCT_C`) has the same encoding, so this type can also be used to read a whole
+ * struct, which can then be unpacked with its own `SpinelLayout`.
+ *
+ */
+struct DataWlen
+{
+    enum
+    {
+        kFormat = SPINEL_DATATYPE_DATA_WLEN_C,
+    };
+
+    typedef SpinelData PackType;
+    typedef SpinelData UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, const PackType &aValue)
+    {
+        Uint16::Pack(aCursor, aValue.mLength);
+        PackBytes(aCursor, aValue);
+    }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        uint16_t       length = 0;
+        const uint8_t *buf;
+
+        Uint16::Unpack(aCursor, &length);
+
+        if (length >= SPINEL_FRAME_MAX_SIZE)
+        {
+            aCursor.SetError();
+            return;
+        }
+
+        buf = aCursor.Consume(length);
+
+        if (buf != NULL && aValue != NULL)
+        {
+            aValue->mData   = buf;
+            aValue->mLength = length;
+        }
+    }
+
+    static void PackBytes(SpinelPackCursor &aCursor, const PackType &aValue)
+    {
+        uint8_t *buf = aCursor.Reserve(aValue.mLength);
+
+        if (buf != NULL && aValue.mLength > 0)
+        {
+            memcpy(buf, aValue.mData, aValue.mLength);
+        }
+    }
+};
+
+/**
+ * This type implements `SPINEL_DATATYPE_DATA_C`, data extending to the end of the frame.
+ *
+ * It must be the last field of a `SpinelLayout`.
+ *
+ */
+struct Data
+{
+    enum
+    {
+        kFormat = SPINEL_DATATYPE_DATA_C,
+    };
+
+    typedef SpinelData PackType;
+    typedef SpinelData UnpackType;
+
+    static void Pack(SpinelPackCursor &aCursor, const PackType &aValue) { DataWlen::PackBytes(aCursor, aValue); }
+
+    static void Unpack(SpinelUnpackCursor &aCursor, UnpackType *aValue)
+    {
+        uint16_t       length = static_cast<uint16_t>(aCursor.GetRemaining());
+        const uint8_t *buf    = aCursor.Consume(length);
+
+        if (buf != NULL && aValue != NULL)
+        {
+            aValue->mData   = buf;
+            aValue->mLength = length;
+        }
+    }
+};
+
+} // namespace SpinelField
+
+/**
+ * This class template packs and unpacks a spinel frame whose layout is given by its field types (see `SpinelField`).
+ *
+ * The layout is resolved at compile time: `Pack()` and `Unpack()` inline the code for each field, with no format
+ * string to interpret and no `va_list`. The return values follow `spinel_datatype_pack()` and
+ * `spinel_datatype_unpack()`, so the two can be used interchangeably, e.g.
+ *
+ *     SpinelLayout<SpinelField::Uint8, SpinelField::UintPacked, SpinelField::UintPacked>::Pack(buf, len, h, c, k)
+ *
+ * packs the same bytes as
+ *
+ *     spinel_datatype_pack(buf, len, "Cii", h, c, k)
+ *
+ */
+template <typename F1,
+          typename F2 = SpinelField::None,
+          typename F3 = SpinelField::None,
+          typename F4 = SpinelField::None,
+          typename F5 = SpinelField::None,
+          typename F6 = SpinelField::None,
+          typename F7 = SpinelField::None,
+          typename F8 = SpinelField::None>
+class SpinelLayout
+{
+public:
+    /**
+     * This static method returns the equivalent `spinel_datatype_pack()` format string.
+     *
+     * @returns The format string.
+     *
+     */
+    static const char *GetFormat(void)
+    {
+        static const char sFormat[] = {F1::kFormat, F2::kFormat, F3::kFormat, F4::kFormat, F5::kFormat,
+                                       F6::kFormat, F7::kFormat, F8::kFormat, 0};
+
+        return sFormat;
+    }
+
+    /**
+     * This static method packs the fields into a buffer.
+     *
+     * @param[out] aBuffer   A pointer to the output buffer.
+     * @param[in]  aLength   The size of @p aBuffer.
+     * @param[in]  aArg1     The first field (more fields follow, one per field type of the layout).
+     *
+     * @returns The packed length (which may exceed @p aLength if the buffer is too small), or -1 on failure.
+     *
+     */
+    static spinel_ssize_t Pack(uint8_t *                    aBuffer,
+                               spinel_size_t                aLength,
+                               const typename F1::PackType &aArg1,
+                               const typename F2::PackType &aArg2 = typename F2::PackType(),
+                               const typename F3::PackType &aArg3 = typename F3::PackType(),
+                               const typename F4::PackType &aArg4 = typename F4::PackType(),
+                               const typename F5::PackType &aArg5 = typename F5::PackType(),
+                               const typename F6::PackType &aArg6 = typename F6::PackType(),
+                               const typename F7::PackType &aArg7 = typename F7::PackType(),
+                               const typename F8::PackType &aArg8 = typename F8::PackType())
+    {
+        SpinelPackCursor cursor(aBuffer, aLength);
+
+        F1::Pack(cursor, aArg1);
+        F2::Pack(cursor, aArg2);
+        F3::Pack(cursor, aArg3);
+        F4::Pack(cursor, aArg4);
+        F5::Pack(cursor, aArg5);
+        F6::Pack(cursor, aArg6);
+        F7::Pack(cursor, aArg7);
+        F8::Pack(cursor, aArg8);
+
+        return cursor.GetResult();
+    }
+
+    /**
+     * This static method unpacks the fields from a buffer.
+     *
+     * Any of the field pointers may be NULL to skip over the field. Bytes following the last field are ignored.
+     *
+     * @param[in]  aBuffer   A pointer to the buffer to unpack.
+     * @param[in]  aLength   The length of @p aBuffer.
+     * @param[out] aArg1     A pointer to the first field (more fields follow, one per field type of the layout).
+     *
+     * @returns The number of bytes unpacked, or -1 on failure.
+     *
+     */
+    static spinel_ssize_t Unpack(const uint8_t *          aBuffer,
+                                 spinel_size_t            aLength,
+                                 typename F1::UnpackType *aArg1,
+                                 typename F2::UnpackType *aArg2 = NULL,
+                                 typename F3::UnpackType *aArg3 = NULL,
+                                 typename F4::UnpackType *aArg4 = NULL,
+                                 typename F5::UnpackType *aArg5 = NULL,
+                                 typename F6::UnpackType *aArg6 = NULL,
+                                 typename F7::UnpackType *aArg7 = NULL,
+                                 typename F8::UnpackType *aArg8 = NULL)
+    {
+        SpinelUnpackCursor cursor(aBuffer, aLength);
+
+        F1::Unpack(cursor, aArg1);
+        F2::Unpack(cursor, aArg2);
+        F3::Unpack(cursor, aArg3);
+        F4::Unpack(cursor, aArg4);
+        F5::Unpack(cursor, aArg5);
+        F6::Unpack(cursor, aArg6);
+        F7::Unpack(cursor, aArg7);
+        F8::Unpack(cursor, aArg8);
+
+        return cursor.GetResult();
+    }
+};
+
+} // namespace Ncp
+} // namespace ot
+
+#endif // SPINEL_LAYOUT_HPP_
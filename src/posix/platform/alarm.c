@@ -30,10 +30,19 @@
 #include "platform-posix.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#define POSIX_ALARM_USE_TIMERFD 1
+#include <sys/timerfd.h>
+#else
+#define POSIX_ALARM_USE_TIMERFD 0
+#endif
 
 #include <openthread/platform/alarm-micro.h>
 #include <openthread/platform/alarm-milli.h>
@@ -51,6 +60,11 @@ static uint32_t sUsAlarm     = 0;
 
 static uint32_t sSpeedUpFactor = 1;
 
+#if POSIX_ALARM_USE_TIMERFD
+static int      sTimerFd       = -1;
+static uint64_t sTimerDeadline = 0; ///< The armed timerfd deadline (CLOCK_MONOTONIC, in us), zero if disarmed.
+#endif
+
 #if !OPENTHREAD_POSIX_VIRTUAL_TIME
 uint64_t otSysGetTime(void)
 {
@@ -67,9 +81,48 @@ static uint64_t platformAlarmGetNow(void)
     return otSysGetTime() * sSpeedUpFactor;
 }
 
+#if POSIX_ALARM_USE_TIMERFD
+static void handleTimerFd(otInstance *aInstance, void *aContext)
+{
+    uint64_t expirations;
+
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aContext);
+
+    // Only drain the timerfd here, expired alarms are fired from `platformAlarmProcess()`.
+    if (read(sTimerFd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+    {
+        perror("read(timerfd)");
+    }
+}
+
+static void armTimerFd(uint64_t aDeadline)
+{
+    struct itimerspec spec;
+
+    otEXPECT(aDeadline != sTimerDeadline);
+
+    memset(&spec, 0, sizeof(spec));
+    spec.it_value.tv_sec  = (time_t)(aDeadline / US_PER_S);
+    spec.it_value.tv_nsec = (long)(aDeadline % US_PER_S) * NS_PER_US;
+
+    VerifyOrDie(timerfd_settime(sTimerFd, TFD_TIMER_ABSTIME, &spec, NULL) == 0, OT_EXIT_FAILURE);
+    sTimerDeadline = aDeadline;
+
+exit:
+    return;
+}
+#endif // POSIX_ALARM_USE_TIMERFD
+
 void platformAlarmInit(uint32_t aSpeedUpFactor)
 {
     sSpeedUpFactor = aSpeedUpFactor;
+
+#if POSIX_ALARM_USE_TIMERFD
+    sTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrDie(sTimerFd != -1, OT_EXIT_FAILURE);
+    SuccessOrDie(platformPollerAdd(sTimerFd, handleTimerFd, NULL));
+#endif
 }
 
 uint32_t otPlatAlarmMilliGetNow(void)
@@ -147,6 +200,20 @@ exit:
         aTimeout->tv_sec  = 0;
         aTimeout->tv_usec = 0;
     }
+#if POSIX_ALARM_USE_TIMERFD
+    else if (remaining == INT32_MAX)
+    {
+        // No alarm is running.
+        armTimerFd(0);
+    }
+    else
+    {
+        // The deadline is rounded up so that the alarm has expired when the timerfd fires. It only depends on the
+        // alarm deadline (and not on `now`), so the timerfd is re-armed only when the alarm changes. The mainloop
+        // timeout is left to the other drivers.
+        armTimerFd(now / sSpeedUpFactor + (uint64_t)((remaining + sSpeedUpFactor - 1) / sSpeedUpFactor));
+    }
+#else
     else
     {
         remaining /= sSpeedUpFactor;
@@ -159,6 +226,7 @@ exit:
         aTimeout->tv_sec  = (time_t)(remaining / US_PER_S);
         aTimeout->tv_usec = remaining % US_PER_S;
     }
+#endif // POSIX_ALARM_USE_TIMERFD
 }
 
 void platformAlarmProcess(otInstance *aInstance)
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file implements exchanging messages with file descriptors in place.
+ */
+
+#include "message_io.hpp"
+
+#include <assert.h>
+#include <stdio.h>
+#include <sys/uio.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace PosixApp {
+
+enum
+{
+    kBufferDataSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE - sizeof(otMessage),
+    kMaxIovecs      = kMaxMessageIoSize / kBufferDataSize + 3, ///< Message buffers of the largest datagram.
+};
+
+otError ReadMessage(int aFd, Message *aMessage)
+{
+    static uint8_t sOverflow[kMaxMessageIoSize];
+
+    struct iovec           iov[kMaxIovecs + 1];
+    int                    iovCount = 0;
+    uint16_t               capacity = 0;
+    uint16_t               length;
+    Message::WritableChunk chunk;
+    ssize_t                rval;
+    otError                error = OT_ERROR_NONE;
+
+    if (aMessage == NULL)
+    {
+        // The datagram is still read (and dropped), otherwise the file descriptor would stay readable.
+        error = OT_ERROR_NO_BUFS;
+    }
+    else
+    {
+        capacity = aMessage->GetAvailableLength();
+
+        if (capacity > kMaxMessageIoSize)
+        {
+            capacity = kMaxMessageIoSize;
+        }
+
+        // Growing the message up to its available length never reclaims buffers, so this cannot fail.
+        error = aMessage->SetLength(capacity);
+        assert(error == OT_ERROR_NONE);
+
+        length = capacity;
+
+        for (aMessage->GetFirstChunk(0, length, chunk); chunk.GetLength() > 0; aMessage->GetNextChunk(length, chunk))
+        {
+            assert(iovCount < kMaxIovecs);
+            iov[iovCount].iov_base = chunk.GetData();
+            iov[iovCount].iov_len  = chunk.GetLength();
+            iovCount++;
+        }
+    }
+
+    if (capacity < kMaxMessageIoSize)
+    {
+        iov[iovCount].iov_base = sOverflow;
+        iov[iovCount].iov_len  = kMaxMessageIoSize - capacity;
+        iovCount++;
+    }
+
+    rval = readv(aFd, iov, iovCount);
+    VerifyOrExit(rval > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(error == OT_ERROR_NONE);
+
+    SuccessOrExit(error = aMessage->SetLength(static_cast<uint16_t>(rval)));
+
+    if (rval > capacity)
+    {
+        aMessage->Write(capacity, static_cast<uint16_t>(rval - capacity), sOverflow);
+    }
+
+exit:
+    return error;
+}
+
+otError WriteMessage(int aFd, const Message &aMessage)
+{
+    struct iovec   iov[kMaxIovecs];
+    int            iovCount = 0;
+    uint16_t       length   = aMessage.GetLength();
+    Message::Chunk chunk;
+    otError        error = OT_ERROR_NONE;
+
+    VerifyOrExit(length <= kMaxMessageIoSize, error = OT_ERROR_NO_BUFS);
+
+    for (aMessage.GetFirstChunk(0, length, chunk); chunk.GetLength() > 0; aMessage.GetNextChunk(length, chunk))
+    {
+        assert(iovCount < kMaxIovecs);
+        iov[iovCount].iov_base = const_cast<uint8_t *>(chunk.GetData());
+        iov[iovCount].iov_len  = chunk.GetLength();
+        iovCount++;
+    }
+
+    VerifyOrExit(writev(aFd, iov, iovCount) == aMessage.GetLength(), perror("writev"); error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+} // namespace PosixApp
+} // namespace ot
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definitions for exchanging messages with file descriptors in place.
+ */
+
+#ifndef POSIX_APP_MESSAGE_IO_HPP_
+#define POSIX_APP_MESSAGE_IO_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/error.h>
+
+#include "common/message.hpp"
+
+namespace ot {
+namespace PosixApp {
+
+enum
+{
+    kMaxMessageIoSize = 1536, ///< Maximum size (number of bytes) of a datagram read or written by a message.
+};
+
+/**
+ * This function reads one datagram from a file descriptor directly into the buffer chain of a message.
+ *
+ * The message is grown to `kMaxMessageIoSize`, or to its available length if smaller, so that no buffers are
+ * reclaimed from other messages before the datagram length is known. After the read the message is set to the
+ * datagram length, which returns the unused buffers. Only a datagram longer than the available length is read partly
+ * into a scratch buffer, and that part is copied once the buffers it needs are reclaimed.
+ *
+ * @param[in]  aFd       A file descriptor preserving datagram boundaries, e.g. a TUN device.
+ * @param[in]  aMessage  A pointer to an empty message, or NULL to read and drop the datagram.
+ *
+ * @retval OT_ERROR_NONE       A datagram was read into @p aMessage.
+ * @retval OT_ERROR_NO_BUFS    A datagram was read and dropped for lack of message buffers.
+ * @retval OT_ERROR_NOT_FOUND  There was no datagram to read.
+ *
+ */
+otError ReadMessage(int aFd, Message *aMessage);
+
+/**
+ * This function writes a message to a file descriptor as one datagram, straight from its buffer chain.
+ *
+ * @param[in]  aFd       A file descriptor preserving datagram boundaries, e.g. a TUN device.
+ * @param[in]  aMessage  A reference to the message.
+ *
+ * @retval OT_ERROR_NONE     The message was written.
+ * @retval OT_ERROR_NO_BUFS  The message is longer than `kMaxMessageIoSize`.
+ * @retval OT_ERROR_FAILED   The write failed.
+ *
+ */
+otError WriteMessage(int aFd, const Message &aMessage);
+
+} // namespace PosixApp
+} // namespace ot
+
+#endif // POSIX_APP_MESSAGE_IO_HPP_
@@ -0,0 +1,299 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a message buffer pool which grows on demand.
+ *
+ *   Buffers are carved out of chunks allocated from the heap. Chunks are never released while the instance is running,
+ *   so a buffer is always recycled through the free list. They are released when the pool is initialized again for a
+ *   new instance.
+ *
+ */
+
+#include "openthread-core-config.h"
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <openthread/platform/messagepool.h>
+
+#include "code_utils.h"
+
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
+/**
+ * This structure represents a chunk of buffers allocated from the heap, the buffers follow the header.
+ *
+ */
+typedef struct Chunk
+{
+    struct Chunk *mNext;
+} Chunk;
+
+static Chunk *    sChunks         = NULL;
+static otMessage *sFreeBuffers    = NULL;
+static size_t     sBufferSize     = 0;
+static uint16_t   sNumBuffers     = 0; ///< Number of buffers allocated from the heap.
+static uint16_t   sNumUsedBuffers = 0;
+static uint16_t   sMaxNumBuffers  = 0;
+
+static void growPool(void)
+{
+    uint16_t count = OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_CHUNK_BUFFERS;
+    Chunk *  chunk;
+    uint8_t *buffers;
+
+    if (count > sMaxNumBuffers - sNumBuffers)
+    {
+        count = sMaxNumBuffers - sNumBuffers;
+    }
+
+    otEXPECT(count > 0);
+    otEXPECT((chunk = (Chunk *)calloc(1, sizeof(Chunk) + count * sBufferSize)) != NULL);
+
+    chunk->mNext = sChunks;
+    sChunks      = chunk;
+    buffers      = (uint8_t *)(chunk + 1);
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        otMessage *buffer = (otMessage *)(buffers + i * sBufferSize);
+
+        buffer->mNext = sFreeBuffers;
+        sFreeBuffers  = buffer;
+    }
+
+    sNumBuffers += count;
+
+exit:
+    return;
+}
+
+void otPlatMessagePoolInit(otInstance *aInstance, uint16_t aMinNumFreeBuffers, size_t aBufferSize)
+{
+    (void)aInstance;
+
+    assert(aBufferSize >= sizeof(otMessage));
+
+    // The pool belongs to a single instance, any buffer of a previous instance is gone with it.
+    while (sChunks != NULL)
+    {
+        Chunk *next = sChunks->mNext;
+
+        free(sChunks);
+        sChunks = next;
+    }
+
+    sFreeBuffers    = NULL;
+    sNumBuffers     = 0;
+    sNumUsedBuffers = 0;
+    sBufferSize    = aBufferSize;
+    sMaxNumBuffers = OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_MAX_BUFFERS;
+
+    if (sMaxNumBuffers < aMinNumFreeBuffers)
+    {
+        sMaxNumBuffers = aMinNumFreeBuffers;
+    }
+}
+
+otMessage *otPlatMessagePoolNew(otInstance *aInstance)
+{
+    otMessage *buffer = NULL;
+
+    (void)aInstance;
+
+    if (sFreeBuffers == NULL)
+    {
+        growPool();
+    }
+
+    otEXPECT(sFreeBuffers != NULL);
+
+    buffer        = sFreeBuffers;
+    sFreeBuffers  = buffer->mNext;
+    buffer->mNext = NULL;
+    sNumUsedBuffers++;
+
+exit:
+    return buffer;
+}
+
+void otPlatMessagePoolFree(otInstance *aInstance, otMessage *aBuffer)
+{
+    (void)aInstance;
+
+    aBuffer->mNext = sFreeBuffers;
+    sFreeBuffers   = aBuffer;
+    sNumUsedBuffers--;
+}
+
+uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *aInstance)
+{
+    (void)aInstance;
+
+    // Buffers not yet allocated from the heap are reported as free, so the core only evicts messages once the pool has
+    // reached its ceiling.
+    return sMaxNumBuffers - sNumUsedBuffers;
+}
+
+#if SELF_TEST
+
+#include <stdio.h>
+#include <string.h>
+
+enum
+{
+    kTestBufferSize = 128,
+    kMaxBuffers     = OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_MAX_BUFFERS,
+    kChunkBuffers   = OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_CHUNK_BUFFERS,
+    kExtraBuffers   = 3, ///< Number of buffers above the ceiling requested by the core.
+};
+
+static otMessage *sBuffers[kMaxBuffers + kExtraBuffers];
+
+static uint16_t getExpectedNumBuffers(uint16_t aNumUsed, uint16_t aMaxNumBuffers)
+{
+    uint16_t numBuffers = ((aNumUsed + kChunkBuffers - 1) / kChunkBuffers) * kChunkBuffers;
+
+    return (numBuffers < aMaxNumBuffers) ? numBuffers : aMaxNumBuffers;
+}
+
+static void fillBuffer(otMessage *aBuffer, uint16_t aIndex)
+{
+    // Leave the `mNext` link alone, it is only owned by the pool while the buffer is free.
+    memset((uint8_t *)aBuffer + sizeof(otMessage), (uint8_t)aIndex, kTestBufferSize - sizeof(otMessage));
+}
+
+static void verifyBuffer(const otMessage *aBuffer, uint16_t aIndex)
+{
+    const uint8_t *data = (const uint8_t *)aBuffer + sizeof(otMessage);
+
+    for (size_t i = 0; i < kTestBufferSize - sizeof(otMessage); i++)
+    {
+        assert(data[i] == (uint8_t)aIndex);
+    }
+}
+
+int main(void)
+{
+    uint16_t numUsed = 0;
+
+    otPlatMessagePoolInit(NULL, 0, kTestBufferSize);
+
+    // Nothing is allocated from the heap until the first buffer is requested.
+
+    assert(sNumBuffers == 0);
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == kMaxBuffers);
+
+    // The pool grows one chunk at a time up to its ceiling.
+
+    for (; numUsed < kMaxBuffers; numUsed++)
+    {
+        otMessage *buffer = otPlatMessagePoolNew(NULL);
+
+        assert(buffer != NULL);
+        assert(sNumBuffers == getExpectedNumBuffers(numUsed + 1, kMaxBuffers));
+        assert(otPlatMessagePoolNumFreeBuffers(NULL) == kMaxBuffers - numUsed - 1);
+
+        fillBuffer(buffer, numUsed);
+        sBuffers[numUsed] = buffer;
+    }
+
+    assert(otPlatMessagePoolNew(NULL) == NULL);
+    assert(sNumBuffers == kMaxBuffers);
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == 0);
+
+    // Buffers from different chunks do not overlap.
+
+    for (uint16_t i = 0; i < numUsed; i++)
+    {
+        verifyBuffer(sBuffers[i], i);
+    }
+
+    // Freed buffers are recycled without growing the pool.
+
+    for (uint16_t i = 0; i < numUsed; i += 2)
+    {
+        otPlatMessagePoolFree(NULL, sBuffers[i]);
+    }
+
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == (kMaxBuffers + 1) / 2);
+
+    for (uint16_t i = 0; i < numUsed; i += 2)
+    {
+        sBuffers[i] = otPlatMessagePoolNew(NULL);
+        assert(sBuffers[i] != NULL);
+        fillBuffer(sBuffers[i], i);
+    }
+
+    assert(otPlatMessagePoolNew(NULL) == NULL);
+    assert(sNumBuffers == kMaxBuffers);
+
+    for (uint16_t i = 0; i < numUsed; i++)
+    {
+        verifyBuffer(sBuffers[i], i);
+    }
+
+    // Initializing the pool again releases all chunks.
+
+    otPlatMessagePoolInit(NULL, 0, kTestBufferSize);
+    assert(sChunks == NULL);
+    assert(sFreeBuffers == NULL);
+    assert(sNumBuffers == 0);
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == kMaxBuffers);
+
+    // The ceiling is raised to the number of buffers the core requires.
+
+    otPlatMessagePoolInit(NULL, kMaxBuffers + kExtraBuffers, kTestBufferSize);
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == kMaxBuffers + kExtraBuffers);
+
+    for (numUsed = 0; numUsed < kMaxBuffers + kExtraBuffers; numUsed++)
+    {
+        sBuffers[numUsed] = otPlatMessagePoolNew(NULL);
+        assert(sBuffers[numUsed] != NULL);
+    }
+
+    assert(otPlatMessagePoolNew(NULL) == NULL);
+    assert(sNumBuffers == kMaxBuffers + kExtraBuffers);
+
+    for (uint16_t i = 0; i < numUsed; i++)
+    {
+        otPlatMessagePoolFree(NULL, sBuffers[i]);
+    }
+
+    assert(otPlatMessagePoolNumFreeBuffers(NULL) == kMaxBuffers + kExtraBuffers);
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#endif // SELF_TEST
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
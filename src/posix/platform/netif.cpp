@@ -57,8 +57,11 @@
 #include <openthread/ip6.h>
 #include <openthread/message.h>
 
+#include "message_io.hpp"
+#include "openthread-system.h"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/message.hpp"
 #include "net/ip6_address.hpp"
 
 #if OPENTHREAD_ENABLE_PLATFORM_NETIF
@@ -82,7 +85,7 @@ static int          sNetlinkFd = -1; ///< Used to receive netlink events.
 static unsigned int sTunIndex  = 0;
 static char         sTunName[IFNAMSIZ];
 
-static const size_t kMaxIp6Size = 1536;
+static otSysNetifCounters sCounters;
 
 static void UpdateUnicast(otInstance *aInstance, const otIp6Address &aAddress, uint8_t aPrefixLength, bool aIsAdded)
 {
@@ -197,17 +200,15 @@ static void processStateChange(otChangedFlags aFlags, void *aContext)
 
 static void processReceive(otMessage *aMessage, void *aContext)
 {
-    char     packet[kMaxIp6Size];
-    otError  error  = OT_ERROR_NONE;
-    uint16_t length = otMessageGetLength(aMessage);
+    otError error = OT_ERROR_NONE;
 
     assert(sInstance == aContext);
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, packet, sizeof(packet)) == length, error = OT_ERROR_NO_BUFS);
-
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    // Write the message straight from its buffer chain.
+    SuccessOrExit(error = ot::PosixApp::WriteMessage(sTunFd, *static_cast<ot::Message *>(aMessage)));
+    sCounters.mTunWritePackets++;
 
 exit:
     otMessageFree(aMessage);
@@ -222,22 +223,22 @@ exit:
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+/**
+ * This function reads one packet from the TUN device, directly into the buffers of a message, and sends it into the
+ * Thread network.
+ *
+ * @retval OT_ERROR_NONE      A packet was read and sent.
+ * @retval OT_ERROR_NO_BUFS   A packet was read and dropped for lack of message buffers.
+ * @retval OT_ERROR_FAILED    A packet was read and the send failed.
+ * @retval OT_ERROR_NOT_FOUND There was no packet to read.
+ *
+ */
+static otError transmitTunPacket(otInstance *aInstance)
 {
-    otMessage *message = NULL;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error = OT_ERROR_NONE;
-
-    assert(sInstance == aInstance);
-
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
+    ot::Message *message = static_cast<ot::Message *>(otIp6NewMessage(aInstance, NULL));
+    otError      error;
 
-    message = otIp6NewMessage(aInstance, NULL);
-    VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
-
-    SuccessOrExit(error = otMessageAppend(message, packet, static_cast<uint16_t>(rval)));
+    SuccessOrExit(error = ot::PosixApp::ReadMessage(sTunFd, message));
 
     error   = otIp6Send(aInstance, message);
     message = NULL;
@@ -245,17 +246,45 @@ static void processTransmit(otInstance *aInstance)
 exit:
     if (message != NULL)
     {
-        otMessageFree(message);
+        message->Free();
+    }
+
+    if (error == OT_ERROR_NO_BUFS)
+    {
+        sCounters.mTunReadNoBufsDrops++;
     }
 
     if (error == OT_ERROR_NONE)
     {
         otLogInfoPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
-    else
+    else if (error != OT_ERROR_NOT_FOUND)
     {
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    uint32_t count = 0;
+
+    assert(sInstance == aInstance);
+
+    // The TUN device is non-blocking, so this drains the pending packets up to the batch size.
+    while (count < OPENTHREAD_CONFIG_POSIX_NETIF_TUN_BATCH_SIZE && transmitTunPacket(aInstance) != OT_ERROR_NOT_FOUND)
+    {
+        count++;
+    }
+
+    sCounters.mTunReadWakeups++;
+    sCounters.mTunReadPackets += count;
+
+    if (count > sCounters.mTunMaxPacketsPerWakeup)
+    {
+        sCounters.mTunMaxPacketsPerWakeup = count;
+    }
 }
 
 static void processNetifAddrEvent(otInstance *aInstance, struct nlmsghdr *aNetlinkMessage)
@@ -420,6 +449,9 @@ void platformNetifInit(otInstance *aInstance)
                  otLogCritPlat("Unable to set link type of tun device %s", OPENTHREAD_POSIX_TUN_DEVICE));
 #endif
 
+    // Packets are drained in batches, see `processTransmit()`.
+    VerifyOrExit(fcntl(sTunFd, F_SETFL, fcntl(sTunFd, F_GETFL) | O_NONBLOCK) == 0, perror("fcntl"));
+
     sTunIndex = if_nametoindex(ifr.ifr_name);
     VerifyOrExit(sTunIndex > 0);
 
@@ -518,4 +550,14 @@ exit:
     return;
 }
 
+const otSysNetifCounters *otSysGetNetifCounters(void)
+{
+    return &sCounters;
+}
+
+void otSysResetNetifCounters(void)
+{
+    memset(&sCounters, 0, sizeof(sCounters));
+}
+
 #endif // OPENTHREAD_ENABLE_PLATFORM_NETIF
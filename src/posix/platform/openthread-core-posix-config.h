@@ -54,4 +54,24 @@
 
 #define OPENTHREAD_CONFIG_UART_CLI_RAW 1
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+ *
+ * The POSIX app provides a message pool which grows on demand (see `message_pool.c`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+ *
+ * Code size is not a concern on POSIX, so the HDLC FCS is computed with the slice-by-8 tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8
+#define OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_8 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -118,6 +118,35 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop);
  */
 void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop);
 
+/**
+ * This structure represents the counters of the platform network interface.
+ *
+ */
+typedef struct otSysNetifCounters
+{
+    uint32_t mTunReadWakeups;         ///< Number of wake-ups with the TUN device readable.
+    uint32_t mTunReadPackets;         ///< Number of packets read from the TUN device.
+    uint32_t mTunMaxPacketsPerWakeup; ///< Largest number of packets read from the TUN device in one wake-up.
+    uint32_t mTunReadNoBufsDrops;     ///< Number of packets read from the TUN device dropped for lack of buffers.
+    uint32_t mTunWritePackets;        ///< Number of packets written to the TUN device.
+} otSysNetifCounters;
+
+/**
+ * This function gets the counters of the platform network interface.
+ *
+ * The average number of packets read per wake-up is `mTunReadPackets / mTunReadWakeups`.
+ *
+ * @returns A pointer to the platform network interface counters.
+ *
+ */
+const otSysNetifCounters *otSysGetNetifCounters(void);
+
+/**
+ * This function resets the counters of the platform network interface.
+ *
+ */
+void otSysResetNetifCounters(void);
+
 /**
  * This function is called whenever platform drivers needs processing.
  *
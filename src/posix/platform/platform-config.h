@@ -51,3 +51,60 @@
 #ifndef OPENTHREAD_POSIX_APP_SOCKET_BASENAME
 #define OPENTHREAD_POSIX_APP_SOCKET_BASENAME "/tmp/openthread"
 #endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_MAX_BUFFERS
+ *
+ * The maximum number of message buffers the POSIX platform message pool may grow to.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_MAX_BUFFERS
+#define OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_MAX_BUFFERS 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_CHUNK_BUFFERS
+ *
+ * The number of message buffers allocated at once each time the POSIX platform message pool grows.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_CHUNK_BUFFERS
+#define OPENTHREAD_CONFIG_POSIX_MESSAGE_POOL_CHUNK_BUFFERS 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+ *
+ * Define as 1 to dispatch the file descriptors registered with the platform poller (e.g. platform UDP sockets) through
+ * epoll, and to drive the millisecond/microsecond alarm deadlines with a timerfd.
+ *
+ * When disabled, registered file descriptors are added to the mainloop `fd_set`s one by one.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+#ifdef __linux__
+#define OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL 1
+#else
+#define OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL 0
+#endif
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_NETIF_TUN_BATCH_SIZE
+ *
+ * The maximum number of packets read from the TUN device each time it is readable.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_NETIF_TUN_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_NETIF_TUN_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE
+ *
+ * The maximum number of datagrams received from or sent to a platform UDP socket with a single system call.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE
+#define OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE 8
+#endif
@@ -360,22 +360,80 @@ uint64_t otSysGetTime(void);
 void platformUdpInit(const char *aIfName);
 
 /**
- * This function performs platform UDP driver processing.
+ * This function sends the datagrams queued by `otPlatUdpSend()`.
  *
- * @param[in]   aInstance   The OpenThread instance structure.
- * @param[in]   aReadFdSet  A pointer to the read file descriptors.
+ * It is called before waiting for events, so datagrams sent while processing the same wake-up share system calls.
+ *
+ */
+void platformUdpFlush(void);
+
+/**
+ * This function pointer is called when a file descriptor registered with the platform poller becomes readable.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aContext   A pointer to the context given at registration.
  *
  */
-void platformUdpProcess(otInstance *aInstance, const fd_set *aReadSet);
+typedef void (*platformPollerHandler)(otInstance *aInstance, void *aContext);
 
 /**
- * This function updates the file descriptor sets with file descriptors used by the platform UDP driver.
+ * This function initializes the platform poller.
+ *
+ */
+void platformPollerInit(void);
+
+/**
+ * This function shuts down the platform poller.
+ *
+ */
+void platformPollerDeinit(void);
+
+/**
+ * This function registers a file descriptor with the platform poller.
+ *
+ * The registration persists until `platformPollerRemove()` is called. While registered, @p aHandler is called from
+ * `platformPollerProcess()` each time @p aFd is readable.
+ *
+ * @param[in]  aFd        The file descriptor.
+ * @param[in]  aHandler   The function to call when @p aFd is readable.
+ * @param[in]  aContext   A pointer to arbitrary context information passed to @p aHandler.
+ *
+ * @retval OT_ERROR_NONE          Successfully registered @p aFd.
+ * @retval OT_ERROR_INVALID_ARGS  @p aFd is invalid or @p aHandler is NULL.
+ * @retval OT_ERROR_ALREADY       @p aFd is already registered.
+ * @retval OT_ERROR_NO_BUFS       Failed to allocate the registration.
+ * @retval OT_ERROR_FAILED        Failed to add @p aFd to the epoll set.
+ *
+ */
+otError platformPollerAdd(int aFd, platformPollerHandler aHandler, void *aContext);
+
+/**
+ * This function removes a file descriptor from the platform poller.
+ *
+ * This function MUST be called before @p aFd is closed.
+ *
+ * @param[in]  aFd  The file descriptor.
+ *
+ */
+void platformPollerRemove(int aFd);
+
+/**
+ * This function updates the file descriptor sets with file descriptors used by the platform poller.
  *
- * @param[in]     aInstance    The OpenThread instance structure.
  * @param[inout]  aReadFdSet   A pointer to the read file descriptors.
  * @param[inout]  aMaxFd       A pointer to the max file descriptor.
+ *
+ */
+void platformPollerUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd);
+
+/**
+ * This function calls the handlers of the registered file descriptors which are readable.
+ *
+ * @param[in]   aInstance   The OpenThread instance structure.
+ * @param[in]   aReadFdSet  A pointer to the read file descriptors.
+ *
  */
-void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd);
+void platformPollerProcess(otInstance *aInstance, const fd_set *aReadFdSet);
 
 /**
  * This function ends the current process with exit code @p aExitCode if @p aCondition is false.
@@ -0,0 +1,477 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the platform poller, which dispatches readable file descriptors to per-descriptor handlers.
+ *
+ *   With epoll, registrations persist in the kernel and only the epoll file descriptor is added to the mainloop
+ *   `fd_set`s, so the cost of a wake-up does not depend on the number of registered file descriptors and registered
+ *   file descriptors are not limited by `FD_SETSIZE`.
+ *
+ */
+
+#include "openthread-core-config.h"
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#include "code_utils.h"
+
+typedef struct PollerEntry
+{
+    platformPollerHandler mHandler;
+    void *                mContext;
+} PollerEntry;
+
+enum
+{
+    kInitialNumEntries = 64,
+};
+
+static PollerEntry *sEntries    = NULL; ///< Registrations indexed by file descriptor.
+static int          sNumEntries = 0;
+
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+enum
+{
+    kMaxEventsPerProcess = 32, ///< Remaining ready file descriptors are reported again on the next wake-up.
+};
+
+static int sEpollFd = -1;
+#else
+static int sMaxFd = -1; ///< The highest registered file descriptor.
+#endif
+
+static otError growEntries(int aFd)
+{
+    otError      error      = OT_ERROR_NONE;
+    int          numEntries = (sNumEntries == 0) ? kInitialNumEntries : sNumEntries;
+    PollerEntry *entries;
+
+    while (numEntries <= aFd)
+    {
+        numEntries *= 2;
+    }
+
+    entries = (PollerEntry *)realloc(sEntries, (size_t)numEntries * sizeof(PollerEntry));
+    otEXPECT_ACTION(entries != NULL, error = OT_ERROR_NO_BUFS);
+
+    memset(entries + sNumEntries, 0, (size_t)(numEntries - sNumEntries) * sizeof(PollerEntry));
+
+    sEntries    = entries;
+    sNumEntries = numEntries;
+
+exit:
+    return error;
+}
+
+static void dispatch(otInstance *aInstance, int aFd)
+{
+    // The handler of a file descriptor processed earlier in the same wake-up may have removed this one.
+    otEXPECT(aFd < sNumEntries && sEntries[aFd].mHandler != NULL);
+
+    sEntries[aFd].mHandler(aInstance, sEntries[aFd].mContext);
+
+exit:
+    return;
+}
+
+void platformPollerInit(void)
+{
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    sEpollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (sEpollFd == -1)
+    {
+        perror("epoll_create1");
+        exit(OT_EXIT_FAILURE);
+    }
+#endif
+}
+
+void platformPollerDeinit(void)
+{
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    if (sEpollFd != -1)
+    {
+        close(sEpollFd);
+        sEpollFd = -1;
+    }
+#else
+    sMaxFd = -1;
+#endif
+
+    free(sEntries);
+    sEntries    = NULL;
+    sNumEntries = 0;
+}
+
+otError platformPollerAdd(int aFd, platformPollerHandler aHandler, void *aContext)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(aFd >= 0 && aHandler != NULL, error = OT_ERROR_INVALID_ARGS);
+#if !OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    otEXPECT_ACTION(aFd < FD_SETSIZE, error = OT_ERROR_INVALID_ARGS);
+#endif
+
+    if (aFd >= sNumEntries)
+    {
+        otEXPECT((error = growEntries(aFd)) == OT_ERROR_NONE);
+    }
+
+    otEXPECT_ACTION(sEntries[aFd].mHandler == NULL, error = OT_ERROR_ALREADY);
+
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    {
+        struct epoll_event event;
+
+        memset(&event, 0, sizeof(event));
+        event.events  = EPOLLIN;
+        event.data.fd = aFd;
+
+        otEXPECT_ACTION(epoll_ctl(sEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OT_ERROR_FAILED);
+    }
+#else
+    if (sMaxFd < aFd)
+    {
+        sMaxFd = aFd;
+    }
+#endif
+
+    sEntries[aFd].mHandler = aHandler;
+    sEntries[aFd].mContext = aContext;
+
+exit:
+    return error;
+}
+
+void platformPollerRemove(int aFd)
+{
+    otEXPECT(aFd >= 0 && aFd < sNumEntries && sEntries[aFd].mHandler != NULL);
+
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    {
+        // Kernels before 2.6.9 require a non-NULL event even for `EPOLL_CTL_DEL`.
+        struct epoll_event event;
+
+        memset(&event, 0, sizeof(event));
+
+        if (epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, &event) != 0)
+        {
+            perror("epoll_ctl");
+        }
+    }
+#endif
+
+    sEntries[aFd].mHandler = NULL;
+    sEntries[aFd].mContext = NULL;
+
+#if !OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    while (sMaxFd >= 0 && sEntries[sMaxFd].mHandler == NULL)
+    {
+        sMaxFd--;
+    }
+#endif
+
+exit:
+    return;
+}
+
+void platformPollerUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd)
+{
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    FD_SET(sEpollFd, aReadFdSet);
+
+    if (aMaxFd != NULL && *aMaxFd < sEpollFd)
+    {
+        *aMaxFd = sEpollFd;
+    }
+#else
+    for (int fd = 0; fd <= sMaxFd; fd++)
+    {
+        if (sEntries[fd].mHandler != NULL)
+        {
+            FD_SET(fd, aReadFdSet);
+        }
+    }
+
+    if (aMaxFd != NULL && *aMaxFd < sMaxFd)
+    {
+        *aMaxFd = sMaxFd;
+    }
+#endif
+}
+
+void platformPollerProcess(otInstance *aInstance, const fd_set *aReadFdSet)
+{
+#if OPENTHREAD_CONFIG_POSIX_ENABLE_EPOLL
+    struct epoll_event events[kMaxEventsPerProcess];
+    int                count;
+
+    otEXPECT(FD_ISSET(sEpollFd, aReadFdSet));
+
+    count = epoll_wait(sEpollFd, events, kMaxEventsPerProcess, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        dispatch(aInstance, events[i].data.fd);
+    }
+
+exit:
+    return;
+#else
+    for (int fd = 0; fd <= sMaxFd; fd++)
+    {
+        if (FD_ISSET(fd, aReadFdSet))
+        {
+            dispatch(aInstance, fd);
+        }
+    }
+#endif
+}
+
+#if SELF_TEST
+
+#include <sys/socket.h>
+#include <time.h>
+
+uint64_t gNodeId = 1;
+
+enum
+{
+    kNumSockets = 400, ///< Two file descriptors per socket pair, this keeps the legacy path below `FD_SETSIZE`.
+    kNumWakeups = 2000,
+};
+
+static int      sSockets[kNumSockets];
+static int      sPeers[kNumSockets];
+static int      sLastReadFd = -1;
+static uint32_t sNumReads   = 0;
+
+static uint64_t getNowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void handleReadable(otInstance *aInstance, void *aContext)
+{
+    int     fd = (int)(intptr_t)aContext;
+    char    byte;
+    ssize_t rval;
+
+    (void)aInstance;
+
+    rval = read(fd, &byte, sizeof(byte));
+    assert(rval == (ssize_t)sizeof(byte));
+    (void)rval;
+
+    sLastReadFd = fd;
+    sNumReads++;
+}
+
+static void wakeUp(int aIndex)
+{
+    char    byte = 0;
+    ssize_t rval;
+
+    rval = write(sPeers[aIndex], &byte, sizeof(byte));
+    assert(rval == (ssize_t)sizeof(byte));
+    (void)rval;
+}
+
+// Mirrors the former platform UDP driver, which added every socket to the `fd_set` and checked every socket
+// with `FD_ISSET()` on each wake-up.
+static uint64_t benchmarkSelect(void)
+{
+    uint64_t elapsed = 0;
+
+    for (int wakeup = 0; wakeup < kNumWakeups; wakeup++)
+    {
+        int            index = (wakeup * 7919) % kNumSockets;
+        fd_set         readFdSet;
+        int            maxFd   = -1;
+        struct timeval timeout = {1, 0};
+        uint64_t       start;
+        int            rval;
+
+        wakeUp(index);
+        start = getNowNs();
+
+        FD_ZERO(&readFdSet);
+
+        for (int i = 0; i < kNumSockets; i++)
+        {
+            FD_SET(sSockets[i], &readFdSet);
+
+            if (maxFd < sSockets[i])
+            {
+                maxFd = sSockets[i];
+            }
+        }
+
+        rval = select(maxFd + 1, &readFdSet, NULL, NULL, &timeout);
+        assert(rval == 1);
+        (void)rval;
+
+        for (int i = 0; i < kNumSockets; i++)
+        {
+            if (FD_ISSET(sSockets[i], &readFdSet))
+            {
+                handleReadable(NULL, (void *)(intptr_t)sSockets[i]);
+            }
+        }
+
+        elapsed += getNowNs() - start;
+        assert(sLastReadFd == sSockets[index]);
+    }
+
+    return elapsed;
+}
+
+static uint64_t benchmarkPoller(void)
+{
+    uint64_t elapsed = 0;
+
+    for (int wakeup = 0; wakeup < kNumWakeups; wakeup++)
+    {
+        int            index = (wakeup * 7919) % kNumSockets;
+        fd_set         readFdSet;
+        int            maxFd   = -1;
+        struct timeval timeout = {1, 0};
+        uint64_t       start;
+        int            rval;
+
+        wakeUp(index);
+        start = getNowNs();
+
+        FD_ZERO(&readFdSet);
+        platformPollerUpdateFdSet(&readFdSet, &maxFd);
+        rval = select(maxFd + 1, &readFdSet, NULL, NULL, &timeout);
+        assert(rval >= 1);
+        (void)rval;
+        platformPollerProcess(NULL, &readFdSet);
+
+        elapsed += getNowNs() - start;
+        assert(sLastReadFd == sSockets[index]);
+    }
+
+    return elapsed;
+}
+
+int main(void)
+{
+    uint64_t selectElapsed;
+    uint64_t pollerElapsed;
+    otError  error;
+    int      rval;
+
+    platformPollerInit();
+
+    for (int i = 0; i < kNumSockets; i++)
+    {
+        int fds[2];
+
+        rval = socketpair(AF_UNIX, SOCK_DGRAM, 0, fds);
+        assert(rval == 0);
+        sSockets[i] = fds[0];
+        sPeers[i]   = fds[1];
+    }
+
+    // verify registration
+    error = platformPollerAdd(-1, handleReadable, NULL);
+    assert(error == OT_ERROR_INVALID_ARGS);
+    error = platformPollerAdd(sSockets[0], NULL, NULL);
+    assert(error == OT_ERROR_INVALID_ARGS);
+
+    for (int i = 0; i < kNumSockets; i++)
+    {
+        error = platformPollerAdd(sSockets[i], handleReadable, (void *)(intptr_t)sSockets[i]);
+        assert(error == OT_ERROR_NONE);
+    }
+
+    error = platformPollerAdd(sSockets[0], handleReadable, NULL);
+    assert(error == OT_ERROR_ALREADY);
+
+    // verify a removed file descriptor is not dispatched
+    platformPollerRemove(sSockets[1]);
+    wakeUp(1);
+    wakeUp(2);
+    {
+        fd_set         readFdSet;
+        int            maxFd   = -1;
+        struct timeval timeout = {1, 0};
+
+        FD_ZERO(&readFdSet);
+        platformPollerUpdateFdSet(&readFdSet, &maxFd);
+        rval = select(maxFd + 1, &readFdSet, NULL, NULL, &timeout);
+        assert(rval >= 1);
+        platformPollerProcess(NULL, &readFdSet);
+        assert(sNumReads == 1 && sLastReadFd == sSockets[2]);
+    }
+    error = platformPollerAdd(sSockets[1], handleReadable, (void *)(intptr_t)sSockets[1]);
+    assert(error == OT_ERROR_NONE);
+    (void)error;
+    (void)rval;
+    handleReadable(NULL, (void *)(intptr_t)sSockets[1]);
+
+    selectElapsed = benchmarkSelect();
+    pollerElapsed = benchmarkPoller();
+
+    printf("%d sockets, %d wake-ups\n", kNumSockets, kNumWakeups);
+    printf("  select + FD_ISSET walk : %8llu ns/wake-up\n", (unsigned long long)(selectElapsed / kNumWakeups));
+    printf("  platform poller        : %8llu ns/wake-up\n", (unsigned long long)(pollerElapsed / kNumWakeups));
+
+    for (int i = 0; i < kNumSockets; i++)
+    {
+        platformPollerRemove(sSockets[i]);
+        close(sSockets[i]);
+        close(sPeers[i]);
+    }
+
+    platformPollerDeinit();
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#endif // SELF_TEST
@@ -35,11 +35,13 @@
 #include "platform-posix.h"
 
 #include "radio_spinel.hpp"
+#include "spinel_layout.hpp"
 
 #include <assert.h>
 #include <errno.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -64,6 +66,50 @@ static ot::PosixApp::RadioSpinel sRadioSpinel;
 namespace ot {
 namespace PosixApp {
 
+using Ncp::SpinelData;
+using Ncp::SpinelLayout;
+namespace SpinelField = Ncp::SpinelField;
+
+// Header, command and property key.
+typedef SpinelLayout<SpinelField::Uint8, SpinelField::UintPacked, SpinelField::UintPacked> SpinelCommandLayout;
+
+// Header, command, property key and the property value.
+typedef SpinelLayout<SpinelField::Uint8, SpinelField::UintPacked, SpinelField::UintPacked, SpinelField::Data>
+    SpinelFrameLayout;
+
+// Header, command and the command payload.
+typedef SpinelLayout<SpinelField::Uint8, SpinelField::UintPacked, SpinelField::Data> SpinelNotificationLayout;
+
+// Property key and the property value (a `VALUE_IS` payload).
+typedef SpinelLayout<SpinelField::UintPacked, SpinelField::Data> SpinelPropertyLayout;
+
+// One length-prefixed key/value struct of a `VALUES_ARE` payload.
+typedef SpinelLayout<SpinelField::DataWlen> SpinelValuesAreEntryLayout;
+
+// Received frame, RSSI, noise floor, flags, PHY-data struct and vendor-data struct.
+typedef SpinelLayout<SpinelField::DataWlen,
+                     SpinelField::Int8,
+                     SpinelField::Int8,
+                     SpinelField::Uint16,
+                     SpinelField::DataWlen,
+                     SpinelField::DataWlen>
+    RadioFrameLayout;
+
+// PHY-data: channel, LQI, timestamp (ms) and timestamp (us).
+typedef SpinelLayout<SpinelField::Uint8, SpinelField::Uint8, SpinelField::Uint32, SpinelField::Uint16>
+    RadioFramePhyDataLayout;
+
+// Header, command, property key, frame, channel, max CSMA backoffs, max frame retries and CSMA/CA enabled.
+typedef SpinelLayout<SpinelField::Uint8,
+                     SpinelField::UintPacked,
+                     SpinelField::UintPacked,
+                     SpinelField::DataWlen,
+                     SpinelField::Uint8,
+                     SpinelField::Uint8,
+                     SpinelField::Uint8,
+                     SpinelField::Bool>
+    TransmitFrameLayout;
+
 static otError SpinelStatusToOtError(spinel_status_t aError)
 {
     otError ret;
@@ -161,6 +207,7 @@ RadioSpinel::RadioSpinel(void)
     , mCmdNextTid(1)
     , mTxRadioTid(0)
     , mWaitingTid(0)
+    , mAsyncTids(0)
     , mWaitingKey(SPINEL_PROP_LAST_STATUS)
     , mPropertyFormat(NULL)
     , mExpectedCommand(0)
@@ -175,6 +222,10 @@ RadioSpinel::RadioSpinel(void)
     , mIsPromiscuous(false)
     , mIsReady(false)
     , mSupportsLogStream(false)
+    , mSrcMatchEnabled(false)
+    , mResyncPending(0)
+    , mResyncAttempts(0)
+    , mAsyncFailureCount(0)
 #if OPENTHREAD_ENABLE_DIAG
     , mDiagMode(false)
     , mDiagOutput(NULL)
@@ -183,6 +234,8 @@ RadioSpinel::RadioSpinel(void)
     , mTxRadioEndUs(UINT64_MAX)
 {
     mVersion[0] = '\0';
+    memset(&mExtendedAddress, 0, sizeof(mExtendedAddress));
+    ClearAsyncRequests();
 }
 
 void RadioSpinel::Init(const char *aRadioFile, const char *aRadioConfig)
@@ -238,9 +291,10 @@ otError RadioSpinel::CheckCapabilities(void)
 {
     otError        error = OT_ERROR_NONE;
     uint8_t        capsBuffer[kCapsBufferSize];
-    const uint8_t *capsData         = capsBuffer;
-    spinel_size_t  capsLength       = sizeof(capsBuffer);
-    bool           supportsRawRadio = false;
+    const uint8_t *capsData              = capsBuffer;
+    spinel_size_t  capsLength            = sizeof(capsBuffer);
+    bool           supportsRawRadio      = false;
+    bool           supportsUnsolBatching = false;
 
     SuccessOrExit(error = Get(SPINEL_PROP_CAPS, SPINEL_DATATYPE_DATA_S, capsBuffer, &capsLength));
 
@@ -262,6 +316,11 @@ otError RadioSpinel::CheckCapabilities(void)
             supportsRawRadio = true;
         }
 
+        if (capability == SPINEL_CAP_UNSOL_BATCHING)
+        {
+            supportsUnsolBatching = true;
+        }
+
         capsData += unpacked;
         capsLength -= static_cast<spinel_size_t>(unpacked);
     }
@@ -272,6 +331,12 @@ otError RadioSpinel::CheckCapabilities(void)
         exit(OT_EXIT_RADIO_SPINEL_INCOMPATIBLE);
     }
 
+    if (supportsUnsolBatching)
+    {
+        // Let the RCP coalesce received frames and other notifications.
+        SuccessOrExit(error = Set(SPINEL_PROP_UNSOL_BATCHING_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
+    }
+
 exit:
     return error;
 }
@@ -312,7 +377,7 @@ void RadioSpinel::HandleSpinelFrame(HdlcInterface::RxFrameBuffer &aFrameBuffer)
     uint8_t        header;
     spinel_ssize_t unpacked;
 
-    unpacked = spinel_datatype_unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), "C", &header);
+    unpacked = SpinelLayout<SpinelField::Uint8>::Unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), &header);
 
     VerifyOrExit(unpacked > 0 && (header & SPINEL_HEADER_FLAG) == SPINEL_HEADER_FLAG &&
                      SPINEL_HEADER_GET_IID(header) == 0,
@@ -339,22 +404,27 @@ exit:
 void RadioSpinel::HandleNotification(HdlcInterface::RxFrameBuffer &aFrameBuffer)
 {
     spinel_prop_key_t key;
-    spinel_size_t     len = 0;
+    unsigned int      keyValue = 0;
     spinel_ssize_t    unpacked;
-    uint8_t *         data = NULL;
-    uint32_t          cmd;
-    uint8_t           header;
+    SpinelData        payload;
+    SpinelData        data;
+    unsigned int      cmd             = 0;
+    uint8_t           header          = 0;
     otError           error           = OT_ERROR_NONE;
     bool              shouldSaveFrame = false;
 
-    unpacked = spinel_datatype_unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), "CiiD", &header, &cmd, &key,
-                                      &data, &len);
+    unpacked = SpinelNotificationLayout::Unpack(aFrameBuffer.GetFrame(), aFrameBuffer.GetLength(), &header, &cmd,
+                                                &payload);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0, error = OT_ERROR_PARSE);
 
     switch (cmd)
     {
     case SPINEL_CMD_PROP_VALUE_IS:
+        unpacked = SpinelPropertyLayout::Unpack(payload.mData, payload.mLength, &keyValue, &data);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        key = static_cast<spinel_prop_key_t>(keyValue);
+
         // Some spinel properties cannot be handled during `WaitResponse()`, we must cache these events.
         // `mWaitingTid` is released immediately after received the response. And `mWaitingKey` is be set
         // to `SPINEL_PROP_LAST_STATUS` at the end of `WaitResponse()`.
@@ -364,7 +434,19 @@ void RadioSpinel::HandleNotification(HdlcInterface::RxFrameBuffer &aFrameBuffer)
             ExitNow(shouldSaveFrame = true);
         }
 
-        HandleValueIs(key, data, static_cast<uint16_t>(len));
+        HandleValueIs(key, data.mData, data.mLength);
+        break;
+
+    case SPINEL_CMD_PROP_VALUES_ARE:
+        // A batch is cached as a whole if any of its properties cannot be
+        // handled now, so that the notifications are handled in order.
+
+        if (!IsSafeToHandleNow(payload.mData, payload.mLength))
+        {
+            ExitNow(shouldSaveFrame = true);
+        }
+
+        error = HandleValuesAre(payload.mData, payload.mLength);
         break;
 
     case SPINEL_CMD_PROP_VALUE_INSERTED:
@@ -391,49 +473,114 @@ exit:
 
 void RadioSpinel::HandleNotification(const uint8_t *aFrame, uint16_t aLength)
 {
-    spinel_prop_key_t key;
-    spinel_size_t     len = 0;
-    spinel_ssize_t    unpacked;
-    uint8_t *         data = NULL;
-    uint32_t          cmd;
-    uint8_t           header;
-    otError           error = OT_ERROR_NONE;
+    unsigned int   key = 0;
+    spinel_ssize_t unpacked;
+    SpinelData     payload;
+    SpinelData     data;
+    unsigned int   cmd    = 0;
+    uint8_t        header = 0;
+    otError        error  = OT_ERROR_NONE;
 
-    unpacked = spinel_datatype_unpack(aFrame, aLength, "CiiD", &header, &cmd, &key, &data, &len);
+    unpacked = SpinelNotificationLayout::Unpack(aFrame, aLength, &header, &cmd, &payload);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
     VerifyOrExit(SPINEL_HEADER_GET_TID(header) == 0, error = OT_ERROR_PARSE);
+
+    if (cmd == SPINEL_CMD_PROP_VALUES_ARE)
+    {
+        ExitNow(error = HandleValuesAre(payload.mData, payload.mLength));
+    }
+
     VerifyOrExit(cmd == SPINEL_CMD_PROP_VALUE_IS);
-    HandleValueIs(key, data, static_cast<uint16_t>(len));
+
+    unpacked = SpinelPropertyLayout::Unpack(payload.mData, payload.mLength, &key, &data);
+    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+    HandleValueIs(static_cast<spinel_prop_key_t>(key), data.mData, data.mLength);
 
 exit:
     LogIfFail("Error processing saved notification", error);
 }
 
+bool RadioSpinel::IsSafeToHandleNow(const uint8_t *aBuffer, uint16_t aLength) const
+{
+    bool isSafe = true;
+
+    while (isSafe && aLength > 0)
+    {
+        SpinelData     entry;
+        unsigned int   key = 0;
+        spinel_ssize_t unpacked;
+
+        unpacked = SpinelValuesAreEntryLayout::Unpack(aBuffer, aLength, &entry);
+
+        // A malformed batch is reported when it is handled.
+        VerifyOrExit(unpacked > 0 && SpinelPropertyLayout::Unpack(entry.mData, entry.mLength, &key) > 0);
+
+        isSafe = IsSafeToHandleNow(static_cast<spinel_prop_key_t>(key));
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+    }
+
+exit:
+    return isSafe;
+}
+
+otError RadioSpinel::HandleValuesAre(const uint8_t *aBuffer, uint16_t aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    while (aLength > 0)
+    {
+        SpinelData     entry;
+        SpinelData     data;
+        unsigned int   key = 0;
+        spinel_ssize_t unpacked;
+
+        unpacked = SpinelValuesAreEntryLayout::Unpack(aBuffer, aLength, &entry);
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        VerifyOrExit(SpinelPropertyLayout::Unpack(entry.mData, entry.mLength, &key, &data) > 0,
+                     error = OT_ERROR_PARSE);
+
+        HandleValueIs(static_cast<spinel_prop_key_t>(key), data.mData, data.mLength);
+
+        aBuffer += unpacked;
+        aLength -= static_cast<uint16_t>(unpacked);
+    }
+
+exit:
+    return error;
+}
+
 void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
 {
     spinel_prop_key_t key;
-    uint8_t *         data   = NULL;
-    spinel_size_t     len    = 0;
+    unsigned int      keyValue = 0;
+    SpinelData        data;
     uint8_t           header = 0;
-    uint32_t          cmd    = 0;
+    unsigned int      cmd    = 0;
     spinel_ssize_t    rval   = 0;
     otError           error  = OT_ERROR_NONE;
 
-    rval = spinel_datatype_unpack(aBuffer, aLength, "CiiD", &header, &cmd, &key, &data, &len);
+    rval = SpinelFrameLayout::Unpack(aBuffer, aLength, &header, &cmd, &keyValue, &data);
     VerifyOrExit(rval > 0 && cmd >= SPINEL_CMD_PROP_VALUE_IS && cmd <= SPINEL_CMD_PROP_VALUE_REMOVED,
                  error = OT_ERROR_PARSE);
+    key = static_cast<spinel_prop_key_t>(keyValue);
 
     if (mWaitingTid == SPINEL_HEADER_GET_TID(header))
     {
-        HandleWaitingResponse(cmd, key, data, static_cast<uint16_t>(len));
+        HandleWaitingResponse(cmd, key, data.mData, data.mLength);
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+    else if (mAsyncTids & (1 << SPINEL_HEADER_GET_TID(header)))
+    {
+        HandleAsyncResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data.mData, data.mLength);
+    }
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
         if (mState == kStateTransmitting)
         {
-            HandleTransmitDone(cmd, key, data, static_cast<uint16_t>(len));
+            HandleTransmitDone(cmd, key, data.mData, data.mLength);
         }
 
         FreeTid(mTxRadioTid);
@@ -456,11 +603,11 @@ void RadioSpinel::HandleWaitingResponse(uint32_t          aCommand,
 {
     if (aKey == SPINEL_PROP_LAST_STATUS)
     {
-        spinel_status_t status;
-        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+        unsigned int   status;
+        spinel_ssize_t unpacked = SpinelLayout<SpinelField::UintPacked>::Unpack(aBuffer, aLength, &status);
 
         VerifyOrExit(unpacked > 0, mError = OT_ERROR_PARSE);
-        mError = SpinelStatusToOtError(status);
+        mError = SpinelStatusToOtError(static_cast<spinel_status_t>(status));
     }
 #if OPENTHREAD_ENABLE_DIAG
     else if (aKey == SPINEL_PROP_NEST_STREAM_MFG)
@@ -504,6 +651,156 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleAsyncResponse(spinel_tid_t      aTid,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t *   aBuffer,
+                                      uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        unsigned int   status;
+        spinel_ssize_t unpacked = SpinelLayout<SpinelField::UintPacked>::Unpack(aBuffer, aLength, &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(static_cast<spinel_status_t>(status));
+    }
+    else if (aKey != mAsyncKeys[aTid] || aCommand != SPINEL_CMD_PROP_VALUE_IS)
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    mAsyncTids &= ~(1 << aTid);
+    FreeTid(aTid);
+
+    if (error != OT_ERROR_NONE)
+    {
+        HandleAsyncFailure(mAsyncKeys[aTid], error);
+    }
+    else
+    {
+        mResyncAttempts = 0;
+    }
+
+    mAsyncKeys[aTid] = SPINEL_PROP_LAST_STATUS;
+}
+
+void RadioSpinel::HandleAsyncFailure(spinel_prop_key_t aKey, otError aError)
+{
+    uint8_t resync = 0;
+
+    OT_UNUSED_VARIABLE(aError);
+
+    mAsyncFailureCount++;
+    otLogWarnPlat("Failed to set %s: %s, %u failures", spinel_prop_key_to_cstr(aKey), otThreadErrorToString(aError),
+                  mAsyncFailureCount);
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_MAC_15_4_SADDR:
+        resync = kResyncShortAddress;
+        break;
+
+    case SPINEL_PROP_MAC_15_4_LADDR:
+        resync = kResyncExtAddress;
+        break;
+
+    case SPINEL_PROP_MAC_15_4_PANID:
+        resync = kResyncPanId;
+        break;
+
+    case SPINEL_PROP_MAC_SRC_MATCH_ENABLED:
+        resync = kResyncSrcMatch;
+        break;
+
+    case SPINEL_PROP_PHY_CHAN:
+        resync = kResyncChannel;
+        break;
+
+    case SPINEL_PROP_MAC_RAW_STREAM_ENABLED:
+        resync = kResyncReceive;
+        break;
+
+    default:
+        // The host does not mirror the source match tables, so a failed clear cannot be replayed.
+        otLogWarnPlat("RCP %s may be out of sync", spinel_prop_key_to_cstr(aKey));
+        break;
+    }
+
+    if (mResyncAttempts >= kMaxResyncAttempts)
+    {
+        otLogCritPlat("Giving up resyncing RCP after %u attempts", mResyncAttempts);
+        resync = 0;
+    }
+
+    mResyncPending |= resync;
+}
+
+void RadioSpinel::Resync(void)
+{
+    uint8_t resync = mResyncPending;
+    otError error  = OT_ERROR_NONE;
+
+    mResyncPending = 0;
+    mResyncAttempts++;
+
+    VerifyOrExit(IsEnabled());
+
+    // Replay the host copy of each property whose asynchronous update failed.
+    if (resync & kResyncShortAddress)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    }
+
+    if (resync & kResyncExtAddress)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, mExtendedAddress.m8));
+    }
+
+    if (resync & kResyncPanId)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
+    }
+
+    if (resync & kResyncSrcMatch)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled));
+    }
+
+    if (resync & kResyncChannel)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, mChannel));
+    }
+
+    if (resync & kResyncReceive)
+    {
+        SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S,
+                                       mState != kStateSleep));
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("RCP resync failed: %s", otThreadErrorToString(error));
+        mResyncPending |= resync;
+    }
+}
+
+void RadioSpinel::ClearAsyncRequests(void)
+{
+    // Responses to requests sent before an RCP reset never arrive, so release their transaction ids.
+    mCmdTidsInUse &= ~mAsyncTids;
+    mAsyncTids = 0;
+
+    for (uint8_t i = 0; i < kMaxTids; i++)
+    {
+        mAsyncKeys[i] = SPINEL_PROP_LAST_STATUS;
+    }
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError error = OT_ERROR_NONE;
@@ -515,16 +812,19 @@ void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer,
     }
     else if (aKey == SPINEL_PROP_LAST_STATUS)
     {
-        spinel_status_t status = SPINEL_STATUS_OK;
+        spinel_status_t status;
+        unsigned int    value;
         spinel_ssize_t  unpacked;
 
-        unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+        unpacked = SpinelLayout<SpinelField::UintPacked>::Unpack(aBuffer, aLength, &value);
         VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        status = static_cast<spinel_status_t>(value);
 
         if (status >= SPINEL_STATUS_RESET__BEGIN && status <= SPINEL_STATUS_RESET__END)
         {
             otLogCritPlat("RCP reset: %s", spinel_status_to_cstr(status));
             mIsReady = true;
+            ClearAsyncRequests();
 
             // If RCP crashes/resets while radio was enabled, posix app exits.
             VerifyOrDie(!IsEnabled(), OT_EXIT_RADIO_SPINEL_RESET);
@@ -608,33 +908,29 @@ otError RadioSpinel::ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffe
     otError        error        = OT_ERROR_NONE;
     uint16_t       flags        = 0;
     int8_t         noiseFloor   = -128;
-    spinel_size_t  size         = OT_RADIO_FRAME_MAX_SIZE;
     unsigned int   receiveError = 0;
+    SpinelData     psdu;
+    SpinelData     phyData;
+    SpinelData     vendorData;
     spinel_ssize_t unpacked;
 
+    unpacked = RadioFrameLayout::Unpack(aBuffer, aLength, &psdu, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags,
+                                        &phyData, &vendorData);
+    VerifyOrExit(unpacked > 0 && psdu.mLength <= OT_RADIO_FRAME_MAX_SIZE, error = OT_ERROR_PARSE);
+
     // Timestamp is ms + us.
-    unpacked = spinel_datatype_unpack_in_place(
-        aBuffer, aLength,
-        SPINEL_DATATYPE_DATA_WLEN_S                              // Frame
-                        SPINEL_DATATYPE_INT8_S                   // RSSI
-                        SPINEL_DATATYPE_INT8_S                   // Noise Floor
-                        SPINEL_DATATYPE_UINT16_S                 // Flags
-                        SPINEL_DATATYPE_STRUCT_S(                // PHY-data
-                            SPINEL_DATATYPE_UINT8_S              // 802.15.4 channel
-                                        SPINEL_DATATYPE_UINT8_S  // 802.15.4 LQI
-                                        SPINEL_DATATYPE_UINT32_S // Timestamp (ms).
-                                        SPINEL_DATATYPE_UINT16_S // Timestamp (us).
-                            ) SPINEL_DATATYPE_STRUCT_S(          // Vendor-data
-                            SPINEL_DATATYPE_UINT_PACKED_S        // Receive error
-                            ),
-        aFrame.mPsdu, &size, &aFrame.mInfo.mRxInfo.mRssi, &noiseFloor, &flags, &aFrame.mChannel,
-        &aFrame.mInfo.mRxInfo.mLqi, &aFrame.mInfo.mRxInfo.mMsec, &aFrame.mInfo.mRxInfo.mUsec, &receiveError);
+    unpacked = RadioFramePhyDataLayout::Unpack(phyData.mData, phyData.mLength, &aFrame.mChannel,
+                                               &aFrame.mInfo.mRxInfo.mLqi, &aFrame.mInfo.mRxInfo.mMsec,
+                                               &aFrame.mInfo.mRxInfo.mUsec);
+    VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
+    unpacked = SpinelLayout<SpinelField::UintPacked>::Unpack(vendorData.mData, vendorData.mLength, &receiveError);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
     if (receiveError == OT_ERROR_NONE)
     {
-        aFrame.mLength = static_cast<uint8_t>(size);
+        memcpy(aFrame.mPsdu, psdu.mData, psdu.mLength);
+        aFrame.mLength = static_cast<uint8_t>(psdu.mLength);
 
         aFrame.mInfo.mRxInfo.mAckedWithFramePending = ((flags & SPINEL_MD_FLAG_ACKED_FP) != 0);
     }
@@ -755,6 +1051,11 @@ void RadioSpinel::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet)
 
     mHdlcInterface.GetRxFrameBuffer().ClearReadFrames();
 
+    if (mResyncPending != 0)
+    {
+        Resync();
+    }
+
     if (mState == kStateTransmitDone)
     {
         mState        = kStateReceive;
@@ -804,7 +1105,7 @@ otError RadioSpinel::SetShortAddress(uint16_t aAddress)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mShortAddress != aAddress);
-    SuccessOrExit(error = sRadioSpinel.Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -820,7 +1121,7 @@ otError RadioSpinel::SetExtendedAddress(const otExtAddress &aExtAddress)
 {
     otError error;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_LADDR, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8));
     mExtendedAddress = aExtAddress;
 
 exit:
@@ -832,7 +1133,7 @@ otError RadioSpinel::SetPanId(uint16_t aPanId)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mPanId != aPanId);
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, aPanId));
     mPanId = aPanId;
 
 exit:
@@ -841,7 +1142,13 @@ exit:
 
 otError RadioSpinel::EnableSrcMatch(bool aEnable)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable);
+    otError error;
+
+    SuccessOrExit(error = SetAsync(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, aEnable));
+    mSrcMatchEnabled = aEnable;
+
+exit:
+    return error;
 }
 
 otError RadioSpinel::AddSrcMatchShortEntry(const uint16_t aShortAddress)
@@ -866,12 +1173,12 @@ otError RadioSpinel::ClearSrcMatchExtEntry(const otExtAddress &aExtAddress)
 
 otError RadioSpinel::ClearSrcMatchShortEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, NULL);
+    return SetAsync(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, NULL);
 }
 
 otError RadioSpinel::ClearSrcMatchExtEntries(void)
 {
-    return Set(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, NULL);
+    return SetAsync(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, NULL);
 }
 
 otError RadioSpinel::GetTransmitPower(int8_t &aPower)
@@ -942,6 +1249,68 @@ otError RadioSpinel::Set(spinel_prop_key_t aKey, const char *aFormat, ...)
     return error;
 }
 
+otError RadioSpinel::SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...)
+{
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = GetNextTid();
+    va_list      args;
+
+    assert(mWaitingTid == 0);
+
+    if (tid == 0)
+    {
+        // All transaction ids are in use, wait for the oldest asynchronous request to complete.
+        for (tid = mCmdNextTid; (mAsyncTids & (1 << tid)) == 0; tid = SPINEL_GET_NEXT_TID(tid))
+        {
+            VerifyOrExit(SPINEL_GET_NEXT_TID(tid) != mCmdNextTid, error = OT_ERROR_BUSY);
+        }
+
+        SuccessOrExit(error = WaitAsyncResponse(tid));
+        tid = GetNextTid();
+        VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
+    }
+
+    va_start(args, aFormat);
+    error = SendCommand(SPINEL_CMD_PROP_VALUE_SET, aKey, tid, aFormat, args);
+    va_end(args);
+
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mAsyncTids |= (1 << tid);
+    mAsyncKeys[tid] = aKey;
+
+exit:
+    return error;
+}
+
+otError RadioSpinel::WaitAsyncResponse(spinel_tid_t aTid)
+{
+    otError error;
+
+    // Turn the asynchronous request into the current transaction and wait for its response.
+    mAsyncTids &= ~(1 << aTid);
+    mWaitingTid      = aTid;
+    mWaitingKey      = mAsyncKeys[aTid];
+    mExpectedCommand = SPINEL_CMD_PROP_VALUE_IS;
+    error            = WaitResponse();
+    mExpectedCommand = SPINEL_CMD_NOOP;
+
+    // The failure belongs to the earlier request, so it must not fail the request waiting for a transaction id.
+    if (error != OT_ERROR_NONE && error != OT_ERROR_RESPONSE_TIMEOUT)
+    {
+        HandleAsyncFailure(mAsyncKeys[aTid], error);
+        error = OT_ERROR_NONE;
+    }
+
+    mAsyncKeys[aTid] = SPINEL_PROP_LAST_STATUS;
+
+    return error;
+}
+
 otError RadioSpinel::Insert(spinel_prop_key_t aKey, const char *aFormat, ...)
 {
     otError error;
@@ -1070,15 +1439,19 @@ exit:
 
 spinel_tid_t RadioSpinel::GetNextTid(void)
 {
-    spinel_tid_t tid = 0;
+    spinel_tid_t tid = mCmdNextTid;
 
-    if (((1 << mCmdNextTid) & mCmdTidsInUse) == 0)
+    // Several transactions may be outstanding, so skip over the ids still in use.
+    while (((1 << tid) & mCmdTidsInUse) != 0)
     {
-        tid         = mCmdNextTid;
-        mCmdNextTid = SPINEL_GET_NEXT_TID(mCmdNextTid);
-        mCmdTidsInUse |= (1 << tid);
+        tid = SPINEL_GET_NEXT_TID(tid);
+        VerifyOrExit(tid != mCmdNextTid, tid = 0);
     }
 
+    mCmdNextTid = SPINEL_GET_NEXT_TID(tid);
+    mCmdTidsInUse |= (1 << tid);
+
+exit:
     return tid;
 }
 
@@ -1090,22 +1463,47 @@ spinel_tid_t RadioSpinel::GetNextTid(void)
  */
 void RadioSpinel::RadioTransmit(void)
 {
-    otError error;
+    otError        error = OT_ERROR_NONE;
+    uint8_t        buffer[kMaxSpinelFrame];
+    spinel_tid_t   tid;
+    spinel_ssize_t packed;
 
     assert(mTransmitFrame != NULL);
     otPlatRadioTxStarted(mInstance, mTransmitFrame);
     assert(mState == kStateTransmitPending);
 
-    error = Request(true, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW,
-                    SPINEL_DATATYPE_DATA_WLEN_S             // Frame data
-                                    SPINEL_DATATYPE_UINT8_S // Channel
-                                    SPINEL_DATATYPE_UINT8_S // MaxCsmaBackoffs
-                                    SPINEL_DATATYPE_UINT8_S // MaxFrameRetries
-                                    SPINEL_DATATYPE_BOOL_S, // CsmaCaEnabled
-                    mTransmitFrame->mPsdu, mTransmitFrame->mLength, mTransmitFrame->mChannel,
-                    mTransmitFrame->mInfo.mTxInfo.mMaxCsmaBackoffs, mTransmitFrame->mInfo.mTxInfo.mMaxFrameRetries,
-                    mTransmitFrame->mInfo.mTxInfo.mCsmaCaEnabled);
+    // Not allowed to send another frame before the last frame is done.
+    assert(mTxRadioTid == 0);
+    VerifyOrExit(mTxRadioTid == 0, error = OT_ERROR_BUSY);
+
+    tid = GetNextTid();
+    VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
+
+    packed = TransmitFrameLayout::Pack(buffer, sizeof(buffer), SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
+                                       SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW,
+                                       SpinelData(mTransmitFrame->mPsdu, mTransmitFrame->mLength),
+                                       mTransmitFrame->mChannel, mTransmitFrame->mInfo.mTxInfo.mMaxCsmaBackoffs,
+                                       mTransmitFrame->mInfo.mTxInfo.mMaxFrameRetries,
+                                       mTransmitFrame->mInfo.mTxInfo.mCsmaCaEnabled);
+
+    if (packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer))
+    {
+        error = mHdlcInterface.SendFrame(buffer, static_cast<uint16_t>(packed));
+    }
+    else
+    {
+        error = OT_ERROR_NO_BUFS;
+    }
 
+    if (error != OT_ERROR_NONE)
+    {
+        FreeTid(tid);
+        ExitNow();
+    }
+
+    mTxRadioTid = tid;
+
+exit:
     if (error == OT_ERROR_NONE)
     {
         mTxRadioEndUs = otSysGetTime() + TX_WAIT_US;
@@ -1142,6 +1540,7 @@ otError RadioSpinel::SendReset(void)
     VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
 
     SuccessOrExit(error = mHdlcInterface.SendFrame(buffer, static_cast<uint16_t>(packed)));
+    ClearAsyncRequests();
 
     sleep(0);
 
@@ -1161,8 +1560,8 @@ otError RadioSpinel::SendCommand(uint32_t          aCommand,
     uint16_t       offset;
 
     // Pack the header, command and key
-    packed = spinel_datatype_pack(buffer, sizeof(buffer), "Cii", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
-                                  aCommand, aKey);
+    packed = SpinelCommandLayout::Pack(buffer, sizeof(buffer), SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | tid,
+                                       aCommand, aKey);
 
     VerifyOrExit(packed > 0 && static_cast<size_t>(packed) <= sizeof(buffer), error = OT_ERROR_NO_BUFS);
 
@@ -1193,14 +1592,7 @@ otError RadioSpinel::RequestV(bool aWait, uint32_t command, spinel_prop_key_t aK
     error = SendCommand(command, aKey, tid, aFormat, aArgs);
     VerifyOrExit(error == OT_ERROR_NONE);
 
-    if (aKey == SPINEL_PROP_STREAM_RAW)
-    {
-        // not allowed to send another frame before the last frame is done.
-        assert(mTxRadioTid == 0);
-        VerifyOrExit(mTxRadioTid == 0, error = OT_ERROR_BUSY);
-        mTxRadioTid = tid;
-    }
-    else if (aWait)
+    if (aWait)
     {
         mWaitingKey = aKey;
         mWaitingTid = tid;
@@ -1225,13 +1617,13 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
                                      const uint8_t *   aBuffer,
                                      uint16_t          aLength)
 {
-    otError         error  = OT_ERROR_NONE;
-    spinel_status_t status = SPINEL_STATUS_OK;
-    spinel_ssize_t  unpacked;
+    otError        error  = OT_ERROR_NONE;
+    unsigned int   status = SPINEL_STATUS_OK;
+    spinel_ssize_t unpacked;
 
     VerifyOrExit(aCommand == SPINEL_CMD_PROP_VALUE_IS && aKey == SPINEL_PROP_LAST_STATUS, error = OT_ERROR_FAILED);
 
-    unpacked = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_UINT_PACKED_S, &status);
+    unpacked = SpinelLayout<SpinelField::UintPacked>::Unpack(aBuffer, aLength, &status);
     VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
     aBuffer += unpacked;
@@ -1240,7 +1632,7 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
     if (status == SPINEL_STATUS_OK)
     {
         bool framePending = false;
-        unpacked          = spinel_datatype_unpack(aBuffer, aLength, SPINEL_DATATYPE_BOOL_S, &framePending);
+        unpacked          = SpinelLayout<SpinelField::Bool>::Unpack(aBuffer, aLength, &framePending);
         OT_UNUSED_VARIABLE(framePending);
         VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
 
@@ -1258,8 +1650,8 @@ void RadioSpinel::HandleTransmitDone(uint32_t          aCommand,
     }
     else
     {
-        otLogWarnPlat("Spinel status: %d.", status);
-        error = SpinelStatusToOtError(status);
+        otLogWarnPlat("Spinel status: %u.", status);
+        error = SpinelStatusToOtError(static_cast<spinel_status_t>(status));
     }
 
 exit:
@@ -1289,14 +1681,14 @@ otError RadioSpinel::Receive(uint8_t aChannel)
 
     if (mChannel != aChannel)
     {
-        error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
+        error = SetAsync(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
         VerifyOrExit(error == OT_ERROR_NONE);
         mChannel = aChannel;
     }
 
     if (mState == kStateSleep)
     {
-        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
         VerifyOrExit(error == OT_ERROR_NONE);
     }
 
@@ -1320,7 +1712,7 @@ otError RadioSpinel::Sleep(void)
     switch (mState)
     {
     case kStateReceive:
-        error = sRadioSpinel.Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+        error = SetAsync(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
         VerifyOrExit(error == OT_ERROR_NONE);
 
         mState = kStateSleep;
@@ -1649,6 +2041,11 @@ void ot::PosixApp::RadioSpinel::Process(const Event &aEvent)
 
     mHdlcInterface.GetRxFrameBuffer().ClearReadFrames();
 
+    if (mResyncPending != 0)
+    {
+        Resync();
+    }
+
     if (mState == kStateTransmitDone)
     {
         mState = kStateReceive;
@@ -369,6 +369,14 @@ public:
      */
     bool IsEnabled(void) const { return mState != kStateDisabled; }
 
+    /**
+     * This method returns the number of asynchronous requests the transceiver failed.
+     *
+     * @returns The number of failed asynchronous requests.
+     *
+     */
+    uint32_t GetAsyncFailureCount(void) const { return mAsyncFailureCount; }
+
     /**
      * This method updates the file descriptor sets with file descriptors used by the radio driver.
      *
@@ -466,6 +474,18 @@ private:
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
         kChannelMaskBufferSize = 32,   ///< Max buffer size used to store `SPINEL_PROP_PHY_CHAN_SUPPORTED` value.
+        kMaxTids               = 16,   ///< Size of the spinel transaction id space (tid 0 is reserved).
+        kMaxResyncAttempts     = 3,    ///< Max consecutive attempts to resync the transceiver.
+    };
+
+    enum
+    {
+        kResyncShortAddress = 1 << 0, ///< Replay `SPINEL_PROP_MAC_15_4_SADDR`.
+        kResyncExtAddress   = 1 << 1, ///< Replay `SPINEL_PROP_MAC_15_4_LADDR`.
+        kResyncPanId        = 1 << 2, ///< Replay `SPINEL_PROP_MAC_15_4_PANID`.
+        kResyncSrcMatch     = 1 << 3, ///< Replay `SPINEL_PROP_MAC_SRC_MATCH_ENABLED`.
+        kResyncChannel      = 1 << 4, ///< Replay `SPINEL_PROP_PHY_CHAN`.
+        kResyncReceive      = 1 << 5, ///< Replay `SPINEL_PROP_MAC_RAW_STREAM_ENABLED`.
     };
 
     enum State
@@ -511,6 +531,26 @@ private:
      */
     otError Set(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * This method sends a request to update a spinel property of OpenThread transceiver without waiting for the
+     * response.
+     *
+     * The response is handled from `Process()` (or from a later `WaitResponse()`). A failure is logged and counted,
+     * and `Process()` then replays the host copy of the property to resync the transceiver. Since the transceiver
+     * handles commands in order, any later request observes the updated property. This method only blocks when all
+     * transaction ids are in use.
+     *
+     * @param[in]   aKey        Spinel property key.
+     * @param[in]   aFormat     Spinel formatter to pack property value.
+     * @param[in]   ...         Variable arguments list.
+     *
+     * @retval  OT_ERROR_NONE               Successfully sent the request.
+     * @retval  OT_ERROR_BUSY               Failed due to no transaction id being available.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     *
+     */
+    otError SetAsync(spinel_prop_key_t aKey, const char *aFormat, ...);
+
     /**
      * This method tries to insert a item into a spinel list property of OpenThread transceiver.
      *
@@ -545,6 +585,7 @@ private:
     otError RequestV(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
     otError Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, ...);
     otError WaitResponse(void);
+    otError WaitAsyncResponse(spinel_tid_t aTid);
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
                         spinel_prop_key_t key,
@@ -570,13 +611,34 @@ private:
                  (aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT));
     }
 
-    void HandleNotification(HdlcInterface::RxFrameBuffer &aFrameBuffer);
-    void HandleNotification(const uint8_t *aBuffer, uint16_t aLength);
-    void HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    /**
+     * This method returns whether all the properties in a `VALUES_ARE` payload are safe to be handled now.
+     *
+     * @param[in] aBuffer  A pointer to the `VALUES_ARE` payload (the key/value structs).
+     * @param[in] aLength  The length of the payload.
+     *
+     * @returns Whether this batch of properties is safe to be handled now.
+     *
+     */
+    bool IsSafeToHandleNow(const uint8_t *aBuffer, uint16_t aLength) const;
+
+    void    HandleNotification(HdlcInterface::RxFrameBuffer &aFrameBuffer);
+    void    HandleNotification(const uint8_t *aBuffer, uint16_t aLength);
+    otError HandleValuesAre(const uint8_t *aBuffer, uint16_t aLength);
+    void    HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
 
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleAsyncResponse(spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aBuffer,
+                             uint16_t          aLength);
+
+    void HandleAsyncFailure(spinel_prop_key_t aKey, otError aError);
+    void Resync(void);
+    void ClearAsyncRequests(void);
 
     void RadioReceive(void);
     void RadioTransmit(void);
@@ -589,6 +651,8 @@ private:
     spinel_tid_t      mCmdNextTid;      ///< Next available transaction id.
     spinel_tid_t      mTxRadioTid;      ///< The transaction id used to send a radio frame.
     spinel_tid_t      mWaitingTid;      ///< The transaction id of current transaction.
+    uint16_t          mAsyncTids;       ///< Transaction ids of asynchronous requests waiting for a response.
+    spinel_prop_key_t mAsyncKeys[kMaxTids]; ///< The property keys of asynchronous requests, indexed by tid.
     spinel_prop_key_t mWaitingKey;      ///< The property key of current transaction.
     const char *      mPropertyFormat;  ///< The spinel property format of current transaction.
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
@@ -616,6 +680,11 @@ private:
     bool  mIsPromiscuous : 1;     ///< Promiscuous mode.
     bool  mIsReady : 1;           ///< NCP ready.
     bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
+    bool  mSrcMatchEnabled : 1;   ///< Source address match enabled.
+
+    uint8_t  mResyncPending;     ///< Properties to replay after a failed asynchronous request (`kResync*` flags).
+    uint8_t  mResyncAttempts;    ///< Resync attempts since the last successful asynchronous request.
+    uint32_t mAsyncFailureCount; ///< Number of failed asynchronous requests.
 
 #if OPENTHREAD_ENABLE_DIAG
     bool   mDiagMode;
@@ -41,7 +41,9 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -61,7 +63,50 @@
 
 static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
 
-static int sSettingsFd = -1;
+/*
+ * The settings file is a log of records, each a `SettingsRecordHeader` followed by its value:
+ *
+ * - a setting added with `otPlatSettingsAdd()`, keyed by its own key.
+ * - a deletion (`kKeyDelete`), its value is the key and the index (-1 for all) of the deleted settings.
+ * - a commit (`kKeyCommit`), its value is the checksum of all records since the previous commit.
+ *
+ * The log starts with `kLogMagic`. Records following the last valid commit are discarded when the file is loaded, so
+ * a group of changes survives a crash either entirely or not at all. An index of the live settings is kept in memory
+ * and the log is compacted into a new file once it grows to twice the size of the live settings.
+ */
+enum
+{
+    kKeyDelete = 0xfffe,
+    kKeyCommit = 0xffff,
+};
+
+static const uint32_t kLogMagic        = 0x314c534f; // "OSL1" in little-endian
+static const uint32_t kChecksumInit    = 2166136261u;
+static const off_t    kCompactMinSize  = 4096;
+static const size_t   kMinIndexEntries = 16;
+
+struct SettingsRecordHeader
+{
+    uint16_t mKey;
+    uint16_t mLength;
+};
+
+struct SettingsEntry
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    off_t    mOffset; ///< The offset of the value in the file.
+};
+
+static int            sSettingsFd  = -1;
+static SettingsEntry *sEntries     = NULL;
+static size_t         sNumEntries  = 0;
+static size_t         sMaxEntries  = 0;
+static off_t          sLogSize     = 0;    ///< The size of the log, i.e. the offset of the next record.
+static off_t          sLiveSize    = 0;    ///< The size of the live settings records.
+static uint32_t       sChecksum    = kChecksumInit;
+static bool           sIsCommitted = true; ///< Whether all records are followed by a commit.
+static unsigned int   sChangeDepth = 0;
 
 static void getSettingsFileName(char aFileName[kMaxFileNameSize], bool aSwap)
 {
@@ -77,67 +122,351 @@ static int swapOpen(void)
     int  fd;
 
     getSettingsFileName(fileName, true);
-    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0600);
     VerifyOrDie(fd != -1);
 
     return fd;
 }
 
+static void swapPersist(int aFd)
+{
+    char swapFile[kMaxFileNameSize];
+    char dataFile[kMaxFileNameSize];
+    int  dirFd;
+
+    getSettingsFileName(swapFile, true);
+    getSettingsFileName(dataFile, false);
+
+    VerifyOrDie(0 == fsync(aFd));
+    VerifyOrDie(0 == rename(swapFile, dataFile));
+
+    // The rename only survives a power loss once the directory itself is synced.
+    dirFd = open(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, O_RDONLY | O_DIRECTORY);
+    VerifyOrDie(dirFd != -1);
+    VerifyOrDie(0 == fsync(dirFd));
+    VerifyOrDie(0 == close(dirFd));
+
+    VerifyOrDie(0 == close(sSettingsFd));
+
+    sSettingsFd = aFd;
+}
+
+/**
+ * This function updates a FNV-1a checksum with @p aLength bytes.
+ *
+ */
+static uint32_t updateChecksum(uint32_t aChecksum, const void *aData, size_t aLength)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(aData);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aChecksum = (aChecksum ^ data[i]) * 16777619u;
+    }
+
+    return aChecksum;
+}
+
+static void resetIndex(void)
+{
+    sNumEntries = 0;
+    sLiveSize   = 0;
+}
+
+static void addEntry(uint16_t aKey, uint16_t aLength, off_t aOffset)
+{
+    if (sNumEntries == sMaxEntries)
+    {
+        size_t         maxEntries = (sMaxEntries == 0 ? kMinIndexEntries : sMaxEntries * 2);
+        SettingsEntry *entries    = static_cast<SettingsEntry *>(realloc(sEntries, maxEntries * sizeof(*entries)));
+
+        VerifyOrDie(entries != NULL);
+        sEntries    = entries;
+        sMaxEntries = maxEntries;
+    }
+
+    sEntries[sNumEntries].mKey    = aKey;
+    sEntries[sNumEntries].mLength = aLength;
+    sEntries[sNumEntries].mOffset = aOffset;
+    sNumEntries++;
+
+    sLiveSize += sizeof(SettingsRecordHeader) + aLength;
+}
+
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function finds the @p aIndex-th entry of @p aKey in the index.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ * @returns The position of the entry in the index, or `sNumEntries` if not found.
  *
  */
-static void swapWrite(int aFd, uint16_t aLength)
+static size_t findEntry(uint16_t aKey, int aIndex)
 {
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+    size_t i;
 
-    while (aLength > 0)
+    for (i = 0; i < sNumEntries; i++)
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+        if (sEntries[i].mKey == aKey && aIndex-- == 0)
+        {
+            break;
+        }
+    }
 
-        VerifyOrDie(rval > 0);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count);
-        aLength -= count;
+    return i;
+}
+
+/**
+ * This function removes the @p aIndex-th entry, or all entries if @p aIndex is -1, of @p aKey from the index.
+ *
+ */
+static void deleteEntries(uint16_t aKey, int aIndex)
+{
+    size_t count = 0;
+    int    index = 0;
+
+    for (size_t i = 0; i < sNumEntries; i++)
+    {
+        if (sEntries[i].mKey == aKey && (aIndex == -1 || index++ == aIndex))
+        {
+            sLiveSize -= sizeof(SettingsRecordHeader) + sEntries[i].mLength;
+            count++;
+        }
+        else if (count > 0)
+        {
+            sEntries[i - count] = sEntries[i];
+        }
     }
+
+    sNumEntries -= count;
 }
 
-static void swapPersist(int aFd)
+/**
+ * This function appends a record to the log.
+ *
+ * @returns The offset of the value of the record.
+ *
+ */
+static off_t appendRecord(uint16_t aKey, const void *aValue, uint16_t aLength)
 {
-    char swapFile[kMaxFileNameSize];
-    char dataFile[kMaxFileNameSize];
+    SettingsRecordHeader header;
+    struct iovec         iov[2];
+    off_t                offset = sLogSize + static_cast<off_t>(sizeof(header));
 
-    getSettingsFileName(swapFile, true);
-    getSettingsFileName(dataFile, false);
+    header.mKey    = aKey;
+    header.mLength = aLength;
 
-    VerifyOrDie(0 == close(sSettingsFd));
-    VerifyOrDie(0 == rename(swapFile, dataFile));
-    VerifyOrDie(0 == fsync(aFd));
+    iov[0].iov_base = &header;
+    iov[0].iov_len  = sizeof(header);
+    iov[1].iov_base = const_cast<void *>(aValue);
+    iov[1].iov_len  = aLength;
 
-    sSettingsFd = aFd;
+    VerifyOrDie(writev(sSettingsFd, iov, 2) == static_cast<ssize_t>(sizeof(header) + aLength));
+
+    sLogSize  = offset + aLength;
+    sChecksum = updateChecksum(updateChecksum(sChecksum, &header, sizeof(header)), aValue, aLength);
+
+    return offset;
 }
 
-static void swapDiscard(int aFd)
+static void writeMagic(void)
 {
-    char swapFileName[kMaxFileNameSize];
+    VerifyOrDie(write(sSettingsFd, &kLogMagic, sizeof(kLogMagic)) == sizeof(kLogMagic));
 
-    VerifyOrDie(0 == close(aFd));
-    getSettingsFileName(swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName));
+    sLogSize     = sizeof(kLogMagic);
+    sChecksum    = kChecksumInit;
+    sIsCommitted = true;
+}
+
+/**
+ * This function rewrites the live settings to a new log, replacing the current one.
+ *
+ */
+static void compactLog(void)
+{
+    int                  fd     = swapOpen();
+    size_t               size   = sizeof(kLogMagic) + static_cast<size_t>(sLiveSize);
+    uint8_t *            buffer = static_cast<uint8_t *>(malloc(size));
+    size_t               offset = 0;
+    uint32_t             checksum;
+    SettingsRecordHeader header;
+
+    VerifyOrDie(buffer != NULL);
+
+    memcpy(buffer, &kLogMagic, sizeof(kLogMagic));
+    offset += sizeof(kLogMagic);
+
+    for (size_t i = 0; i < sNumEntries; i++)
+    {
+        header.mKey    = sEntries[i].mKey;
+        header.mLength = sEntries[i].mLength;
+        memcpy(buffer + offset, &header, sizeof(header));
+        offset += sizeof(header);
+
+        VerifyOrDie(pread(sSettingsFd, buffer + offset, header.mLength, sEntries[i].mOffset) == header.mLength);
+        sEntries[i].mOffset = static_cast<off_t>(offset);
+        offset += header.mLength;
+    }
+
+    checksum       = updateChecksum(kChecksumInit, buffer + sizeof(kLogMagic), offset - sizeof(kLogMagic));
+    header.mKey    = kKeyCommit;
+    header.mLength = sizeof(checksum);
+
+    VerifyOrDie(write(fd, buffer, offset) == static_cast<ssize_t>(offset) &&
+                write(fd, &header, sizeof(header)) == sizeof(header) &&
+                write(fd, &checksum, sizeof(checksum)) == sizeof(checksum));
+
+    free(buffer);
+    swapPersist(fd);
+
+    sLogSize     = static_cast<off_t>(offset + sizeof(header) + sizeof(checksum));
+    sChecksum    = kChecksumInit;
+    sIsCommitted = true;
+}
+
+/**
+ * This function commits the records appended since the last commit with a single `fsync()`.
+ *
+ */
+static void commitLog(void)
+{
+    if (!sIsCommitted)
+    {
+        uint32_t checksum = sChecksum;
+
+        appendRecord(kKeyCommit, &checksum, sizeof(checksum));
+        VerifyOrDie(0 == fsync(sSettingsFd));
+
+        sChecksum    = kChecksumInit;
+        sIsCommitted = true;
+    }
+
+    if (sLogSize > kCompactMinSize && sLogSize > 2 * (sLiveSize + static_cast<off_t>(sizeof(kLogMagic))))
+    {
+        compactLog();
+    }
+}
+
+static void appendChange(uint16_t aKey, const void *aValue, uint16_t aLength)
+{
+    off_t offset = appendRecord(aKey, aValue, aLength);
+
+    sIsCommitted = false;
+
+    if (aKey == kKeyDelete)
+    {
+        const uint16_t *deletion = static_cast<const uint16_t *>(aValue);
+
+        deleteEntries(deletion[0], static_cast<int16_t>(deletion[1]));
+    }
+    else
+    {
+        addEntry(aKey, aLength, offset);
+    }
+
+    if (sChangeDepth == 0)
+    {
+        commitLog();
+    }
+}
+
+/**
+ * This function loads the index from a log.
+ *
+ * @returns The size of the log up to its last valid commit.
+ *
+ */
+static size_t loadLog(const uint8_t *aLog, size_t aSize)
+{
+    size_t   committedSize = sizeof(kLogMagic);
+    uint32_t checksum      = kChecksumInit;
+
+    // find the last valid commit
+    for (size_t offset = committedSize; offset + sizeof(SettingsRecordHeader) <= aSize;)
+    {
+        SettingsRecordHeader header;
+
+        memcpy(&header, aLog + offset, sizeof(header));
+        VerifyOrExit(offset + sizeof(header) + header.mLength <= aSize);
+
+        if (header.mKey == kKeyCommit)
+        {
+            uint32_t expected;
+
+            VerifyOrExit(header.mLength == sizeof(expected));
+            memcpy(&expected, aLog + offset + sizeof(header), sizeof(expected));
+            VerifyOrExit(expected == checksum);
+
+            checksum      = kChecksumInit;
+            committedSize = offset + sizeof(header) + header.mLength;
+        }
+        else
+        {
+            VerifyOrExit(header.mKey != kKeyDelete || header.mLength == 2 * sizeof(uint16_t));
+            checksum = updateChecksum(checksum, aLog + offset, sizeof(header) + header.mLength);
+        }
+
+        offset += sizeof(header) + header.mLength;
+    }
+
+exit:
+    for (size_t offset = sizeof(kLogMagic); offset < committedSize;)
+    {
+        SettingsRecordHeader header;
+
+        memcpy(&header, aLog + offset, sizeof(header));
+        offset += sizeof(header);
+
+        if (header.mKey == kKeyDelete)
+        {
+            uint16_t deletion[2];
+
+            memcpy(deletion, aLog + offset, sizeof(deletion));
+            deleteEntries(deletion[0], static_cast<int16_t>(deletion[1]));
+        }
+        else if (header.mKey != kKeyCommit)
+        {
+            addEntry(header.mKey, header.mLength, static_cast<off_t>(offset));
+        }
+
+        offset += header.mLength;
+    }
+
+    return committedSize;
+}
+
+/**
+ * This function loads the index from a file of the former format, a plain sequence of settings records.
+ *
+ * @retval OT_ERROR_NONE   Successfully loaded the file.
+ * @retval OT_ERROR_PARSE  The file is corrupted.
+ *
+ */
+static otError loadLegacy(const uint8_t *aData, size_t aSize)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (size_t offset = 0; offset < aSize;)
+    {
+        SettingsRecordHeader header;
+
+        VerifyOrExit(offset + sizeof(header) <= aSize, error = OT_ERROR_PARSE);
+        memcpy(&header, aData + offset, sizeof(header));
+        offset += sizeof(header);
+
+        VerifyOrExit(offset + header.mLength <= aSize && header.mKey < kKeyDelete, error = OT_ERROR_PARSE);
+        addEntry(header.mKey, header.mLength, static_cast<off_t>(offset));
+        offset += header.mLength;
+    }
+
+exit:
+    return error;
 }
 
 void otPlatSettingsInit(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error = OT_ERROR_NONE;
+    uint8_t *data = NULL;
+    off_t    size;
 
     {
         struct stat st;
@@ -148,206 +477,278 @@ void otPlatSettingsInit(otInstance *aInstance)
         }
     }
 
+    if (sSettingsFd != -1)
+    {
+        close(sSettingsFd);
+    }
+
     {
         char fileName[kMaxFileNameSize];
 
         getSettingsFileName(fileName, false);
-        sSettingsFd = open(fileName, O_RDWR | O_CREAT, 0600);
+        sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_APPEND, 0600);
     }
 
     VerifyOrDie(sSettingsFd != -1);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
+    resetIndex();
+    sChangeDepth = 0;
+
+    size = lseek(sSettingsFd, 0, SEEK_END);
+    VerifyOrDie(size >= 0);
+
+    if (size > 0)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        data = static_cast<uint8_t *>(malloc(static_cast<size_t>(size)));
+        VerifyOrDie(data != NULL && pread(sSettingsFd, data, static_cast<size_t>(size), 0) == size);
+    }
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    if (size >= static_cast<off_t>(sizeof(kLogMagic)) && memcmp(data, &kLogMagic, sizeof(kLogMagic)) == 0)
+    {
+        off_t committedSize = static_cast<off_t>(loadLog(data, static_cast<size_t>(size)));
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+        if (committedSize < size)
+        {
+            // drop the changes which were not committed
+            VerifyOrDie(ftruncate(sSettingsFd, committedSize) == 0);
+        }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        sLogSize     = committedSize;
+        sChecksum    = kChecksumInit;
+        sIsCommitted = true;
     }
+    else if (size > 0)
+    {
+        if (loadLegacy(data, static_cast<size_t>(size)) != OT_ERROR_NONE)
+        {
+            resetIndex();
+        }
 
-exit:
-    if (error == OT_ERROR_PARSE)
+        sLogSize = size;
+        compactLog();
+    }
+    else
     {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0);
+        writeMagic();
     }
+
+    free(data);
 }
 
-otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+otError otPlatSettingsBeginChange(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    sChangeDepth++;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsCommitChange(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(sChangeDepth > 0, error = OT_ERROR_INVALID_STATE);
 
-    while (offset < size)
+    if (--sChangeDepth == 0)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        commitLog();
+    }
+
+exit:
+    return error;
+}
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError error = OT_ERROR_NONE;
+    size_t  i     = findEntry(aKey, aIndex);
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    VerifyOrExit(i < sNumEntries, error = OT_ERROR_NOT_FOUND);
 
-        if (key == aKey)
+    if (aValueLength)
+    {
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            uint16_t readLength = (sEntries[i].mLength <= *aValueLength ? sEntries[i].mLength : *aValueLength);
+
+            VerifyOrDie(pread(sSettingsFd, aValue, readLength, sEntries[i].mOffset) == readLength);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = sEntries[i].mLength;
     }
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE);
     return error;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
+    otError error;
+
+    otPlatSettingsBeginChange(aInstance);
     otPlatSettingsDelete(aInstance, aKey, -1);
-    return otPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+    error = otPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+    otPlatSettingsCommitChange(aInstance);
+
+    return error;
 }
 
 otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen();
+    otError error = OT_ERROR_NONE;
 
-    if (size > 0)
-    {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET));
-        swapWrite(swapFd, static_cast<uint16_t>(size));
-    }
+    VerifyOrExit(aKey < kKeyDelete, error = OT_ERROR_INVALID_ARGS);
+    appendChange(aKey, aValue, aValueLength);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                write(swapFd, aValue, aValueLength) == aValueLength);
+    otError  error = OT_ERROR_NONE;
+    uint16_t deletion[2];
 
-    swapPersist(swapFd);
+    VerifyOrExit(findEntry(aKey, (aIndex == -1 ? 0 : aIndex)) < sNumEntries, error = OT_ERROR_NOT_FOUND);
 
-    return OT_ERROR_NONE;
+    deletion[0] = aKey;
+    deletion[1] = static_cast<uint16_t>(aIndex);
+    appendChange(kKeyDelete, deletion, sizeof(deletion));
+
+exit:
+    return error;
 }
 
-otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+void otPlatSettingsWipe(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen();
+    VerifyOrDie(0 == ftruncate(sSettingsFd, 0));
+    writeMagic();
+    VerifyOrDie(0 == fsync(sSettingsFd));
+    resetIndex();
+}
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+#if SELF_TEST
 
-    while (offset < size)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+#include <time.h>
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+uint64_t gNodeId = 1;
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+static off_t getSettingsFileSize(void)
+{
+    struct stat st;
 
-        offset += sizeof(key) + sizeof(length) + length;
+    assert(fstat(sSettingsFd, &st) == 0);
 
-        if (aKey == key)
-        {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
-        }
+    return st.st_size;
+}
+
+static void appendToSettingsFile(const void *aData, size_t aLength)
+{
+    char fileName[kMaxFileNameSize];
+    int  fd;
 
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key));
+    getSettingsFileName(fileName, false);
+    fd = open(fileName, O_WRONLY | O_APPEND);
+    assert(fd != -1);
+    assert(write(fd, aData, aLength) == static_cast<ssize_t>(aLength));
+    close(fd);
+}
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length));
+static uint64_t getNowUs(void)
+{
+    struct timespec now;
 
-        swapWrite(swapFd, length);
-    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000ULL + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
 
-    if (error == OT_ERROR_NONE)
+// Mirrors how `MleRouter` stores a child table with `RefreshStoredChildren()` and restores it after a reset.
+static void benchmarkChildTable(otInstance *aInstance)
+{
+    enum
+    {
+        kNumChildren = 512,
+        kKeyChild    = 5,
+    };
+
+    uint8_t  childInfo[16];
+    uint16_t length;
+    uint64_t start;
+    uint64_t refreshTime;
+    uint64_t storeTime;
+    uint64_t reloadTime;
+    uint64_t restoreTime;
+    int      count;
+
+    memset(childInfo, 0, sizeof(childInfo));
+
+    start = getNowUs();
+    otPlatSettingsBeginChange(aInstance);
+    otPlatSettingsDelete(aInstance, kKeyChild, -1);
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
     {
-        swapPersist(swapFd);
+        memcpy(childInfo, &i, sizeof(i));
+        assert(otPlatSettingsAdd(aInstance, kKeyChild, childInfo, sizeof(childInfo)) == OT_ERROR_NONE);
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+
+    assert(otPlatSettingsCommitChange(aInstance) == OT_ERROR_NONE);
+    refreshTime = getNowUs() - start;
+
+    // each child re-attaching replaces its own entry
+    start = getNowUs();
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
     {
-        swapDiscard(swapFd);
+        otPlatSettingsBeginChange(aInstance);
+        assert(otPlatSettingsDelete(aInstance, kKeyChild, 0) == OT_ERROR_NONE);
+        memcpy(childInfo, &i, sizeof(i));
+        assert(otPlatSettingsAdd(aInstance, kKeyChild, childInfo, sizeof(childInfo)) == OT_ERROR_NONE);
+        assert(otPlatSettingsCommitChange(aInstance) == OT_ERROR_NONE);
     }
 
-    return error;
-}
+    storeTime = getNowUs() - start;
 
-void otPlatSettingsWipe(otInstance *aInstance)
-{
-    OT_UNUSED_VARIABLE(aInstance);
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0));
-}
+    start = getNowUs();
+    otPlatSettingsInit(aInstance);
+    reloadTime = getNowUs() - start;
 
-#if SELF_TEST
+    start = getNowUs();
 
-uint64_t gNodeId = 1;
+    for (count = 0;; count++)
+    {
+        length = sizeof(childInfo);
+
+        if (otPlatSettingsGet(aInstance, kKeyChild, count, childInfo, &length) != OT_ERROR_NONE)
+        {
+            break;
+        }
+
+        assert(length == sizeof(childInfo) && memcmp(childInfo, &count, sizeof(uint16_t)) == 0);
+    }
+
+    restoreTime = getNowUs() - start;
+    assert(count == kNumChildren);
+
+    printf("child table of %d entries\n", kNumChildren);
+    printf("  refresh (one group)    : %8llu us\n", static_cast<unsigned long long>(refreshTime));
+    printf("  store each child       : %8llu us/child\n", static_cast<unsigned long long>(storeTime / kNumChildren));
+    printf("  reload index           : %8llu us\n", static_cast<unsigned long long>(reloadTime));
+    printf("  restore                : %8llu us\n", static_cast<unsigned long long>(restoreTime));
+    printf("  file size              : %8llu bytes\n", static_cast<unsigned long long>(getSettingsFileSize()));
+}
 
 int main()
 {
@@ -485,6 +886,103 @@ int main()
     }
     otPlatSettingsWipe(instance);
 
+    // verify records survive a reload
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, NULL, NULL) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a group of changes is dropped entirely if not committed
+    assert(otPlatSettingsCommitChange(instance) == OT_ERROR_INVALID_STATE);
+    assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsBeginChange(instance) == OT_ERROR_NONE);
+    assert(otPlatSettingsBeginChange(instance) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsCommitChange(instance) == OT_ERROR_NONE);
+    assert(otPlatSettingsGet(instance, 0, 0, NULL, NULL) == OT_ERROR_NOT_FOUND);
+    assert(otPlatSettingsGet(instance, 1, 0, NULL, NULL) == OT_ERROR_NONE);
+    otPlatSettingsInit(instance);
+    assert(otPlatSettingsGet(instance, 0, 0, NULL, NULL) == OT_ERROR_NONE);
+    assert(otPlatSettingsGet(instance, 1, 0, NULL, NULL) == OT_ERROR_NOT_FOUND);
+    otPlatSettingsWipe(instance);
+
+    // verify a torn record at the end of the file is dropped
+    assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    {
+        const off_t size = getSettingsFileSize();
+
+        appendToSettingsFile(data, 7);
+        otPlatSettingsInit(instance);
+        assert(getSettingsFileSize() == size);
+        assert(otPlatSettingsGet(instance, 0, 0, NULL, NULL) == OT_ERROR_NONE);
+        assert(otPlatSettingsAdd(instance, 1, data, sizeof(data)) == OT_ERROR_NONE);
+        otPlatSettingsInit(instance);
+        assert(otPlatSettingsGet(instance, 0, 0, NULL, NULL) == OT_ERROR_NONE);
+        assert(otPlatSettingsGet(instance, 1, 0, NULL, NULL) == OT_ERROR_NONE);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the log is compacted
+    for (int i = 0; i < 1000; i++)
+    {
+        assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    }
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(getSettingsFileSize() < 2 * kCompactMinSize);
+    otPlatSettingsInit(instance);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, NULL, NULL) == OT_ERROR_NOT_FOUND);
+        assert(otPlatSettingsGet(instance, 1, 0, NULL, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify a file of the former format is converted
+    {
+        const uint8_t legacy[] = {3, 0, 4, 0, 'a', 'b', 'c', 'd', 3, 0, 2, 0, 'e', 'f'};
+        uint8_t       value[sizeof(data)];
+        uint16_t      length = sizeof(value);
+
+        assert(ftruncate(sSettingsFd, 0) == 0);
+        appendToSettingsFile(legacy, sizeof(legacy));
+        otPlatSettingsInit(instance);
+
+        assert(otPlatSettingsGet(instance, 3, 1, value, &length) == OT_ERROR_NONE);
+        assert(length == 2 && 0 == memcmp(value, "ef", length));
+        otPlatSettingsInit(instance);
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 3, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == 4 && 0 == memcmp(value, "abcd", length));
+    }
+    otPlatSettingsWipe(instance);
+
+    benchmarkChildTable(instance);
+    otPlatSettingsWipe(instance);
+
+    printf("All tests passed\n");
     return 0;
 }
 #endif
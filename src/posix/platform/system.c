@@ -145,6 +145,7 @@ otInstance *otSysInit(int aArgCount, char *aArgVector[])
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
     otSimInit();
 #endif
+    platformPollerInit();
     platformAlarmInit(speedUpFactor);
     platformRadioInit(radioFile, radioConfig);
     platformRandomInit();
@@ -181,6 +182,7 @@ void otSysDeinit(void)
     otSimDeinit();
 #endif
     platformRadioDeinit();
+    platformPollerDeinit();
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -218,12 +220,13 @@ static int trySelect(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSe
 
 void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
 {
+#if OPENTHREAD_ENABLE_PLATFORM_UDP
+    platformUdpFlush();
+#endif
     platformAlarmUpdateTimeout(&aMainloop->mTimeout);
     platformUartUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                             &aMainloop->mMaxFd);
-#if OPENTHREAD_ENABLE_PLATFORM_UDP
-    platformUdpUpdateFdSet(aInstance, &aMainloop->mReadFdSet, &aMainloop->mMaxFd);
-#endif
+    platformPollerUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mMaxFd);
 #if OPENTHREAD_ENABLE_PLATFORM_NETIF
     platformNetifUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                              &aMainloop->mMaxFd);
@@ -297,7 +300,5 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
 #if OPENTHREAD_ENABLE_PLATFORM_NETIF
     platformNetifProcess(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet);
 #endif
-#if OPENTHREAD_ENABLE_PLATFORM_UDP
-    platformUdpProcess(aInstance, &aMainloop->mReadFdSet);
-#endif
+    platformPollerProcess(aInstance, &aMainloop->mReadFdSet);
 }
@@ -41,21 +41,26 @@
 
 #include <arpa/inet.h>
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <net/if.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/select.h>
 #include <unistd.h>
 
 #include <openthread/udp.h>
 #include <openthread/platform/udp.h>
 
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+#include "udp_batch.hpp"
 
 static uint32_t sPlatNetifIndex = 0;
 
-static const size_t kMaxUdpSize = 1280;
+static ot::PosixApp::UdpBatch sRxBatch;
+static ot::PosixApp::UdpBatch sTxBatch;
 
 static void *FdToHandle(int aFd)
 {
@@ -67,148 +72,49 @@ static int FdFromHandle(void *aHandle)
     return static_cast<int>(reinterpret_cast<long>(aHandle));
 }
 
-static bool IsLinkLocal(const struct in6_addr &aAddress)
+static void FlushTxBatch(void)
 {
-    return aAddress.s6_addr[0] == 0xfe && aAddress.s6_addr[1] == 0x80;
-}
+    uint32_t dropCount = sTxBatch.GetDropCount();
 
-static bool IsMulticast(const struct in6_addr &aAddress)
-{
-    return aAddress.s6_addr[0] == 0xff;
-}
+    sTxBatch.Send();
 
-static otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
-{
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr *    cmsg;
-    ssize_t             rval;
-
-    memset(&peerAddr, 0, sizeof(peerAddr));
-    peerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
-    peerAddr.sin6_family = AF_INET6;
-    memcpy(&peerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(peerAddr.sin6_addr));
-
-    if (IsLinkLocal(peerAddr.sin6_addr) && aMessageInfo.mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD)
+    if (sTxBatch.GetDropCount() != dropCount)
     {
-        // sin6_scope_id only works for link local destinations
-        peerAddr.sin6_scope_id = sPlatNetifIndex;
+        otLogWarnPlat("Dropped %u UDP datagrams, %u in total", sTxBatch.GetDropCount() - dropCount,
+                      sTxBatch.GetDropCount());
     }
+}
 
-    memset(control, 0, sizeof(control));
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    cmsg = CMSG_FIRSTHDR(&msg);
-
-    {
-        int hopLimit = (aMessageInfo.mHopLimit ? aMessageInfo.mHopLimit : -1);
-
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_HOPLIMIT;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
-
-        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
-
-        cmsg = CMSG_NXTHDR(&msg, cmsg);
-        controlLength += CMSG_SPACE(sizeof(int));
-    }
+static void handleUdpReadable(otInstance *aInstance, void *aContext)
+{
+    otUdpSocket *     socket      = static_cast<otUdpSocket *>(aContext);
+    void *            handle      = socket->mHandle;
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    int               count       = sRxBatch.Receive(FdFromHandle(handle));
 
-    if (!IsMulticast(reinterpret_cast<const struct in6_addr &>(aMessageInfo.mSockAddr)) &&
-        memcmp(&aMessageInfo.mSockAddr, &in6addr_any, sizeof(aMessageInfo.mSockAddr)))
+    // A handler may close or reconnect (replace) the socket, the rest of the batch is then dropped with it.
+    for (int i = 0; i < count && socket->mHandle == handle; i++)
     {
-        struct in6_pktinfo pktinfo;
-
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_PKTINFO;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(pktinfo));
+        otMessageInfo messageInfo;
+        otMessage *   message;
 
-        pktinfo.ipi6_ifindex = (aMessageInfo.mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD ? sPlatNetifIndex : 0);
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mSockPort = socket->mSockName.mPort;
+        sRxBatch.GetMessageInfo(i, sPlatNetifIndex, messageInfo);
 
-        memcpy(&pktinfo.ipi6_addr, &aMessageInfo.mSockAddr, sizeof(pktinfo.ipi6_addr));
-        memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
-
-        controlLength += CMSG_SPACE(sizeof(pktinfo));
-        cmsg = CMSG_NXTHDR(&msg, cmsg);
-    }
+        message = otUdpNewMessage(aInstance, &msgSettings);
+        VerifyOrExit(message != NULL);
 
-#ifdef __APPLE__
-    msg.msg_controllen = static_cast<socklen_t>(controlLength);
-#else
-    msg.msg_controllen = controlLength;
-#endif
-
-    rval = sendmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("sendmsg"));
-
-exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
-}
-
-static otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
-{
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
-
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
-    {
-        if (cmsg->cmsg_level == IPPROTO_IPV6)
+        if (otMessageAppend(message, sRxBatch.GetPayload(i), sRxBatch.GetLength(i)) == OT_ERROR_NONE)
         {
-            if (cmsg->cmsg_type == IPV6_HOPLIMIT)
-            {
-                int hoplimit;
-
-                memcpy(&hoplimit, CMSG_DATA(cmsg), sizeof(hoplimit));
-                aMessageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
-            }
-            else if (cmsg->cmsg_type == IPV6_PKTINFO)
-            {
-                struct in6_pktinfo pktinfo;
-
-                memcpy(&pktinfo, CMSG_DATA(cmsg), sizeof(pktinfo));
-
-                aMessageInfo.mInterfaceId =
-                    (pktinfo.ipi6_ifindex == sPlatNetifIndex ? static_cast<int8_t>(OT_NETIF_INTERFACE_ID_THREAD) : 0);
-                memcpy(&aMessageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(aMessageInfo.mSockAddr));
-            }
+            socket->mHandler(socket->mContext, message, &messageInfo);
         }
-    }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+        otMessageFree(message);
+    }
 
 exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+    return;
 }
 
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
@@ -221,6 +127,12 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
     fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
     VerifyOrExit(fd > 0, error = OT_ERROR_FAILED);
 
+    if (platformPollerAdd(fd, handleUdpReadable, aUdpSocket) != OT_ERROR_NONE)
+    {
+        close(fd);
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
     aUdpSocket->mHandle = FdToHandle(fd);
 
 exit:
@@ -234,6 +146,8 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
 
     VerifyOrExit(aUdpSocket->mHandle != NULL, error = OT_ERROR_INVALID_ARGS);
     fd = FdFromHandle(aUdpSocket->mHandle);
+    FlushTxBatch();
+    platformPollerRemove(fd);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = NULL;
@@ -293,6 +207,7 @@ otError otPlatUdpConnect(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != NULL, error = OT_ERROR_INVALID_ARGS);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    FlushTxBatch();
 
     memset(&sin6, 0, sizeof(struct sockaddr_in6));
     sin6.sin6_port = htons(aUdpSocket->mPeerName.mPort);
@@ -336,20 +251,34 @@ exit:
 
 otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    otError error = OT_ERROR_NONE;
-    int     fd;
+    otError                error = OT_ERROR_NONE;
+    const struct in6_addr &peer  = reinterpret_cast<const struct in6_addr &>(aMessageInfo->mPeerAddr);
+    uint16_t               len   = otMessageGetLength(aMessage);
+    uint8_t *              payload;
+    int                    fd;
 
+    // The datagram is only queued here, so reject everything the kernel would refuse before accepting it.
     VerifyOrExit(aUdpSocket->mHandle != NULL, error = OT_ERROR_INVALID_ARGS);
     fd = FdFromHandle(aUdpSocket->mHandle);
+    VerifyOrExit(fcntl(fd, F_GETFD) != -1, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(len <= ot::PosixApp::UdpBatch::kMaxDatagramSize, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(!IN6_IS_ADDR_UNSPECIFIED(&peer) && aMessageInfo->mPeerPort != 0, error = OT_ERROR_INVALID_ARGS);
 
-    {
-        uint8_t  payload[kMaxUdpSize];
-        uint16_t len = otMessageGetLength(aMessage);
+    // A link-local destination needs a scope, which is only known for Thread's interface.
+    VerifyOrExit(!IN6_IS_ADDR_LINKLOCAL(&peer) ||
+                     (aMessageInfo->mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD && sPlatNetifIndex != 0),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    payload = sTxBatch.AddDatagram(fd, *aMessageInfo, len, sPlatNetifIndex);
 
-        VerifyOrExit(len == otMessageRead(aMessage, 0, payload, len), error = OT_ERROR_INVALID_ARGS);
-        SuccessOrExit(error = transmitPacket(fd, payload, len, *aMessageInfo));
+    if (payload == NULL)
+    {
+        FlushTxBatch();
+        payload = sTxBatch.AddDatagram(fd, *aMessageInfo, len, sPlatNetifIndex);
     }
 
+    otMessageRead(aMessage, 0, payload, len);
+
 exit:
     if (error == OT_ERROR_NONE)
     {
@@ -359,32 +288,6 @@ exit:
     return error;
 }
 
-void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd)
-{
-    VerifyOrExit(sPlatNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != NULL; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == NULL)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        FD_SET(fd, aReadFdSet);
-
-        if (aMaxFd != NULL && *aMaxFd < fd)
-        {
-            *aMaxFd = fd;
-        }
-    }
-
-exit:
-    return;
-}
-
 void platformUdpInit(const char *aIfName)
 {
     if (aIfName == NULL)
@@ -400,51 +303,7 @@ void platformUdpInit(const char *aIfName)
     }
 }
 
-void platformUdpProcess(otInstance *aInstance, const fd_set *aReadFdSet)
+void platformUdpFlush(void)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
-
-    VerifyOrExit(sPlatNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != NULL; socket = socket->mNext)
-    {
-        int fd = FdFromHandle(socket->mHandle);
-
-        if (fd > 0 && FD_ISSET(fd, aReadFdSet))
-        {
-            otMessageInfo messageInfo;
-            otMessage *   message = NULL;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
-
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
-
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
-
-            message = otUdpNewMessage(aInstance, &msgSettings);
-
-            if (message == NULL)
-            {
-                continue;
-            }
-
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
-
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
-        }
-    }
-
-exit:
-    return;
+    FlushTxBatch();
 }
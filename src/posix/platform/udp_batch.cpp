@@ -0,0 +1,532 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements batching datagrams of the platform UDP driver.
+ */
+
+#ifdef __APPLE__
+#define __APPLE_USE_RFC_3542
+#endif
+
+#include "udp_batch.hpp"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace ot {
+namespace PosixApp {
+
+static bool IsLinkLocal(const struct in6_addr &aAddress)
+{
+    return aAddress.s6_addr[0] == 0xfe && aAddress.s6_addr[1] == 0x80;
+}
+
+static bool IsMulticast(const struct in6_addr &aAddress)
+{
+    return aAddress.s6_addr[0] == 0xff;
+}
+
+UdpBatch::UdpBatch(void)
+    : mCount(0)
+    , mDropCount(0)
+{
+    for (int i = 0; i < kMaxDatagrams; i++)
+    {
+        InitHeader(i);
+    }
+}
+
+void UdpBatch::InitHeader(int aIndex)
+{
+    Datagram &     datagram = mDatagrams[aIndex];
+    struct msghdr &msg      = mHeaders[aIndex].msg_hdr;
+
+    datagram.mIovec.iov_base = datagram.mPayload;
+    datagram.mIovec.iov_len  = sizeof(datagram.mPayload);
+
+    msg.msg_name       = &datagram.mPeerAddr;
+    msg.msg_namelen    = sizeof(datagram.mPeerAddr);
+    msg.msg_control    = datagram.mControl.mBuffer;
+    msg.msg_controllen = sizeof(datagram.mControl.mBuffer);
+    msg.msg_iov        = &datagram.mIovec;
+    msg.msg_iovlen     = 1;
+    msg.msg_flags      = 0;
+
+    mHeaders[aIndex].msg_len = 0;
+}
+
+uint8_t *UdpBatch::AddDatagram(int aFd, const otMessageInfo &aMessageInfo, uint16_t aLength, unsigned int aNetifIndex)
+{
+    uint8_t *       payload       = NULL;
+    Datagram *      datagram      = NULL;
+    struct msghdr * msg           = NULL;
+    size_t          controlLength = 0;
+    struct cmsghdr *cmsg;
+
+    VerifyOrExit(mCount < kMaxDatagrams && aLength <= kMaxDatagramSize);
+
+    InitHeader(mCount);
+    datagram = &mDatagrams[mCount];
+    msg      = &mHeaders[mCount].msg_hdr;
+
+    datagram->mFd            = aFd;
+    datagram->mIovec.iov_len = aLength;
+
+    memset(&datagram->mPeerAddr, 0, sizeof(datagram->mPeerAddr));
+    datagram->mPeerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
+    datagram->mPeerAddr.sin6_family = AF_INET6;
+    memcpy(&datagram->mPeerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(datagram->mPeerAddr.sin6_addr));
+
+    if (IsLinkLocal(datagram->mPeerAddr.sin6_addr) && aMessageInfo.mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD)
+    {
+        // sin6_scope_id only works for link local destinations
+        datagram->mPeerAddr.sin6_scope_id = aNetifIndex;
+    }
+
+    memset(datagram->mControl.mBuffer, 0, sizeof(datagram->mControl.mBuffer));
+
+    cmsg = CMSG_FIRSTHDR(msg);
+
+    {
+        int hopLimit = (aMessageInfo.mHopLimit ? aMessageInfo.mHopLimit : -1);
+
+        cmsg->cmsg_level = IPPROTO_IPV6;
+        cmsg->cmsg_type  = IPV6_HOPLIMIT;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+
+        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+
+        cmsg = CMSG_NXTHDR(msg, cmsg);
+        controlLength += CMSG_SPACE(sizeof(int));
+    }
+
+    if (!IsMulticast(reinterpret_cast<const struct in6_addr &>(aMessageInfo.mSockAddr)) &&
+        memcmp(&aMessageInfo.mSockAddr, &in6addr_any, sizeof(aMessageInfo.mSockAddr)))
+    {
+        struct in6_pktinfo pktinfo;
+
+        cmsg->cmsg_level = IPPROTO_IPV6;
+        cmsg->cmsg_type  = IPV6_PKTINFO;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(pktinfo));
+
+        pktinfo.ipi6_ifindex = (aMessageInfo.mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD ? aNetifIndex : 0);
+
+        memcpy(&pktinfo.ipi6_addr, &aMessageInfo.mSockAddr, sizeof(pktinfo.ipi6_addr));
+        memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+        controlLength += CMSG_SPACE(sizeof(pktinfo));
+    }
+
+#ifdef __APPLE__
+    msg->msg_controllen = static_cast<socklen_t>(controlLength);
+#else
+    msg->msg_controllen = controlLength;
+#endif
+
+    payload = datagram->mPayload;
+    mCount++;
+
+exit:
+    return payload;
+}
+
+void UdpBatch::Send(void)
+{
+    int index = 0;
+
+    while (index < mCount)
+    {
+        int fd    = mDatagrams[index].mFd;
+        int count = 1;
+        int sent;
+
+        while (index + count < mCount && mDatagrams[index + count].mFd == fd)
+        {
+            count++;
+        }
+
+#ifdef __linux__
+        sent = sendmmsg(fd, &mHeaders[index], static_cast<unsigned int>(count), 0);
+#else
+        sent = (sendmsg(fd, &mHeaders[index].msg_hdr, 0) >= 0 ? 1 : -1);
+#endif
+
+        if (sent <= 0)
+        {
+            // drop the datagram that failed, the ones after it are retried
+            perror("sendmmsg");
+            mDropCount++;
+            sent = 1;
+        }
+
+        index += sent;
+    }
+
+    mCount = 0;
+}
+
+int UdpBatch::Receive(int aFd)
+{
+    int rval;
+
+    for (int i = 0; i < kMaxDatagrams; i++)
+    {
+        InitHeader(i);
+    }
+
+    // The socket may have been replaced (reusing the same descriptor) by a handler called earlier in the same
+    // wake-up, so never block here.
+#ifdef __linux__
+    rval = recvmmsg(aFd, mHeaders, kMaxDatagrams, MSG_DONTWAIT, NULL);
+#else
+    for (rval = 0; rval < kMaxDatagrams; rval++)
+    {
+        ssize_t length = recvmsg(aFd, &mHeaders[rval].msg_hdr, MSG_DONTWAIT);
+
+        if (length < 0)
+        {
+            break;
+        }
+
+        mHeaders[rval].msg_len = static_cast<unsigned int>(length);
+    }
+
+    if (rval == 0)
+    {
+        rval = -1;
+    }
+#endif
+
+    if (rval < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            perror("recvmmsg");
+        }
+
+        rval = 0;
+    }
+
+    mCount = rval;
+
+    return mCount;
+}
+
+void UdpBatch::GetMessageInfo(int aIndex, unsigned int aNetifIndex, otMessageInfo &aMessageInfo) const
+{
+    const Datagram &datagram = mDatagrams[aIndex];
+    struct msghdr * msg      = const_cast<struct msghdr *>(&mHeaders[aIndex].msg_hdr);
+
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL; cmsg = CMSG_NXTHDR(msg, cmsg))
+    {
+        if (cmsg->cmsg_level == IPPROTO_IPV6)
+        {
+            if (cmsg->cmsg_type == IPV6_HOPLIMIT)
+            {
+                int hoplimit;
+
+                memcpy(&hoplimit, CMSG_DATA(cmsg), sizeof(hoplimit));
+                aMessageInfo.mHopLimit = static_cast<uint8_t>(hoplimit);
+            }
+            else if (cmsg->cmsg_type == IPV6_PKTINFO)
+            {
+                struct in6_pktinfo pktinfo;
+
+                memcpy(&pktinfo, CMSG_DATA(cmsg), sizeof(pktinfo));
+
+                aMessageInfo.mInterfaceId =
+                    (pktinfo.ipi6_ifindex == aNetifIndex ? static_cast<int8_t>(OT_NETIF_INTERFACE_ID_THREAD) : 0);
+                memcpy(&aMessageInfo.mSockAddr, &pktinfo.ipi6_addr, sizeof(aMessageInfo.mSockAddr));
+            }
+        }
+    }
+
+    aMessageInfo.mPeerPort = ntohs(datagram.mPeerAddr.sin6_port);
+    memcpy(&aMessageInfo.mPeerAddr, &datagram.mPeerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+}
+
+} // namespace PosixApp
+} // namespace ot
+
+#if SELF_TEST
+
+#include <assert.h>
+#include <net/if.h>
+#include <time.h>
+#include <unistd.h>
+
+using ot::PosixApp::UdpBatch;
+
+enum
+{
+    kNumRounds   = 5000,
+    kPayloadSize = 100,
+    kHopLimit    = 17,
+};
+
+static int                 sSenders[2];
+static int                 sReceiver;
+static struct sockaddr_in6 sReceiverAddr;
+static unsigned int        sLoopbackIndex;
+
+static uint64_t GetNowNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+static int OpenSocket(struct sockaddr_in6 &aAddress)
+{
+    int       fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+    int       on = 1;
+    int       rval;
+    socklen_t length;
+
+    assert(fd >= 0);
+
+    memset(&aAddress, 0, sizeof(aAddress));
+    aAddress.sin6_family = AF_INET6;
+    aAddress.sin6_addr   = in6addr_loopback;
+    rval                 = bind(fd, reinterpret_cast<struct sockaddr *>(&aAddress), sizeof(aAddress));
+    assert(rval == 0);
+
+    length = sizeof(aAddress);
+    rval   = getsockname(fd, reinterpret_cast<struct sockaddr *>(&aAddress), &length);
+    assert(rval == 0);
+
+    rval = setsockopt(fd, IPPROTO_IPV6, IPV6_RECVHOPLIMIT, &on, sizeof(on));
+    assert(rval == 0);
+    rval = setsockopt(fd, IPPROTO_IPV6, IPV6_RECVPKTINFO, &on, sizeof(on));
+    assert(rval == 0);
+
+    OT_UNUSED_VARIABLE(rval);
+
+    return fd;
+}
+
+static void InitMessageInfo(otMessageInfo &aMessageInfo)
+{
+    memset(&aMessageInfo, 0, sizeof(aMessageInfo));
+    memcpy(&aMessageInfo.mPeerAddr, &in6addr_loopback, sizeof(aMessageInfo.mPeerAddr));
+    memcpy(&aMessageInfo.mSockAddr, &in6addr_loopback, sizeof(aMessageInfo.mSockAddr));
+    aMessageInfo.mPeerPort = ntohs(sReceiverAddr.sin6_port);
+    aMessageInfo.mHopLimit = kHopLimit;
+}
+
+static void QueueDatagrams(UdpBatch &aBatch, uint32_t aSequence, int aCount)
+{
+    otMessageInfo messageInfo;
+
+    InitMessageInfo(messageInfo);
+
+    for (int i = 0; i < aCount; i++)
+    {
+        uint32_t sequence = aSequence + static_cast<uint32_t>(i);
+        uint8_t *payload  = aBatch.AddDatagram(sSenders[i % 2], messageInfo, kPayloadSize, sLoopbackIndex);
+
+        assert(payload != NULL);
+        memset(payload, 0, kPayloadSize);
+        memcpy(payload, &sequence, sizeof(sequence));
+    }
+}
+
+// Mirrors the former platform UDP driver, which called `sendmsg()` once per sent datagram and `recvmsg()` once per
+// readable event.
+static uint64_t BenchmarkSingle(void)
+{
+    UdpBatch batch;
+    uint64_t start = GetNowNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (int i = 0; i < UdpBatch::kMaxDatagrams; i++)
+        {
+            QueueDatagrams(batch, round * UdpBatch::kMaxDatagrams + static_cast<uint32_t>(i), 1);
+            batch.Send();
+        }
+
+        for (int i = 0; i < UdpBatch::kMaxDatagrams; i++)
+        {
+            uint8_t       payload[UdpBatch::kMaxDatagramSize];
+            uint8_t       control[UdpBatch::kMaxDatagramSize];
+            struct iovec  iov = {payload, sizeof(payload)};
+            struct msghdr msg;
+            ssize_t       length;
+
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov        = &iov;
+            msg.msg_iovlen     = 1;
+            msg.msg_control    = control;
+            msg.msg_controllen = sizeof(control);
+
+            length = recvmsg(sReceiver, &msg, 0);
+            assert(length == kPayloadSize);
+            OT_UNUSED_VARIABLE(length);
+        }
+    }
+
+    return GetNowNs() - start;
+}
+
+static uint64_t BenchmarkBatch(void)
+{
+    UdpBatch txBatch;
+    UdpBatch rxBatch;
+    uint64_t start = GetNowNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        int received = 0;
+
+        QueueDatagrams(txBatch, round * UdpBatch::kMaxDatagrams, UdpBatch::kMaxDatagrams);
+        txBatch.Send();
+
+        while (received < UdpBatch::kMaxDatagrams)
+        {
+            received += rxBatch.Receive(sReceiver);
+        }
+    }
+
+    return GetNowNs() - start;
+}
+
+int main(void)
+{
+    struct sockaddr_in6 senderAddrs[2];
+    UdpBatch            batch;
+    int                 received = 0;
+    uint64_t            singleElapsed;
+    uint64_t            batchElapsed;
+
+#ifdef __APPLE__
+    sLoopbackIndex = if_nametoindex("lo0");
+#else
+    sLoopbackIndex = if_nametoindex("lo");
+#endif
+    sSenders[0]    = OpenSocket(senderAddrs[0]);
+    sSenders[1]    = OpenSocket(senderAddrs[1]);
+    sReceiver      = OpenSocket(sReceiverAddr);
+
+    // verify the batch bounds
+    {
+        otMessageInfo messageInfo;
+        uint8_t *     payload;
+
+        InitMessageInfo(messageInfo);
+        payload = batch.AddDatagram(sSenders[0], messageInfo, UdpBatch::kMaxDatagramSize + 1, sLoopbackIndex);
+        assert(payload == NULL);
+        QueueDatagrams(batch, 0, UdpBatch::kMaxDatagrams);
+        payload = batch.AddDatagram(sSenders[0], messageInfo, kPayloadSize, sLoopbackIndex);
+        assert(payload == NULL);
+        assert(batch.GetCount() == UdpBatch::kMaxDatagrams);
+        OT_UNUSED_VARIABLE(payload);
+    }
+
+    // verify payloads and ancillary data survive a batch interleaving two sockets
+    batch.Send();
+    assert(batch.GetCount() == 0);
+
+    while (received < UdpBatch::kMaxDatagrams)
+    {
+        int count = batch.Receive(sReceiver);
+
+        for (int i = 0; i < count; i++, received++)
+        {
+            otMessageInfo messageInfo;
+            uint32_t      sequence;
+
+            memset(&messageInfo, 0, sizeof(messageInfo));
+            batch.GetMessageInfo(i, sLoopbackIndex, messageInfo);
+            memcpy(&sequence, batch.GetPayload(i), sizeof(sequence));
+
+            assert(batch.GetLength(i) == kPayloadSize);
+            assert(sequence == static_cast<uint32_t>(received));
+            assert(messageInfo.mHopLimit == kHopLimit);
+            assert(messageInfo.mInterfaceId == OT_NETIF_INTERFACE_ID_THREAD);
+            assert(memcmp(&messageInfo.mSockAddr, &in6addr_loopback, sizeof(messageInfo.mSockAddr)) == 0);
+            assert(memcmp(&messageInfo.mPeerAddr, &in6addr_loopback, sizeof(messageInfo.mPeerAddr)) == 0);
+            assert(messageInfo.mPeerPort == ntohs(senderAddrs[received % 2].sin6_port));
+        }
+    }
+
+    received = batch.Receive(sReceiver);
+    assert(received == 0);
+    assert(batch.GetDropCount() == 0);
+
+    // verify a datagram that fails to be sent is counted and dropped, and the ones after it are still sent
+    {
+        otMessageInfo messageInfo;
+        uint8_t *     payload;
+        int           closed = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+        assert(closed >= 0);
+        close(closed);
+
+        InitMessageInfo(messageInfo);
+        payload = batch.AddDatagram(closed, messageInfo, kPayloadSize, sLoopbackIndex);
+        assert(payload != NULL);
+        QueueDatagrams(batch, 0, 1);
+        batch.Send();
+        assert(batch.GetDropCount() == 1);
+
+        do
+        {
+            received = batch.Receive(sReceiver);
+        } while (received == 0);
+
+        assert(received == 1);
+        OT_UNUSED_VARIABLE(payload);
+    }
+
+    singleElapsed = BenchmarkSingle();
+    batchElapsed  = BenchmarkBatch();
+
+    printf("%d rounds of %d datagrams of %d bytes over loopback\n", kNumRounds, UdpBatch::kMaxDatagrams,
+           kPayloadSize);
+    printf("  sendmsg/recvmsg per datagram : %8llu ns/datagram\n",
+           static_cast<unsigned long long>(singleElapsed / (kNumRounds * UdpBatch::kMaxDatagrams)));
+    printf("  batched                      : %8llu ns/datagram\n",
+           static_cast<unsigned long long>(batchElapsed / (kNumRounds * UdpBatch::kMaxDatagrams)));
+
+    close(sSenders[0]);
+    close(sSenders[1]);
+    close(sReceiver);
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#endif // SELF_TEST
@@ -0,0 +1,198 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for batching datagrams of the platform UDP driver.
+ */
+
+#ifndef POSIX_APP_UDP_BATCH_HPP_
+#define POSIX_APP_UDP_BATCH_HPP_
+
+#include "platform-config.h"
+
+#include <stdint.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <openthread/ip6.h>
+
+namespace ot {
+namespace PosixApp {
+
+/**
+ * This class implements a batch of UDP datagrams sent or received with a single system call.
+ *
+ * On Linux the datagrams are exchanged with `sendmmsg()`/`recvmmsg()`, elsewhere one `sendmsg()`/`recvmsg()` is
+ * issued per datagram. All message headers, control buffers and payloads are allocated with the object, so nothing
+ * is allocated or re-initialized per datagram beyond its addresses and ancillary data. An object is used either for
+ * sending or for receiving datagrams, not both.
+ *
+ */
+class UdpBatch
+{
+public:
+    enum
+    {
+        kMaxDatagrams    = OPENTHREAD_CONFIG_POSIX_UDP_BATCH_SIZE, ///< Maximum number of datagrams in a batch.
+        kMaxDatagramSize = 1280,                                   ///< Maximum datagram size (number of bytes).
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    UdpBatch(void);
+
+    /**
+     * This method queues a datagram to be sent by `Send()`.
+     *
+     * The destination, hop limit and source address (as `IPV6_PKTINFO`) are taken from @p aMessageInfo. The caller
+     * copies the payload to the returned buffer before calling `Send()`.
+     *
+     * @param[in]  aFd           The socket file descriptor to send the datagram on.
+     * @param[in]  aMessageInfo  The message info of the datagram.
+     * @param[in]  aLength       The payload length (number of bytes), at most `kMaxDatagramSize`.
+     * @param[in]  aNetifIndex   The index of Thread's platform network interface.
+     *
+     * @returns A pointer to the payload buffer of the datagram, or NULL if the batch is full.
+     *
+     */
+    uint8_t *AddDatagram(int aFd, const otMessageInfo &aMessageInfo, uint16_t aLength, unsigned int aNetifIndex);
+
+    /**
+     * This method sends all datagrams queued by `AddDatagram()` and empties the batch.
+     *
+     * Consecutive datagrams on the same socket are sent with a single system call. A datagram that fails to be sent
+     * is reported with `perror()`, counted in `GetDropCount()` and dropped.
+     *
+     */
+    void Send(void);
+
+    /**
+     * This method returns the number of queued datagrams that failed to be sent.
+     *
+     * @returns The number of datagrams dropped by `Send()`.
+     *
+     */
+    uint32_t GetDropCount(void) const { return mDropCount; }
+
+    /**
+     * This method receives the datagrams pending on a socket, without blocking.
+     *
+     * The received datagrams are valid until the next call to `Receive()`.
+     *
+     * @param[in]  aFd  The socket file descriptor to receive datagrams from.
+     *
+     * @returns The number of datagrams received.
+     *
+     */
+    int Receive(int aFd);
+
+    /**
+     * This method returns the number of datagrams in the batch.
+     *
+     * @returns The number of datagrams in the batch.
+     *
+     */
+    int GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the payload of a received datagram.
+     *
+     * @param[in]  aIndex  The index of the datagram, less than `GetCount()`.
+     *
+     * @returns A pointer to the payload of the datagram.
+     *
+     */
+    const uint8_t *GetPayload(int aIndex) const { return mDatagrams[aIndex].mPayload; }
+
+    /**
+     * This method returns the payload length of a received datagram.
+     *
+     * @param[in]  aIndex  The index of the datagram, less than `GetCount()`.
+     *
+     * @returns The payload length (number of bytes) of the datagram.
+     *
+     */
+    uint16_t GetLength(int aIndex) const { return static_cast<uint16_t>(mHeaders[aIndex].msg_len); }
+
+    /**
+     * This method fills the peer address and port, hop limit, socket address and interface of a received datagram.
+     *
+     * The other fields of @p aMessageInfo are not modified.
+     *
+     * @param[in]   aIndex        The index of the datagram, less than `GetCount()`.
+     * @param[in]   aNetifIndex   The index of Thread's platform network interface.
+     * @param[out]  aMessageInfo  A reference to the message info to fill.
+     *
+     */
+    void GetMessageInfo(int aIndex, unsigned int aNetifIndex, otMessageInfo &aMessageInfo) const;
+
+private:
+    enum
+    {
+        kControlSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int)),
+    };
+
+#ifdef __linux__
+    typedef struct mmsghdr MultiMessageHeader;
+#else
+    struct MultiMessageHeader
+    {
+        struct msghdr msg_hdr;
+        unsigned int  msg_len;
+    };
+#endif
+
+    struct Datagram
+    {
+        struct sockaddr_in6 mPeerAddr;
+        struct iovec        mIovec;
+        int                 mFd;
+        uint8_t             mPayload[kMaxDatagramSize];
+        union
+        {
+            size_t  mAlign; // aligns the control buffer as `struct cmsghdr`
+            uint8_t mBuffer[kControlSize];
+        } mControl;
+    };
+
+    void InitHeader(int aIndex);
+
+    MultiMessageHeader mHeaders[kMaxDatagrams];
+    Datagram           mDatagrams[kMaxDatagrams];
+    int                mCount;
+    uint32_t           mDropCount;
+};
+
+} // namespace PosixApp
+} // namespace ot
+
+#endif // POSIX_APP_UDP_BATCH_HPP_
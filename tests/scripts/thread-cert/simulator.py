@@ -28,9 +28,10 @@
 #
 
 import binascii
-import bisect
 import cmd
+import heapq
 import os
+import random
 import socket
 import struct
 import sys
@@ -133,6 +134,9 @@ class VirtualTime(BaseSimulator):
     RADIO_ONLY = os.getenv('RADIO_DEVICE') != None
     NCP_SIM = os.getenv('NODE_TYPE', 'sim') == 'ncp-sim'
 
+    # Seed of the pseudo random generator deciding frame losses, so that lossy runs are reproducible.
+    RANDOM_SEED = int(os.getenv('VIRTUAL_TIME_SEED', '0'))
+
     def __init__(self):
         super(VirtualTime, self).__init__()
         self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
@@ -142,6 +146,7 @@ class VirtualTime(BaseSimulator):
         self.sock.bind((ip, self.port))
 
         self.devices = {}
+        # binary heap ordered by (time, sequence), superseded alarm events are dropped lazily
         self.event_queue = []
         # there could be events scheduled at exactly the same time
         self.event_sequence = 0
@@ -157,6 +162,10 @@ class VirtualTime(BaseSimulator):
 
         self._message_factory = config.create_default_thread_message_factory()
 
+        # (src nodeid, dst nodeid) -> (loss probability, delay in us)
+        self._links = {}
+        self._random = random.Random(self.RANDOM_SEED)
+
     def __del__(self):
         if self.sock:
             self.stop()
@@ -181,6 +190,30 @@ class VirtualTime(BaseSimulator):
     def set_lowpan_context(self, cid, prefix):
         self._message_factory.set_lowpan_context(cid, prefix)
 
+    def set_link(self, src, dst, loss=0.0, delay=0):
+        """ Set the radio link model for frames sent from node `src` to node `dst`.
+
+        Args:
+            src (int): nodeid of the transmitter
+            dst (int): nodeid of the receiver
+            loss (float): probability in [0, 1] that a frame is not received
+            delay (int): extra propagation delay in microseconds
+        """
+        assert 0.0 <= loss <= 1.0 and delay >= 0
+
+        if loss == 0.0 and delay == 0:
+            self._links.pop((src, dst), None)
+        else:
+            self._links[(src, dst)] = (loss, delay)
+
+    def _push_event(self, event):
+        heapq.heappush(self.event_queue, event)
+        self.event_sequence += 1
+
+    def _is_stale(self, event):
+        return event[self.EVENT_TYPE] == self.OT_SIM_EVENT_ALARM_FIRED and \
+            self.devices[event[self.EVENT_ADDR]]['alarm'] is not event
+
     def get_messages_sent_by(self, nodeid):
         """ Get sniffed messages.
 
@@ -219,6 +252,9 @@ class VirtualTime(BaseSimulator):
             return ('127.0.0.1', self.port + nodeid)
 
     def _next_event_time(self):
+        while len(self.event_queue) and self._is_stale(self.event_queue[0]):
+            heapq.heappop(self.event_queue)
+
         if len(self.event_queue) == 0:
             return self.END_OF_TIME
         else:
@@ -242,8 +278,9 @@ class VirtualTime(BaseSimulator):
                     print('Current event:')
                     print(self.current_event)
                     print('Events:')
-                    for event in self.event_queue:
-                        print(event)
+                    for event in sorted(self.event_queue):
+                        if not self._is_stale(event):
+                            print(event)
                     raise
             else:
                 self.sock.settimeout(0)
@@ -271,16 +308,10 @@ class VirtualTime(BaseSimulator):
                 dbg_print("New event: ", event_time, addr, type, datalen)
 
             if type == self.OT_SIM_EVENT_ALARM_FIRED:
-                # remove any existing alarm event for device
-                if self.devices[addr]['alarm']:
-                    self.event_queue.remove(self.devices[addr]['alarm'])
-                    #print "-- Remove\t", self.devices[addr]['alarm']
-
-                # add alarm event to event queue
+                # add alarm event to event queue, any existing alarm event for device becomes stale
                 event = (event_time, self.event_sequence, addr, type, datalen)
-                self.event_sequence += 1
                 #print "-- Enqueue\t", event, delay, self.current_time
-                bisect.insort(self.event_queue, event)
+                self._push_event(event)
                 self.devices[addr]['alarm'] = event
 
                 self.awake_devices.discard(addr)
@@ -291,21 +322,23 @@ class VirtualTime(BaseSimulator):
 
             elif type == self.OT_SIM_EVENT_RADIO_RECEIVED:
                 assert self._is_radio(addr)
-                # add radio receive events event queue
-                for device in self.devices:
+                # add radio receive events event queue, devices are sorted to keep lossy runs deterministic
+                src = addr[1] - self.port
+                for device in sorted(self.devices):
                     if device != addr and self._is_radio(device):
-                        event = (event_time, self.event_sequence, device, type, datalen, data)
-                        self.event_sequence += 1
+                        loss, link_delay = self._links.get((src, device[1] - self.port), (0.0, 0))
+                        if loss and self._random.random() < loss:
+                            continue
+                        event = (event_time + link_delay, self.event_sequence, device, type, datalen, data)
                         #print "-- Enqueue\t", event
-                        bisect.insort(self.event_queue, event)
+                        self._push_event(event)
 
                 self._pcap.append(data, (event_time // 1000000, event_time % 1000000))
                 self._add_message(addr[1] - self.port, data)
 
                 # add radio transmit done events to event queue
                 event = (event_time, self.event_sequence, addr, type, datalen, data)
-                self.event_sequence += 1
-                bisect.insort(self.event_queue, event)
+                self._push_event(event)
 
                 self.awake_devices.add(addr)
 
@@ -316,8 +349,7 @@ class VirtualTime(BaseSimulator):
                     self.awake_devices.add(radio_addr)
 
                 event = (event_time, self.event_sequence, radio_addr, self.OT_SIM_EVENT_UART_WRITE, datalen, data)
-                self.event_sequence += 1
-                bisect.insort(self.event_queue, event)
+                self._push_event(event)
 
                 self.awake_devices.add(addr)
 
@@ -328,8 +360,7 @@ class VirtualTime(BaseSimulator):
                     self.awake_devices.add(core_addr)
 
                 event = (event_time, self.event_sequence, core_addr, self.OT_SIM_EVENT_RADIO_SPINEL_WRITE, datalen, data)
-                self.event_sequence += 1
-                bisect.insort(self.event_queue, event)
+                self._push_event(event)
 
                 self.awake_devices.add(addr)
 
@@ -354,8 +385,8 @@ class VirtualTime(BaseSimulator):
         assert self.current_event is None
         assert self._next_event_time() < self.END_OF_TIME
 
-        # process next event
-        event = self.event_queue.pop(0)
+        # process next event, `_next_event_time()` above dropped any stale alarm on top of the heap
+        event = heapq.heappop(self.event_queue)
 
         if len(event) == 5:
             event_time, sequence, addr, type, datalen = event
@@ -96,6 +96,10 @@ class SnifferSocketTransport(SnifferTransport):
 
     PORT_OFFSET = int(os.getenv('PORT_OFFSET', "0"))
 
+    MULTICAST_GROUP = '224.0.0.116'
+
+    USE_MULTICAST = os.getenv('RADIO_MEDIUM', 'udp') == 'multicast'
+
     def __init__(self, nodeid):
         self._nodeid = nodeid
         self._socket = None
@@ -122,7 +126,17 @@ class SnifferSocketTransport(SnifferTransport):
         if not self.is_opened:
             raise RuntimeError("Transport opening failed.")
 
-        self._socket.bind(self._nodeid_to_address(self._nodeid))
+        if self.USE_MULTICAST:
+            # All nodes share the base port and receive every frame sent to the group.
+            self._socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+            if hasattr(socket, 'SO_REUSEPORT'):
+                self._socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+            self._socket.bind(self._nodeid_to_address(0))
+
+            membership = socket.inet_aton(self.MULTICAST_GROUP) + socket.inet_aton('127.0.0.1')
+            self._socket.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+        else:
+            self._socket.bind(self._nodeid_to_address(self._nodeid))
 
     def close(self):
         if not self.is_opened:
@@ -136,7 +150,10 @@ class SnifferSocketTransport(SnifferTransport):
         return bool(self._socket is not None)
 
     def send(self, data, nodeid):
-        address = self._nodeid_to_address(nodeid)
+        if self.USE_MULTICAST:
+            address = self._nodeid_to_address(0, self.MULTICAST_GROUP)
+        else:
+            address = self._nodeid_to_address(nodeid)
 
         return self._socket.sendto(data, address)
 
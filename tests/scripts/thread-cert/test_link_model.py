@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2019, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+import unittest
+
+import config
+import node
+
+LEADER = 1
+ROUTER = 2
+
+
+@unittest.skipUnless(config.VIRTUAL_TIME, 'the link model is part of the virtual time coordinator')
+class TestLinkModel(unittest.TestCase):
+
+    def setUp(self):
+        self.simulator = config.create_default_simulator()
+
+        self.nodes = {}
+        for i in range(1, 3):
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
+
+        self.nodes[LEADER].set_panid(0xface)
+        self.nodes[LEADER].set_mode('rsdn')
+
+        self.nodes[ROUTER].set_panid(0xface)
+        self.nodes[ROUTER].set_mode('rsdn')
+        self.nodes[ROUTER].set_router_selection_jitter(1)
+
+    def tearDown(self):
+        for node in list(self.nodes.values()):
+            node.stop()
+            node.destroy()
+        self.simulator.stop()
+
+    def _set_link(self, loss=0.0, delay=0):
+        self.simulator.set_link(LEADER, ROUTER, loss, delay)
+        self.simulator.set_link(ROUTER, LEADER, loss, delay)
+
+    def _ping_leader(self):
+        return self.nodes[ROUTER].ping(self.nodes[LEADER].get_addr_rloc())
+
+    def test_loss(self):
+        self.nodes[LEADER].start()
+        self.simulator.go(5)
+        self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
+
+        # a link that drops every frame splits the nodes into two partitions
+        self._set_link(loss=1.0)
+        self.nodes[ROUTER].start()
+        self.simulator.go(10)
+        self.assertEqual(self.nodes[ROUTER].get_state(), 'leader')
+        self.assertFalse(self._ping_leader())
+
+        # once the link is restored the partitions merge
+        self._set_link()
+        self.simulator.go(150)
+        self.assertEqual(sorted([n.get_state() for n in self.nodes.values()]), ['leader', 'router'])
+
+        # a lossy link is still usable thanks to MAC retransmissions
+        self._set_link(loss=0.2)
+        self.assertTrue(self._ping_leader())
+
+    def test_delay(self):
+        # the delay stays below the MAC ack timeout so acknowledged frames still succeed
+        self._set_link(delay=4000)
+
+        self.nodes[LEADER].start()
+        self.simulator.go(5)
+        self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
+
+        self.nodes[ROUTER].start()
+        self.simulator.go(7)
+        self.assertEqual(self.nodes[ROUTER].get_state(), 'router')
+
+        self.assertTrue(self._ping_leader())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,249 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread_ftd.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+enum
+{
+    kCacheEntries       = OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
+    kBenchmarkLookups   = 100000,
+    kRloc16Base         = 0x0400,
+    kBenchmarkFillSteps = 4,
+    kMaxAge             = 0xff, // `otEidCacheEntry::mAge` saturates at this value.
+};
+
+static Instance *sInstance;
+
+static Ip6::Address MakeEid(uint16_t aIndex)
+{
+    Ip6::Address eid;
+
+    memset(&eid, 0, sizeof(eid));
+    eid.mFields.m16[0] = Encoding::BigEndian::HostSwap16(0xfd00);
+    eid.mFields.m16[6] = Encoding::BigEndian::HostSwap16(0x1234);
+    eid.mFields.m16[7] = Encoding::BigEndian::HostSwap16(aIndex);
+
+    return eid;
+}
+
+// Adds a cached (resolved) entry for `MakeEid(aIndex)`.
+static void AddCachedEntry(AddressResolver &aResolver, uint16_t aIndex)
+{
+    Ip6::Address eid = MakeEid(aIndex);
+    uint16_t     rloc16;
+
+    VerifyOrQuit(aResolver.Resolve(eid, rloc16) == OT_ERROR_ADDRESS_QUERY, "Resolve() did not start a query");
+
+    // Let the stack process (and free) the Address Query message.
+    otTaskletsProcess(sInstance);
+
+    aResolver.UpdateCacheEntry(eid, kRloc16Base + aIndex);
+
+    SuccessOrQuit(aResolver.Resolve(eid, rloc16), "Resolve() failed for a cached entry");
+    VerifyOrQuit(rloc16 == kRloc16Base + aIndex, "Resolve() returned incorrect RLOC16");
+}
+
+static int ExpectedAge(int aAge)
+{
+    return (aAge < kMaxAge) ? aAge : kMaxAge;
+}
+
+// Returns the age of the cache entry for `aEid`, or -1 if it is not a valid entry.
+static int GetEntryAge(AddressResolver &aResolver, const Ip6::Address &aEid)
+{
+    int             age = -1;
+    otEidCacheEntry entry;
+
+    for (uint16_t i = 0; aResolver.GetEntry(i, entry) == OT_ERROR_NONE; i++)
+    {
+        if (entry.mValid && static_cast<const Ip6::Address &>(entry.mTarget) == aEid)
+        {
+            age = entry.mAge;
+            break;
+        }
+    }
+
+    return age;
+}
+
+void TestAddressResolverCache(void)
+{
+    uint16_t rloc16;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    AddressResolver &resolver = sInstance->Get<AddressResolver>();
+
+    printf("TestAddressResolverCache");
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        AddCachedEntry(resolver, i);
+        VerifyOrQuit(GetEntryAge(resolver, MakeEid(i)) == 0, "Resolved entry is not the most recently used");
+    }
+
+    // All entries are resolvable, oldest entry has the highest age.
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(GetEntryAge(resolver, MakeEid(i)) == ExpectedAge(kCacheEntries - 1 - i), "Entry age is incorrect");
+    }
+
+    // Using the oldest entry makes it the most recently used one.
+
+    SuccessOrQuit(resolver.Resolve(MakeEid(0), rloc16), "Resolve() failed");
+    VerifyOrQuit(rloc16 == kRloc16Base, "Resolve() returned incorrect RLOC16");
+    VerifyOrQuit(GetEntryAge(resolver, MakeEid(0)) == 0, "Used entry is not the most recently used");
+
+    if (kCacheEntries > 1)
+    {
+        VerifyOrQuit(GetEntryAge(resolver, MakeEid(1)) == ExpectedAge(kCacheEntries - 1), "Entry age is incorrect");
+    }
+
+    // A new EID evicts the least recently used entry (EID 1, or EID 0 for a single-entry cache).
+
+    VerifyOrQuit(resolver.Resolve(MakeEid(kCacheEntries), rloc16) == OT_ERROR_ADDRESS_QUERY,
+                 "Resolve() did not start a query");
+    otTaskletsProcess(sInstance);
+    VerifyOrQuit(GetEntryAge(resolver, MakeEid(kCacheEntries > 1 ? 1 : 0)) == -1, "LRU entry was not evicted");
+
+    resolver.UpdateCacheEntry(MakeEid(kCacheEntries), kRloc16Base + kCacheEntries);
+    SuccessOrQuit(resolver.Resolve(MakeEid(kCacheEntries), rloc16), "Resolve() failed");
+    VerifyOrQuit(rloc16 == kRloc16Base + kCacheEntries, "Resolve() returned incorrect RLOC16");
+
+    // Removing entries by RLOC16 invalidates them, remaining entries still resolve.
+
+    resolver.Remove(static_cast<uint16_t>(kRloc16Base + kCacheEntries));
+    VerifyOrQuit(GetEntryAge(resolver, MakeEid(kCacheEntries)) == -1, "Remove() did not invalidate the entry");
+
+    for (uint16_t i = (kCacheEntries > 1 ? 2 : 1); i < kCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver.Resolve(MakeEid(i), rloc16), "Resolve() failed after Remove()");
+        VerifyOrQuit(rloc16 == kRloc16Base + i, "Resolve() returned incorrect RLOC16");
+    }
+
+    // Churn through many more EIDs than cache entries, each new one evicting
+    // the least recently used, and verify the most recent ones all resolve.
+
+    resolver.Clear();
+
+    for (uint16_t i = 0; i < 4 * kCacheEntries; i++)
+    {
+        AddCachedEntry(resolver, i);
+    }
+
+    for (uint16_t i = 3 * kCacheEntries; i < 4 * kCacheEntries; i++)
+    {
+        SuccessOrQuit(resolver.Resolve(MakeEid(i), rloc16), "Resolve() failed after churn");
+        VerifyOrQuit(rloc16 == kRloc16Base + i, "Resolve() returned incorrect RLOC16");
+    }
+
+    for (uint16_t i = 0; i < 3 * kCacheEntries; i++)
+    {
+        VerifyOrQuit(GetEntryAge(resolver, MakeEid(i)) == -1, "Evicted entry is still in the cache");
+    }
+
+    resolver.Clear();
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(GetEntryAge(resolver, MakeEid(i)) == -1, "Clear() did not remove all entries");
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestAddressResolverBenchmark(void)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    AddressResolver &resolver = sInstance->Get<AddressResolver>();
+    uint16_t         numEntries = 0;
+
+    printf("TestAddressResolverBenchmark (cache size %d)\n", kCacheEntries);
+
+    for (uint8_t step = 1; step <= kBenchmarkFillSteps; step++)
+    {
+        uint16_t fill = static_cast<uint16_t>((kCacheEntries * step) / kBenchmarkFillSteps);
+        uint32_t start;
+        uint32_t duration;
+        uint16_t rloc16;
+
+        if (fill == 0 || fill == numEntries)
+        {
+            continue;
+        }
+
+        for (; numEntries < fill; numEntries++)
+        {
+            AddCachedEntry(resolver, numEntries);
+        }
+
+        start = otPlatAlarmMicroGetNow();
+
+        for (uint32_t i = 0; i < kBenchmarkLookups; i++)
+        {
+            uint16_t index = static_cast<uint16_t>((i * 7) % numEntries);
+
+            SuccessOrQuit(resolver.Resolve(MakeEid(index), rloc16), "Resolve() failed");
+        }
+
+        duration = otPlatAlarmMicroGetNow() - start;
+
+        printf("  %4d entries: %6lu ns/resolve\n", numEntries,
+               static_cast<unsigned long>((static_cast<uint64_t>(duration) * 1000) / kBenchmarkLookups));
+    }
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestAddressResolverCache();
+    ot::TestAddressResolverBenchmark();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -26,9 +26,12 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sys/time.h>
+
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "crypto/aes_accel.hpp"
 #include "crypto/aes_ccm.hpp"
 #include "utils/wrap_string.h"
 
@@ -134,11 +137,245 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed\n");
 }
 
+static void VerifyCcmVector(const uint8_t *aKey,
+                            const uint8_t *aNonce,
+                            const uint8_t *aPacket,
+                            uint32_t       aHeaderLength,
+                            uint32_t       aPayloadLength,
+                            const uint8_t *aEncrypted,
+                            uint8_t        aTagLength)
+{
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            test[64];
+    uint8_t            tag[16];
+    uint8_t            tagLength = aTagLength;
+
+    memcpy(test, aPacket, aHeaderLength + aPayloadLength);
+
+    aesCcm.SetKey(aKey, 16);
+    aesCcm.Init(aHeaderLength, aPayloadLength, aTagLength, aNonce, 13);
+    aesCcm.Header(test, aHeaderLength);
+    aesCcm.Payload(test + aHeaderLength, test + aHeaderLength, aPayloadLength, true);
+    aesCcm.Finalize(test + aHeaderLength + aPayloadLength, &tagLength);
+
+    VerifyOrQuit(memcmp(test, aEncrypted, aHeaderLength + aPayloadLength + aTagLength) == 0,
+                 "TestRfc3610Vectors encrypt failed\n");
+
+    aesCcm.Init(aHeaderLength, aPayloadLength, aTagLength, aNonce, 13);
+    aesCcm.Header(test, aHeaderLength);
+    aesCcm.Payload(test + aHeaderLength, test + aHeaderLength, aPayloadLength, false);
+    aesCcm.Finalize(tag, &tagLength);
+
+    VerifyOrQuit(memcmp(test, aPacket, aHeaderLength + aPayloadLength) == 0, "TestRfc3610Vectors decrypt failed\n");
+    VerifyOrQuit(memcmp(tag, aEncrypted + aHeaderLength + aPayloadLength, aTagLength) == 0,
+                 "TestRfc3610Vectors decrypt failed\n");
+}
+
+/**
+ * Verifies test vectors from RFC 3610 Section 8 (Packet Vectors #1 to #3), with and without the AES instructions.
+ */
+void TestRfc3610Vectors(void)
+{
+    const uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    const uint8_t packet[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+    };
+
+    const uint8_t nonce1[] = {
+        0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    const uint8_t encrypted1[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66,
+        0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84, 0x17, 0xe8, 0xd1, 0x2c, 0xfd,
+        0xf9, 0x26, 0xe0,
+    };
+
+    const uint8_t nonce2[] = {
+        0x00, 0x00, 0x00, 0x04, 0x03, 0x02, 0x01, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    const uint8_t encrypted2[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x72, 0xc9, 0x1a, 0x36, 0xe1, 0x35, 0xf8, 0xcf, 0x29, 0x1c,
+        0xa8, 0x94, 0x08, 0x5c, 0x87, 0xe3, 0xcc, 0x15, 0xc4, 0x39, 0xc9, 0xe4, 0x3a, 0x3b, 0xa0, 0x91, 0xd5, 0x6e,
+        0x10, 0x40, 0x09, 0x16,
+    };
+
+    const uint8_t nonce3[] = {
+        0x00, 0x00, 0x00, 0x05, 0x04, 0x03, 0x02, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+    };
+
+    const uint8_t encrypted3[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x51, 0xb1, 0xe5, 0xf4, 0x4a, 0x19, 0x7d, 0x1d, 0xa4, 0x6b,
+        0x0f, 0x8e, 0x2d, 0x28, 0x2a, 0xe8, 0x71, 0xe8, 0x38, 0xbb, 0x64, 0xda, 0x85, 0x96, 0x57, 0x4a, 0xda, 0xa7,
+        0x6f, 0xbd, 0x9f, 0xb0, 0xc5,
+    };
+
+    for (int enabled = 0; enabled < 2; enabled++)
+    {
+        ot::Crypto::AesAccel::SetEnabled(enabled != 0);
+
+        VerifyCcmVector(key, nonce1, packet, 8, 23, encrypted1, 8);
+        VerifyCcmVector(key, nonce2, packet, 8, 24, encrypted2, 8);
+        VerifyCcmVector(key, nonce3, packet, 8, 25, encrypted3, 8);
+    }
+
+    ot::Crypto::AesAccel::SetEnabled(true);
+}
+
+static void CcmEncrypt(ot::Crypto::AesCcm &aAesCcm,
+                       uint8_t *           aFrame,
+                       uint32_t            aHeaderLength,
+                       uint32_t            aPayloadLength,
+                       uint32_t            aSplit,
+                       bool                aEncrypt)
+{
+    static const uint8_t kNonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    uint8_t *payload   = aFrame + aHeaderLength;
+    uint8_t  tagLength = 8;
+
+    aAesCcm.Init(aHeaderLength, aPayloadLength, tagLength, kNonce, sizeof(kNonce));
+    aAesCcm.Header(aFrame, aHeaderLength);
+    aAesCcm.Payload(payload, payload, aSplit, aEncrypt);
+    aAesCcm.Payload(payload + aSplit, payload + aSplit, aPayloadLength - aSplit, aEncrypt);
+    aAesCcm.Finalize(payload + aPayloadLength, &tagLength);
+}
+
+/**
+ * Verifies that the AES instructions compute the same frames as mbedTLS, for payloads processed in two parts.
+ */
+void TestAesAccelMatchesMbedTls(void)
+{
+    const uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    const uint32_t headerLengths[] = {0, 5, 16, 29};
+
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            frame[160];
+    uint8_t            expected[160];
+
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (size_t i = 0; i < sizeof(headerLengths) / sizeof(headerLengths[0]); i++)
+    {
+        for (uint32_t payloadLength = 0; payloadLength <= 100; payloadLength++)
+        {
+            uint32_t splits[] = {0, payloadLength / 3, payloadLength};
+
+            for (size_t j = 0; j < sizeof(splits) / sizeof(splits[0]); j++)
+            {
+                uint32_t frameLength = headerLengths[i] + payloadLength + 8;
+
+                for (uint32_t k = 0; k < frameLength; k++)
+                {
+                    frame[k] = expected[k] = static_cast<uint8_t>(k * 7 + payloadLength);
+                }
+
+                ot::Crypto::AesAccel::SetEnabled(false);
+                CcmEncrypt(aesCcm, expected, headerLengths[i], payloadLength, splits[j], true);
+
+                ot::Crypto::AesAccel::SetEnabled(true);
+                CcmEncrypt(aesCcm, frame, headerLengths[i], payloadLength, splits[j], true);
+
+                VerifyOrQuit(memcmp(frame, expected, frameLength) == 0, "TestAesAccelMatchesMbedTls encrypt failed\n");
+
+                // decrypting the frame computes the tag of the plaintext again
+                CcmEncrypt(aesCcm, frame, headerLengths[i], payloadLength, splits[j], false);
+
+                for (uint32_t k = 0; k < headerLengths[i] + payloadLength; k++)
+                {
+                    VerifyOrQuit(frame[k] == static_cast<uint8_t>(k * 7 + payloadLength),
+                                 "TestAesAccelMatchesMbedTls decrypt failed\n");
+                }
+
+                VerifyOrQuit(memcmp(frame + headerLengths[i] + payloadLength,
+                                    expected + headerLengths[i] + payloadLength, 8) == 0,
+                             "TestAesAccelMatchesMbedTls decrypt failed\n");
+            }
+        }
+    }
+}
+
+static uint64_t GetNowUsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
+static void BenchmarkCcm(uint32_t aHeaderLength, uint32_t aPayloadLength, uint32_t aIterations)
+{
+    const uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            frame[1280 + 32];
+    uint64_t           elapsed[2];
+
+    memset(frame, 0, sizeof(frame));
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (int enabled = 0; enabled < 2; enabled++)
+    {
+        uint64_t start;
+
+        ot::Crypto::AesAccel::SetEnabled(enabled != 0);
+        start = GetNowUsec();
+
+        for (uint32_t i = 0; i < aIterations; i++)
+        {
+            CcmEncrypt(aesCcm, frame, aHeaderLength, aPayloadLength, aPayloadLength, true);
+        }
+
+        elapsed[enabled] = GetNowUsec() - start;
+
+        if (elapsed[enabled] == 0)
+        {
+            elapsed[enabled] = 1;
+        }
+    }
+
+    ot::Crypto::AesAccel::SetEnabled(true);
+
+    printf("AES-CCM %4u byte header, %4u byte payload: mbedTLS %7.1f MB/s, AES instructions %7.1f MB/s\n",
+           aHeaderLength, aPayloadLength, static_cast<double>(aPayloadLength) * aIterations / elapsed[0],
+           static_cast<double>(aPayloadLength) * aIterations / elapsed[1]);
+}
+
+/**
+ * Measures the AES-CCM throughput of mbedTLS and of the AES instructions.
+ */
+void TestAesCcmBenchmark(void)
+{
+    if (!ot::Crypto::AesAccel::IsAvailable())
+    {
+        printf("AES instructions are not available, AES-CCM uses mbedTLS\n");
+    }
+
+    BenchmarkCcm(21, 102, 20000);
+    BenchmarkCcm(13, 1232, 2000);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestRfc3610Vectors();
+    TestAesAccelMatchesMbedTls();
+    TestAesCcmBenchmark();
     printf("All tests passed\n");
     return 0;
 }
@@ -72,7 +72,8 @@ static bool StateMatchesFilter(Child::State aState, ChildTable::StateFilter aFil
     bool  rval = false;
     Child child;
 
-    child.SetState(aState);
+    // A `Child` outside of the child table, so its state is set through the `Neighbor` base.
+    static_cast<Neighbor &>(child).SetState(aState);
 
     switch (aFilter)
     {
@@ -339,9 +340,9 @@ void TestChildTable(void)
         child = table->GetNewChild();
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
-        child->SetState(testChildList[i].mState);
-        child->SetRloc16(testChildList[i].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress)));
+        table->SetChildState(*child, testChildList[i].mState);
+        table->SetChildRloc16(*child, testChildList[i].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress));
 
         VerifyChildTableContent(*table, i + 1, testChildList);
     }
@@ -361,9 +362,9 @@ void TestChildTable(void)
         child = table->GetNewChild();
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
-        child->SetState(testChildList[i - 1].mState);
-        child->SetRloc16(testChildList[i - 1].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress)));
+        table->SetChildState(*child, testChildList[i - 1].mState);
+        table->SetChildRloc16(*child, testChildList[i - 1].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress));
 
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
@@ -390,7 +391,7 @@ void TestChildTable(void)
         Child *child = table->GetNewChild();
 
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
-        child->SetState(Child::kStateValid);
+        table->SetChildState(*child, Child::kStateValid);
     }
 
     VerifyOrQuit(table->GetNewChild() == NULL, "GetNewChild() did not fail when table was full");
@@ -400,12 +401,249 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+// Searches the child table entry by entry, as the reference for `ChildTable::FindChild()` (which never returns a
+// child in `Child::kStateInvalid`).
+static Child *FindChildBySearch(ChildTable &aTable, uint16_t aRloc16, ChildTable::StateFilter aFilter)
+{
+    for (uint8_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = aTable.GetChildAtIndex(index);
+
+        if ((child->GetState() != Child::kStateInvalid) && StateMatchesFilter(child->GetState(), aFilter) &&
+            (child->GetRloc16() == aRloc16))
+        {
+            return child;
+        }
+    }
+
+    return NULL;
+}
+
+static Child *FindChildBySearch(ChildTable &aTable, const Mac::ExtAddress &aAddress, ChildTable::StateFilter aFilter)
+{
+    for (uint8_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = aTable.GetChildAtIndex(index);
+
+        if ((child->GetState() != Child::kStateInvalid) && StateMatchesFilter(child->GetState(), aFilter) &&
+            (child->GetExtAddress() == aAddress))
+        {
+            return child;
+        }
+    }
+
+    return NULL;
+}
+
+static void SetTestExtAddress(Mac::ExtAddress &aAddress, uint16_t aSeed)
+{
+    for (uint8_t i = 0; i < sizeof(aAddress.m8); i++)
+    {
+        aAddress.m8[i] = static_cast<uint8_t>((aSeed >> (i % 2 ? 8 : 0)) + i * 0x11);
+    }
+}
+
+// Verifies `FindChild()` against a search of the table for all RLOC16s and extended addresses derived from seeds.
+static void VerifyChildLookups(ChildTable &aTable, uint16_t aMaxSeed)
+{
+    for (uint8_t k = 0; k < OT_ARRAY_LENGTH(kAllFilters); k++)
+    {
+        ChildTable::StateFilter filter = kAllFilters[k];
+
+        for (uint16_t seed = 0; seed <= aMaxSeed; seed++)
+        {
+            uint16_t        rloc16 = 0x8000 | seed;
+            Mac::ExtAddress extAddress;
+
+            SetTestExtAddress(extAddress, seed);
+
+            VerifyOrQuit(aTable.FindChild(rloc16, filter) == FindChildBySearch(aTable, rloc16, filter),
+                         "FindChild(rloc) does not match a search of the table");
+            VerifyOrQuit(aTable.FindChild(extAddress, filter) == FindChildBySearch(aTable, extAddress, filter),
+                         "FindChild(ExtAddress) does not match a search of the table");
+        }
+    }
+}
+
+void TestChildTableLookup(void)
+{
+    enum
+    {
+        kMaxSeed    = 600,
+        kIterations = 20000,
+    };
+
+    ChildTable *    table;
+    Mac::ExtAddress extAddress;
+    uint32_t        start;
+    uint32_t        searchDuration;
+    uint32_t        duration;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable lookup index");
+
+    // Fill the table, with child IDs spread across the whole child ID range.
+
+    for (uint8_t i = 0; i < kMaxChildren; i++)
+    {
+        Child *  child = table->GetNewChild();
+        uint16_t seed  = static_cast<uint16_t>(1 + (i * 37) % 511);
+
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+        SetTestExtAddress(extAddress, seed);
+        table->SetChildState(*child, (i % 3) ? Child::kStateValid : Child::kStateRestored);
+        table->SetChildRloc16(*child, 0x8000 | seed);
+        table->SetChildExtAddress(*child, extAddress);
+    }
+
+    VerifyChildLookups(*table, kMaxSeed);
+
+    // Swap addresses between children and change states, updating the index after each change.
+
+    for (uint8_t i = 0; i + 1 < kMaxChildren; i += 2)
+    {
+        Child *         first  = table->GetChildAtIndex(i);
+        Child *         second = table->GetChildAtIndex(i + 1);
+        uint16_t        rloc16 = first->GetRloc16();
+        Mac::ExtAddress address(first->GetExtAddress());
+
+        table->SetChildRloc16(*first, second->GetRloc16());
+        table->SetChildExtAddress(*first, second->GetExtAddress());
+        table->SetChildRloc16(*second, rloc16);
+        table->SetChildExtAddress(*second, address);
+        table->SetChildState(*second, Child::kStateChildIdRequest);
+    }
+
+    VerifyChildLookups(*table, kMaxSeed);
+
+    // Remove some children and reuse their entries with new addresses.
+
+    for (uint8_t i = 0; i < kMaxChildren; i += 3)
+    {
+        Child *child = table->GetChildAtIndex(i);
+
+        table->SetChildState(*child, Child::kStateInvalid);
+
+        // A removed child keeps its stale addresses, which no filter matches.
+        VerifyOrQuit(table->FindChild(child->GetRloc16(), ChildTable::kInStateAnyExceptValidOrRestoring) == NULL,
+                     "FindChild(rloc) returned a removed child");
+        VerifyOrQuit(table->FindChild(child->GetExtAddress(), ChildTable::kInStateAnyExceptValidOrRestoring) == NULL,
+                     "FindChild(ExtAddress) returned a removed child");
+    }
+
+    VerifyChildLookups(*table, kMaxSeed);
+
+    for (uint16_t seed = 520; seed < kMaxSeed; seed++)
+    {
+        Child *child = table->GetNewChild();
+
+        if (child == NULL)
+        {
+            break;
+        }
+
+        SetTestExtAddress(extAddress, seed);
+        table->SetChildState(*child, Child::kStateValid);
+        table->SetChildRloc16(*child, 0x8000 | seed);
+        table->SetChildExtAddress(*child, extAddress);
+    }
+
+    VerifyChildLookups(*table, kMaxSeed);
+
+    table->Clear();
+
+    VerifyChildLookups(*table, kMaxSeed);
+
+    printf(" -- PASS\n");
+
+    // Benchmark lookups at full table, looking up the last child added.
+
+    for (uint8_t i = 0; i < kMaxChildren; i++)
+    {
+        Child *child = table->GetNewChild();
+
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+        SetTestExtAddress(extAddress, i + 1);
+        table->SetChildState(*child, Child::kStateValid);
+        table->SetChildRloc16(*child, 0x8000 | (i + 1));
+        table->SetChildExtAddress(*child, extAddress);
+    }
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(FindChildBySearch(*table, 0x8000 | kMaxChildren, ChildTable::kInStateValidOrRestoring) != NULL,
+                     "search failed");
+        VerifyOrQuit(FindChildBySearch(*table, extAddress, ChildTable::kInStateValidOrRestoring) != NULL,
+                     "search failed");
+    }
+
+    searchDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(table->FindChild(0x8000 | kMaxChildren, ChildTable::kInStateValidOrRestoring) != NULL,
+                     "FindChild(rloc) failed");
+        VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateValidOrRestoring) != NULL,
+                     "FindChild(ExtAddress) failed");
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+
+    printf("Lookups of %d children x %d: search %lu usec, FindChild() %lu usec\n", kMaxChildren, kIterations,
+           static_cast<unsigned long>(searchDuration), static_cast<unsigned long>(duration));
+
+    // Benchmark negative lookups at full table: an RLOC16 sharing the child ID of a child but with other router
+    // bits, and an extended address not in the table.
+
+    SetTestExtAddress(extAddress, kMaxChildren + 1);
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(FindChildBySearch(*table, 0x0400 | kMaxChildren, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                     "search found an absent child");
+        VerifyOrQuit(FindChildBySearch(*table, extAddress, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                     "search found an absent child");
+    }
+
+    searchDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(table->FindChild(0x0400 | kMaxChildren, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                     "FindChild(rloc) found an absent child");
+        VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                     "FindChild(ExtAddress) found an absent child");
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+
+    printf("Negative lookups at %d children x %d: search %lu usec, FindChild() %lu usec\n", kMaxChildren, kIterations,
+           static_cast<unsigned long>(searchDuration), static_cast<unsigned long>(duration));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableLookup();
     printf("\nAll tests passed.\n");
     return 0;
 }
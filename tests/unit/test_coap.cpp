@@ -0,0 +1,881 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "coap/coap.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kNumResources   = 40,
+    kNumRequests    = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE + 2, ///< Exceeds the index, fits the buffers.
+    kNumDuplicates  = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
+    kTokenLength    = 4,
+    kPeerPort       = 61631,
+    kMaxUriPathSize = 8,
+};
+
+/**
+ * This class exposes the receive path of `Coap::CoapBase` and records the header of every message it sends.
+ *
+ * Sent messages are freed, unless queueing is enabled, in which case they are kept for delivery to a peer.
+ *
+ */
+class TestCoap : public Coap::CoapBase
+{
+public:
+    struct SentMessage
+    {
+        Coap::Message::Type mType;
+        Coap::Message::Code mCode;
+        uint16_t            mMessageId;
+        uint8_t             mTokenLength;
+        uint8_t             mToken[OT_COAP_MAX_TOKEN_LENGTH];
+    };
+
+    explicit TestCoap(Instance &aInstance)
+        : CoapBase(aInstance, &TestCoap::Send)
+        , mNumSent(0)
+        , mMaxSentLength(0)
+        , mQueueSent(false)
+    {
+    }
+
+    using CoapBase::Receive;
+
+    const SentMessage &GetLastSent(void) const { return mLastSent; }
+    uint16_t           GetNumSent(void) const { return mNumSent; }
+    uint16_t           GetMaxSentLength(void) const { return mMaxSentLength; }
+    void               SetQueueSent(bool aQueueSent) { mQueueSent = aQueueSent; }
+
+    Coap::Message *DequeueSent(void)
+    {
+        Coap::Message *message = static_cast<Coap::Message *>(mSentQueue.GetHead());
+
+        if (message != NULL)
+        {
+            mSentQueue.Dequeue(*message);
+            message->SetOffset(0);
+        }
+
+        return message;
+    }
+
+private:
+    static otError Send(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        TestCoap &           coap    = static_cast<TestCoap &>(aCoapBase);
+        const Coap::Message &message = static_cast<const Coap::Message &>(aMessage);
+
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        coap.mLastSent.mType        = message.GetType();
+        coap.mLastSent.mCode        = message.GetCode();
+        coap.mLastSent.mMessageId   = message.GetMessageId();
+        coap.mLastSent.mTokenLength = message.GetTokenLength();
+        memcpy(coap.mLastSent.mToken, message.GetToken(), message.GetTokenLength());
+        coap.mNumSent++;
+
+        if (aMessage.GetLength() > coap.mMaxSentLength)
+        {
+            coap.mMaxSentLength = aMessage.GetLength();
+        }
+
+        if (coap.mQueueSent)
+        {
+            coap.mSentQueue.Enqueue(aMessage);
+        }
+        else
+        {
+            aMessage.Free();
+        }
+
+        return OT_ERROR_NONE;
+    }
+
+    SentMessage  mLastSent;
+    uint16_t     mNumSent;
+    uint16_t     mMaxSentLength;
+    bool         mQueueSent;
+    MessageQueue mSentQueue;
+};
+
+static void InitPeer(Ip6::MessageInfo &aMessageInfo, uint16_t aPort)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("fd00:db8::1"), "Ip6::Address::FromString() failed");
+    aMessageInfo.SetPeerAddr(address);
+    SuccessOrQuit(address.FromString("fd00:db8::2"), "Ip6::Address::FromString() failed");
+    aMessageInfo.SetSockAddr(address);
+    aMessageInfo.SetPeerPort(aPort);
+}
+
+static void ReceiveMessage(TestCoap &             aCoap,
+                           Coap::Message::Type    aType,
+                           Coap::Message::Code    aCode,
+                           uint16_t               aMessageId,
+                           const uint8_t *        aToken,
+                           uint8_t                aTokenLength,
+                           const char *           aUriPath,
+                           const Ip6::MessageInfo &aMessageInfo)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+    message->SetToken(aToken, aTokenLength);
+
+    if (aUriPath != NULL)
+    {
+        SuccessOrQuit(message->AppendUriPathOptions(aUriPath), "Coap::Message::AppendUriPathOptions() failed");
+    }
+
+    message->Finish();
+
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint16_t *>(aContext))++;
+}
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    if (aResult == OT_ERROR_NONE && aMessage != NULL)
+    {
+        (*static_cast<uint16_t *>(aContext))++;
+    }
+}
+
+void TestResourceDispatch(void)
+{
+    Instance *       instance = static_cast<Instance *>(testInitInstance());
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+    otCoapResource   resources[kNumResources];
+    char             uriPaths[kNumResources][kMaxUriPathSize];
+    uint16_t         handled[kNumResources];
+
+    InitPeer(messageInfo, kPeerPort);
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        snprintf(uriPaths[i], sizeof(uriPaths[i]), "r/%u", i);
+        resources[i].mUriPath = uriPaths[i];
+        resources[i].mHandler = HandleRequest;
+        resources[i].mContext = &handled[i];
+        resources[i].mNext    = NULL;
+        handled[i]            = 0;
+
+        SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resources[i])), "AddResource() failed");
+    }
+
+    VerifyOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resources[0])) == OT_ERROR_ALREADY,
+                 "AddResource() accepted a resource twice");
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        ReceiveMessage(coap, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST, i + 1, NULL, 0, uriPaths[i],
+                       messageInfo);
+
+        for (uint16_t j = 0; j < kNumResources; j++)
+        {
+            VerifyOrQuit(handled[j] == (j <= i ? 1 : 0), "request was dispatched to the wrong resource");
+        }
+    }
+
+    VerifyOrQuit(coap.GetCounters().mResourceLookups == kNumResources, "unexpected number of resource lookups");
+    VerifyOrQuit(coap.GetCounters().mResourceProbes < 2 * kNumResources, "resource dispatch compares too many paths");
+
+    printf("%d resources: %u Uri-Path comparisons for %u requests\n", kNumResources,
+           coap.GetCounters().mResourceProbes, coap.GetCounters().mResourceLookups);
+
+    // Requests for removed resources are answered with 4.04 Not Found.
+    for (uint16_t i = 0; i < kNumResources; i += 2)
+    {
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+    }
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        uint16_t numSent = coap.GetNumSent();
+
+        ReceiveMessage(coap, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST, kNumResources + i + 1, NULL, 0,
+                       uriPaths[i], messageInfo);
+
+        if (i % 2 == 0)
+        {
+            VerifyOrQuit(handled[i] == 1, "removed resource handled a request");
+            VerifyOrQuit(coap.GetNumSent() == numSent + 1 && coap.GetLastSent().mCode == OT_COAP_CODE_NOT_FOUND,
+                         "request for a removed resource was not rejected");
+        }
+        else
+        {
+            VerifyOrQuit(handled[i] == 2, "request was not dispatched after removing other resources");
+        }
+    }
+
+    for (uint16_t i = 1; i < kNumResources; i += 2)
+    {
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+    }
+
+    testFreeInstance(instance);
+}
+
+static void TestRequestMatching(uint16_t aNumRequests)
+{
+    Instance *                instance = static_cast<Instance *>(testInitInstance());
+    TestCoap                  coap(*instance);
+    Ip6::MessageInfo          messageInfo;
+    TestCoap::SentMessage     sent[kNumRequests];
+    uint16_t                  responses[kNumRequests];
+    const Coap::CoapCounters &counters = coap.GetCounters();
+
+    InitPeer(messageInfo, kPeerPort);
+
+    for (uint16_t i = 0; i < aNumRequests; i++)
+    {
+        Coap::Message *message = coap.NewMessage();
+
+        VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+        message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+        message->SetToken(kTokenLength);
+        SuccessOrQuit(message->AppendUriPathOptions("t"), "Coap::Message::AppendUriPathOptions() failed");
+
+        responses[i] = 0;
+        SuccessOrQuit(coap.SendMessage(*message, messageInfo, HandleResponse, &responses[i]), "SendMessage() failed");
+        sent[i] = coap.GetLastSent();
+    }
+
+    VerifyOrQuit(counters.mPendingRequests == aNumRequests, "unexpected pending queue depth");
+    VerifyOrQuit(counters.mPendingRequestsPeak == aNumRequests, "unexpected pending queue peak");
+
+    // Odd requests get a piggybacked response, even requests an empty acknowledgment first.
+    for (uint16_t i = aNumRequests; i-- > 0;)
+    {
+        if (i % 2)
+        {
+            ReceiveMessage(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, sent[i].mMessageId,
+                           sent[i].mToken, sent[i].mTokenLength, NULL, messageInfo);
+            VerifyOrQuit(responses[i] == 1, "piggybacked response was not matched");
+        }
+        else
+        {
+            ReceiveMessage(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, sent[i].mMessageId, NULL, 0, NULL,
+                           messageInfo);
+            VerifyOrQuit(responses[i] == 0, "empty acknowledgment completed the transaction");
+        }
+    }
+
+    VerifyOrQuit(counters.mPendingRequests == (aNumRequests + 1) / 2, "unexpected pending queue depth");
+
+    // Separate responses are matched by token.
+    for (uint16_t i = 0; i < aNumRequests; i += 2)
+    {
+        ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 0x8000 + i, sent[i].mToken,
+                       sent[i].mTokenLength, NULL, messageInfo);
+        VerifyOrQuit(responses[i] == 1, "separate response was not matched");
+        VerifyOrQuit(coap.GetLastSent().mType == OT_COAP_TYPE_ACKNOWLEDGMENT &&
+                         coap.GetLastSent().mMessageId == 0x8000 + i,
+                     "separate response was not acknowledged");
+    }
+
+    VerifyOrQuit(counters.mPendingRequests == 0, "pending queue is not empty");
+    VerifyOrQuit(coap.GetRequestMessages().GetHead() == NULL, "pending queue is not empty");
+
+    if (aNumRequests <= OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE)
+    {
+        VerifyOrQuit(counters.mRequestProbes == counters.mRequestLookups, "indexed lookup examined other requests");
+    }
+
+    printf("%u pending requests: %u requests examined for %u responses\n", aNumRequests, counters.mRequestProbes,
+           counters.mRequestLookups);
+
+    // A response without matching request is rejected with a reset.
+    ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 0x9000, sent[0].mToken,
+                   sent[0].mTokenLength, NULL, messageInfo);
+    VerifyOrQuit(coap.GetLastSent().mType == OT_COAP_TYPE_RESET, "unmatched response was not reset");
+
+    coap.ResetCounters();
+    VerifyOrQuit(counters.mRequestLookups == 0 && counters.mPendingRequestsPeak == 0, "ResetCounters() failed");
+
+    testFreeInstance(instance);
+}
+
+void TestRequestMatching(void)
+{
+    TestRequestMatching(OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE / 2);
+    TestRequestMatching(kNumRequests);
+}
+
+static void HandleCachedRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap &           coap     = *static_cast<TestCoap *>(aContext);
+    const Coap::Message &request  = *static_cast<const Coap::Message *>(aMessage);
+    Coap::Message *      response = coap.NewMessage();
+
+    VerifyOrQuit(response != NULL, "CoapBase::NewMessage() failed");
+    response->SetDefaultResponseHeader(request);
+    SuccessOrQuit(coap.SendMessage(*response, *static_cast<const Ip6::MessageInfo *>(aMessageInfo)),
+                  "SendMessage() failed");
+}
+
+static uint16_t CountMessages(const MessageQueue &aQueue)
+{
+    uint16_t messageCount;
+    uint16_t bufferCount;
+
+    aQueue.GetInfo(messageCount, bufferCount);
+
+    return messageCount;
+}
+
+void TestResponseCache(void)
+{
+    Instance *       instance = static_cast<Instance *>(testInitInstance());
+    TestCoap         coap(*instance);
+    Ip6::MessageInfo messageInfo;
+    Ip6::MessageInfo otherPeer;
+    otCoapResource   resource = {"c", HandleCachedRequest, &coap, NULL};
+    const uint8_t    token[]  = {0xde, 0xad, 0xbe, 0xef};
+    uint16_t         numSent;
+
+    InitPeer(messageInfo, kPeerPort);
+    InitPeer(otherPeer, kPeerPort + 1);
+
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resource)), "AddResource() failed");
+
+    for (uint16_t i = 0; i < kNumDuplicates + 2; i++)
+    {
+        numSent = coap.GetNumSent();
+        ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST, 100 + i, token, sizeof(token), "c",
+                       messageInfo);
+        VerifyOrQuit(coap.GetNumSent() == numSent + 1 && coap.GetLastSent().mMessageId == 100 + i,
+                     "request was not answered");
+    }
+
+    VerifyOrQuit(CountMessages(coap.GetCachedResponses()) == kNumDuplicates, "unexpected number of cached responses");
+
+    // Duplicates of the most recent requests are answered from the cache without calling the handler.
+    for (uint16_t i = 2; i < kNumDuplicates + 2; i++)
+    {
+        numSent = coap.GetNumSent();
+        ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST, 100 + i, token, sizeof(token), "c",
+                       messageInfo);
+        VerifyOrQuit(coap.GetNumSent() == numSent + 1, "cached response was not sent");
+        VerifyOrQuit(coap.GetLastSent().mMessageId == 100 + i && coap.GetLastSent().mCode == OT_COAP_CODE_CHANGED,
+                     "wrong cached response was sent");
+    }
+
+    VerifyOrQuit(CountMessages(coap.GetCachedResponses()) == kNumDuplicates, "duplicate was cached again");
+
+    // The same Message ID from another endpoint, or an evicted one, is handled as a new request.
+    ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST, 100 + kNumDuplicates + 1, token, sizeof(token),
+                   "c", otherPeer);
+    ReceiveMessage(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST, 100, token, sizeof(token), "c", messageInfo);
+    VerifyOrQuit(CountMessages(coap.GetCachedResponses()) == kNumDuplicates, "cache grew beyond its size");
+
+    VerifyOrQuit(coap.GetCounters().mResponseProbes <= coap.GetCounters().mResponseLookups + kNumDuplicates,
+                 "cached response lookup examined too many responses");
+
+    printf("%d cached responses: %u responses examined for %u lookups\n", kNumDuplicates,
+           coap.GetCounters().mResponseProbes, coap.GetCounters().mResponseLookups);
+
+    coap.ClearRequestsAndResponses();
+    VerifyOrQuit(coap.GetCachedResponses().GetHead() == NULL, "cached responses were not cleared");
+    coap.RemoveResource(static_cast<Coap::Resource &>(resource));
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+enum
+{
+    kBlockWiseLength = 1000,
+};
+
+struct BlockTransfer
+{
+    TestCoap *      mCoap;
+    const uint8_t * mData;
+    uint16_t        mLength;
+    uint8_t         mReceived[kBlockWiseLength];
+    uint16_t        mReceivedLength;
+    bool            mComplete;
+    uint16_t        mResponses;
+    otCoapCode      mResponseCode;
+    otError         mResult;
+};
+
+static void InitTransfer(BlockTransfer &aTransfer, TestCoap &aCoap, const uint8_t *aData, uint16_t aLength)
+{
+    memset(&aTransfer, 0, sizeof(aTransfer));
+    aTransfer.mCoap   = &aCoap;
+    aTransfer.mData   = aData;
+    aTransfer.mLength = aLength;
+}
+
+static otError TransmitBlock(void *aContext, uint8_t *aBlock, uint32_t aPosition, uint16_t *aBlockLength, bool *aMore)
+{
+    BlockTransfer &transfer = *static_cast<BlockTransfer *>(aContext);
+    uint16_t       length   = *aBlockLength;
+
+    VerifyOrQuit(aPosition <= transfer.mLength, "block requested beyond the end of the data");
+
+    if (length > transfer.mLength - aPosition)
+    {
+        length = static_cast<uint16_t>(transfer.mLength - aPosition);
+    }
+
+    memcpy(aBlock, transfer.mData + aPosition, length);
+    *aBlockLength = length;
+    *aMore        = aPosition + length < transfer.mLength;
+
+    return OT_ERROR_NONE;
+}
+
+static otError ReceiveBlock(void *         aContext,
+                            const uint8_t *aBlock,
+                            uint32_t       aPosition,
+                            uint16_t       aBlockLength,
+                            bool           aMore,
+                            uint32_t       aTotalLength)
+{
+    BlockTransfer &transfer = *static_cast<BlockTransfer *>(aContext);
+
+    OT_UNUSED_VARIABLE(aTotalLength);
+
+    VerifyOrQuit(aPosition == transfer.mReceivedLength, "blocks were received out of order");
+    VerifyOrQuit(aPosition + aBlockLength <= sizeof(transfer.mReceived), "received more data than expected");
+    VerifyOrQuit(!transfer.mComplete, "received data after the last block");
+
+    memcpy(transfer.mReceived + aPosition, aBlock, aBlockLength);
+    transfer.mReceivedLength += aBlockLength;
+    transfer.mComplete = !aMore;
+
+    return OT_ERROR_NONE;
+}
+
+static void HandleBlockWiseRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    BlockTransfer &      transfer = *static_cast<BlockTransfer *>(aContext);
+    const Coap::Message &request  = *static_cast<const Coap::Message *>(aMessage);
+    Coap::Message *      response = transfer.mCoap->NewMessage();
+
+    VerifyOrQuit(response != NULL, "CoapBase::NewMessage() failed");
+    response->SetDefaultResponseHeader(request);
+
+    if (request.GetCode() == OT_COAP_CODE_GET)
+    {
+        response->SetCode(OT_COAP_CODE_CONTENT);
+        SuccessOrQuit(transfer.mCoap->SendMessage(*response, *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                                  NULL, &transfer, TransmitBlock, NULL),
+                      "SendMessage() failed");
+    }
+    else
+    {
+        SuccessOrQuit(transfer.mCoap->SendMessage(*response, *static_cast<const Ip6::MessageInfo *>(aMessageInfo)),
+                      "SendMessage() failed");
+    }
+}
+
+static void HandleBlockWiseResponse(void *               aContext,
+                                    otMessage *          aMessage,
+                                    const otMessageInfo *aMessageInfo,
+                                    otError              aResult)
+{
+    BlockTransfer &transfer = *static_cast<BlockTransfer *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    transfer.mResult = aResult;
+
+    if (aResult == OT_ERROR_NONE)
+    {
+        transfer.mResponses++;
+        transfer.mResponseCode = static_cast<const Coap::Message *>(aMessage)->GetCode();
+    }
+}
+
+/**
+ * This function delivers the messages queued by two peers to each other until both are idle.
+ *
+ */
+static void Exchange(TestCoap &aClient, TestCoap &aServer)
+{
+    Ip6::MessageInfo clientInfo;
+    Ip6::MessageInfo serverInfo;
+    Ip6::Address     address;
+    Coap::Message *  message;
+    bool             idle = false;
+
+    // The peer of the client is the server, as set up by `InitPeer()`, and the other way round.
+    InitPeer(clientInfo, kPeerPort);
+    SuccessOrQuit(address.FromString("fd00:db8::2"), "Ip6::Address::FromString() failed");
+    serverInfo.SetPeerAddr(address);
+    SuccessOrQuit(address.FromString("fd00:db8::1"), "Ip6::Address::FromString() failed");
+    serverInfo.SetSockAddr(address);
+    serverInfo.SetPeerPort(kPeerPort);
+
+    while (!idle)
+    {
+        idle = true;
+
+        if ((message = aClient.DequeueSent()) != NULL)
+        {
+            aServer.Receive(*message, serverInfo);
+            message->Free();
+            idle = false;
+        }
+
+        if ((message = aServer.DequeueSent()) != NULL)
+        {
+            aClient.Receive(*message, clientInfo);
+            message->Free();
+            idle = false;
+        }
+    }
+}
+
+static Coap::Message *NewBlockWiseRequest(TestCoap &aCoap, Coap::Message::Code aCode, const char *aUriPath)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, aCode);
+    message->SetToken(kTokenLength);
+    SuccessOrQuit(message->AppendUriPathOptions(aUriPath), "Coap::Message::AppendUriPathOptions() failed");
+
+    return message;
+}
+
+void TestBlockWiseDownload(void)
+{
+    Instance *                instance = static_cast<Instance *>(testInitInstance());
+    TestCoap                  client(*instance);
+    TestCoap                  server(*instance);
+    Ip6::MessageInfo          messageInfo;
+    uint8_t                   data[kBlockWiseLength];
+    BlockTransfer             download;
+    BlockTransfer             content;
+    Coap::ResourceBlockWise   resource("b", HandleBlockWiseRequest, NULL, TransmitBlock, &content);
+    Coap::Message *           message;
+    const Coap::CoapCounters &counters = client.GetCounters();
+
+    for (uint16_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    InitPeer(messageInfo, kPeerPort);
+    InitTransfer(download, client, NULL, 0);
+    InitTransfer(content, server, data, sizeof(data));
+    client.SetQueueSent(true);
+    server.SetQueueSent(true);
+    SuccessOrQuit(server.AddBlockWiseResource(resource), "AddBlockWiseResource() failed");
+    VerifyOrQuit(server.AddBlockWiseResource(resource) == OT_ERROR_ALREADY,
+                 "AddBlockWiseResource() accepted a resource twice");
+
+    message = NewBlockWiseRequest(client, OT_COAP_CODE_GET, "b");
+    SuccessOrQuit(client.SendMessage(*message, messageInfo, HandleBlockWiseResponse, &download, NULL, ReceiveBlock),
+                  "SendMessage() failed");
+    Exchange(client, server);
+
+    VerifyOrQuit(download.mResponses == 1 && download.mResponseCode == OT_COAP_CODE_CONTENT,
+                 "response handler was not called once with the final block");
+    VerifyOrQuit(download.mComplete && download.mReceivedLength == sizeof(data), "download is incomplete");
+    VerifyOrQuit(memcmp(download.mReceived, data, sizeof(data)) == 0, "downloaded data does not match");
+    // The request for the next block is queued before the previous one is released.
+    VerifyOrQuit(counters.mPendingRequests == 0 && counters.mPendingRequestsPeak <= 2,
+                 "blocks were not requested one at a time");
+    VerifyOrQuit(client.GetMaxSentLength() <= OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE &&
+                     server.GetMaxSentLength() <= OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE,
+                 "block-wise message does not fit in a frame");
+
+    printf("Block2 download of %u bytes: %u requests, largest message %u bytes\n", download.mReceivedLength,
+           client.GetNumSent(), server.GetMaxSentLength());
+
+    server.RemoveBlockWiseResource(resource);
+    client.ClearRequestsAndResponses();
+    server.ClearRequestsAndResponses();
+
+    testFreeInstance(instance);
+}
+
+static void TestBlockWiseUpload(const char *aUriPath, uint16_t aBlockSize)
+{
+    Instance *              instance = static_cast<Instance *>(testInitInstance());
+    TestCoap                client(*instance);
+    TestCoap                server(*instance);
+    Ip6::MessageInfo        messageInfo;
+    uint8_t                 data[kBlockWiseLength - 300];
+    BlockTransfer           upload;
+    BlockTransfer           received;
+    Coap::ResourceBlockWise resource(aUriPath, HandleBlockWiseRequest, ReceiveBlock, NULL, &received);
+    Coap::Message *         message;
+
+    for (uint16_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    InitPeer(messageInfo, kPeerPort);
+    InitTransfer(upload, client, data, sizeof(data));
+    InitTransfer(received, server, NULL, 0);
+    client.SetQueueSent(true);
+    server.SetQueueSent(true);
+    SuccessOrQuit(server.AddBlockWiseResource(resource), "AddBlockWiseResource() failed");
+
+    message = NewBlockWiseRequest(client, OT_COAP_CODE_POST, aUriPath);
+    SuccessOrQuit(client.SendMessage(*message, messageInfo, HandleBlockWiseResponse, &upload, TransmitBlock, NULL),
+                  "SendMessage() failed");
+    Exchange(client, server);
+
+    VerifyOrQuit(upload.mResponses == 1 && upload.mResponseCode == OT_COAP_CODE_CHANGED,
+                 "response handler was not called once with the final response");
+    VerifyOrQuit(received.mComplete && received.mReceivedLength == sizeof(data), "upload is incomplete");
+    VerifyOrQuit(memcmp(received.mReceived, data, sizeof(data)) == 0, "uploaded data does not match");
+    VerifyOrQuit(client.GetNumSent() == (sizeof(data) + aBlockSize - 1) / aBlockSize, "unexpected block size");
+    VerifyOrQuit(client.GetMaxSentLength() <= OPENTHREAD_CONFIG_COAP_BLOCKWISE_FRAME_PAYLOAD_SIZE,
+                 "block-wise message does not fit in a frame");
+
+    printf("Block1 upload of %u bytes to \"%s\": %u requests, largest message %u bytes\n", received.mReceivedLength,
+           aUriPath, client.GetNumSent(), client.GetMaxSentLength());
+
+    server.RemoveBlockWiseResource(resource);
+    client.ClearRequestsAndResponses();
+    server.ClearRequestsAndResponses();
+
+    testFreeInstance(instance);
+}
+
+void TestBlockWiseUpload(void)
+{
+    TestBlockWiseUpload("u", 64);
+
+    // A longer header leaves less room in the frame, so smaller blocks are used.
+    TestBlockWiseUpload("a-rather-long-uri-path-segment", 32);
+}
+
+void TestBlockWiseNegotiation(void)
+{
+    Instance *       instance = static_cast<Instance *>(testInitInstance());
+    TestCoap         client(*instance);
+    Ip6::MessageInfo messageInfo;
+    uint8_t          data[200];
+    BlockTransfer    upload;
+    Coap::Message *  message;
+    Coap::Message *  sent;
+    uint32_t         blockNumber;
+    bool             more;
+    otCoapBlockSzx   size;
+
+    for (uint16_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    InitPeer(messageInfo, kPeerPort);
+    InitTransfer(upload, client, data, sizeof(data));
+    client.SetQueueSent(true);
+
+    message = NewBlockWiseRequest(client, OT_COAP_CODE_PUT, "n");
+    SuccessOrQuit(client.SendMessage(*message, messageInfo, HandleBlockWiseResponse, &upload, TransmitBlock, NULL),
+                  "SendMessage() failed");
+
+    sent = client.DequeueSent();
+    VerifyOrQuit(sent != NULL, "first block was not sent");
+    SuccessOrQuit(sent->ParseHeader(), "Coap::Message::ParseHeader() failed");
+    SuccessOrQuit(sent->ReadBlockOption(OT_COAP_OPTION_BLOCK1, blockNumber, more, size), "Block1 option is missing");
+    VerifyOrQuit(blockNumber == 0 && more && size == OT_COAP_OPTION_BLOCK_SZX_64, "unexpected first Block1 option");
+    VerifyOrQuit(sent->GetLength() - sent->GetOffset() == 64, "unexpected first block length");
+
+    // The server accepts the first block, but asks for 16-byte blocks from now on.
+    message = client.NewMessage();
+    VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+    message->Init(OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CONTINUE);
+    message->SetMessageId(sent->GetMessageId());
+    message->SetToken(sent->GetToken(), sent->GetTokenLength());
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0, true, OT_COAP_OPTION_BLOCK_SZX_16),
+                  "Coap::Message::AppendBlockOption() failed");
+    message->Finish();
+    sent->Free();
+
+    client.Receive(*message, messageInfo);
+    message->Free();
+
+    sent = client.DequeueSent();
+    VerifyOrQuit(sent != NULL, "second block was not sent");
+    SuccessOrQuit(sent->ParseHeader(), "Coap::Message::ParseHeader() failed");
+    SuccessOrQuit(sent->ReadBlockOption(OT_COAP_OPTION_BLOCK1, blockNumber, more, size), "Block1 option is missing");
+    VerifyOrQuit(blockNumber == 4 && more && size == OT_COAP_OPTION_BLOCK_SZX_16, "block size was not reduced");
+    VerifyOrQuit(sent->GetLength() - sent->GetOffset() == 16, "unexpected second block length");
+    VerifyOrQuit(Coap::Message::GetBlockSize(size) == 16, "Coap::Message::GetBlockSize() failed");
+    sent->Free();
+
+    // A response with a mismatching block number aborts the transfer.
+    message = client.NewMessage();
+    VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+    message->Init(OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CONTINUE);
+    message->SetMessageId(client.GetLastSent().mMessageId);
+    message->SetToken(client.GetLastSent().mToken, client.GetLastSent().mTokenLength);
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 7, true, OT_COAP_OPTION_BLOCK_SZX_16),
+                  "Coap::Message::AppendBlockOption() failed");
+    message->Finish();
+
+    client.Receive(*message, messageInfo);
+    message->Free();
+
+    VerifyOrQuit(upload.mResult == OT_ERROR_PARSE && client.GetCounters().mPendingRequests == 0,
+                 "transfer was not aborted on a mismatching block number");
+    VerifyOrQuit(client.DequeueSent() == NULL, "a block was sent after the transfer was aborted");
+
+    testFreeInstance(instance);
+}
+
+static void ReceiveBlock1(TestCoap &              aServer,
+                          uint16_t                aMessageId,
+                          uint8_t                 aToken,
+                          uint32_t                aBlockNumber,
+                          bool                    aMore,
+                          const uint8_t *         aData,
+                          const Ip6::MessageInfo &aMessageInfo)
+{
+    Coap::Message *message = aServer.NewMessage();
+
+    VerifyOrQuit(message != NULL, "CoapBase::NewMessage() failed");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    message->SetMessageId(aMessageId);
+    message->SetToken(&aToken, sizeof(aToken));
+    SuccessOrQuit(message->AppendUriPathOptions("i"), "Coap::Message::AppendUriPathOptions() failed");
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, aBlockNumber, aMore, OT_COAP_OPTION_BLOCK_SZX_16),
+                  "Coap::Message::AppendBlockOption() failed");
+    SuccessOrQuit(message->SetPayloadMarker(), "Coap::Message::SetPayloadMarker() failed");
+    SuccessOrQuit(message->Append(aData + aBlockNumber * 16, 16), "Message::Append() failed");
+    message->Finish();
+
+    aServer.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+void TestBlockWiseIncomplete(void)
+{
+    Instance *              instance = static_cast<Instance *>(testInitInstance());
+    TestCoap                server(*instance);
+    Ip6::MessageInfo        messageInfo;
+    Ip6::MessageInfo        otherPeerInfo;
+    uint8_t                 data[64];
+    BlockTransfer           received;
+    Coap::ResourceBlockWise resource("i", HandleBlockWiseRequest, ReceiveBlock, NULL, &received);
+    uint16_t                messageId = 0;
+
+    for (uint16_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 3);
+    }
+
+    InitPeer(messageInfo, kPeerPort);
+    InitPeer(otherPeerInfo, kPeerPort + 1);
+    InitTransfer(received, server, NULL, 0);
+    SuccessOrQuit(server.AddBlockWiseResource(resource), "AddBlockWiseResource() failed");
+
+    ReceiveBlock1(server, ++messageId, 1, 0, true, data, messageInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_CONTINUE, "first block was not accepted");
+
+    // A block continues the transfer of the same peer and token only.
+    ReceiveBlock1(server, ++messageId, 2, 1, true, data, messageInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_REQUEST_INCOMPLETE, "block with another token accepted");
+    ReceiveBlock1(server, ++messageId, 1, 1, true, data, otherPeerInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_REQUEST_INCOMPLETE, "block from another peer accepted");
+
+    ReceiveBlock1(server, ++messageId, 1, 1, true, data, messageInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_CONTINUE, "second block was not accepted");
+
+    // A missing block ends the transfer.
+    ReceiveBlock1(server, ++messageId, 1, 3, false, data, messageInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_REQUEST_INCOMPLETE, "block after a gap was accepted");
+    ReceiveBlock1(server, ++messageId, 1, 2, true, data, messageInfo);
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_REQUEST_INCOMPLETE, "aborted transfer was continued");
+    VerifyOrQuit(received.mReceivedLength == 32 && !received.mComplete, "rejected blocks were delivered");
+
+    // The transfer is restarted from the first block.
+    InitTransfer(received, server, NULL, 0);
+
+    for (uint32_t blockNumber = 0; blockNumber < sizeof(data) / 16; blockNumber++)
+    {
+        ReceiveBlock1(server, ++messageId, 1, blockNumber, blockNumber + 1 < sizeof(data) / 16, data, messageInfo);
+    }
+
+    VerifyOrQuit(server.GetLastSent().mCode == OT_COAP_CODE_CHANGED, "restarted transfer was not completed");
+    VerifyOrQuit(received.mComplete && received.mReceivedLength == sizeof(data), "restarted transfer is incomplete");
+    VerifyOrQuit(memcmp(received.mReceived, data, sizeof(data)) == 0, "received data does not match");
+
+    server.RemoveBlockWiseResource(resource);
+    server.ClearRequestsAndResponses();
+
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestResourceDispatch();
+    ot::TestRequestMatching();
+    ot::TestResponseCache();
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    ot::TestBlockWiseDownload();
+    ot::TestBlockWiseUpload();
+    ot::TestBlockWiseNegotiation();
+    ot::TestBlockWiseIncomplete();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
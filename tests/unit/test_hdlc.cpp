@@ -559,6 +559,292 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void GenerateSpecialRichFrame(uint8_t *aFrame, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        if (GetRandom(4) == 0)
+        {
+            aFrame[i] = sHdlcSpeicals[GetRandom(sizeof(sHdlcSpeicals))];
+        }
+        else
+        {
+            aFrame[i] = static_cast<uint8_t>(GetRandom(256));
+        }
+    }
+}
+
+void TestBlockEncoderMatchesByteEncoder(void)
+{
+    uint16_t                       length;
+    uint8_t                        frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> blockBuffer;
+    Hdlc::FrameBuffer<kBufferSize> byteBuffer;
+    Hdlc::Encoder                  blockEncoder(blockBuffer);
+    Hdlc::Encoder                  byteEncoder(byteBuffer);
+
+    printf("Testing Hdlc::Encoder block encoding against byte-by-byte encoding");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration / 10; iter++)
+    {
+        blockBuffer.Clear();
+        byteBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength + 1));
+        GenerateSpecialRichFrame(frame, length);
+
+        SuccessOrQuit(blockEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(blockEncoder.Encode(frame, length), "Encoder::Encode() failed");
+        SuccessOrQuit(blockEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        SuccessOrQuit(byteEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        VerifyOrQuit(blockBuffer.GetLength() == byteBuffer.GetLength(), "Encoded frame lengths do not match");
+        VerifyOrQuit(memcmp(blockBuffer.GetFrame(), byteBuffer.GetFrame(), blockBuffer.GetLength()) == 0,
+                     "Encoded frame contents do not match");
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncodeUpToPartialProgress(void)
+{
+    enum
+    {
+        kSmallBufferSize = 37,
+    };
+
+    uint16_t                            length = kMaxFrameLength;
+    uint16_t                            offset = 0;
+    uint8_t                             frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kSmallBufferSize> chunkBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      encodedBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      decoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize>      referenceBuffer;
+    DecoderContext                      decoderContext;
+    Hdlc::Encoder                       encoder(chunkBuffer);
+    Hdlc::Encoder                       referenceEncoder(referenceBuffer);
+    Hdlc::Decoder                       decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Encoder::EncodeUpTo() with a small output buffer");
+
+    GenerateSpecialRichFrame(frame, length);
+
+    SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+    while (offset < length)
+    {
+        uint16_t encoded = encoder.EncodeUpTo(&frame[offset], length - offset);
+
+        VerifyOrQuit(encoded <= length - offset, "EncodeUpTo() consumed more than given");
+        VerifyOrQuit(encoded > 0 || !chunkBuffer.IsEmpty(), "EncodeUpTo() made no progress on empty buffer");
+
+        offset += encoded;
+
+        if (offset < length)
+        {
+            VerifyOrQuit(!chunkBuffer.CanWrite(2), "EncodeUpTo() stopped early with room left in buffer");
+        }
+
+        for (uint16_t i = 0; i < chunkBuffer.GetLength(); i++)
+        {
+            SuccessOrQuit(encodedBuffer.WriteByte(chunkBuffer.GetFrame()[i]), "WriteByte() failed");
+        }
+
+        chunkBuffer.Clear();
+    }
+
+    while (encoder.EndFrame() != OT_ERROR_NONE)
+    {
+        VerifyOrQuit(!chunkBuffer.IsEmpty(), "EndFrame() failed on empty buffer");
+
+        for (uint16_t i = 0; i < chunkBuffer.GetLength(); i++)
+        {
+            SuccessOrQuit(encodedBuffer.WriteByte(chunkBuffer.GetFrame()[i]), "WriteByte() failed");
+        }
+
+        chunkBuffer.Clear();
+    }
+
+    for (uint16_t i = 0; i < chunkBuffer.GetLength(); i++)
+    {
+        SuccessOrQuit(encodedBuffer.WriteByte(chunkBuffer.GetFrame()[i]), "WriteByte() failed");
+    }
+
+    SuccessOrQuit(referenceEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+    SuccessOrQuit(referenceEncoder.Encode(frame, length), "Encoder::Encode() failed");
+    SuccessOrQuit(referenceEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+    VerifyOrQuit(encodedBuffer.GetLength() == referenceBuffer.GetLength(), "Encoded frame lengths do not match");
+    VerifyOrQuit(memcmp(encodedBuffer.GetFrame(), referenceBuffer.GetFrame(), encodedBuffer.GetLength()) == 0,
+                 "Encoded frame contents do not match");
+
+    decoderContext.mWasCalled = false;
+    decoder.Decode(encodedBuffer.GetFrame(), encodedBuffer.GetLength());
+    VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+    VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+    VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                 "Decoded frame content does not match original frame");
+
+    printf(" -- PASS\n");
+}
+
+void TestDecoderSplitInput(void)
+{
+    uint16_t                       length;
+    uint16_t                       offset;
+    uint8_t                        frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Decoder with input split at random points");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration / 10; iter++)
+    {
+        encoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        do
+        {
+            length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+        } while (length == 0);
+
+        GenerateSpecialRichFrame(frame, length);
+
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(encoder.Encode(frame, length), "Encoder::Encode() failed");
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        decoderContext.mWasCalled = false;
+        offset                    = 0;
+
+        while (offset < encoderBuffer.GetLength())
+        {
+            uint16_t chunk = static_cast<uint16_t>(GetRandom(16) + 1);
+
+            if (chunk > encoderBuffer.GetLength() - offset)
+            {
+                chunk = encoderBuffer.GetLength() - offset;
+            }
+
+            VerifyOrQuit(!decoderContext.mWasCalled, "Decoder reported a frame before its end");
+            decoder.Decode(encoderBuffer.GetFrame() + offset, chunk);
+            offset += chunk;
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncoderDecoderPerformance(void)
+{
+    enum
+    {
+        kLength     = 1280,
+        kIterations = 2000,
+    };
+
+    uint8_t                        frame[kLength];
+    Hdlc::FrameBuffer<kBufferSize> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  encoder(encoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    uint32_t                       start;
+    uint32_t                       byteEncodeDuration;
+    uint32_t                       blockEncodeDuration;
+    uint32_t                       byteDecodeDuration;
+    uint32_t                       blockDecodeDuration;
+
+    // Mostly plain payload with the occasional byte that needs escaping.
+    for (uint16_t i = 0; i < kLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>((GetRandom(64) == 0) ? static_cast<uint32_t>(kEscapeSequence)
+                                                             : 0x20 + GetRandom(0x5d));
+    }
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int iter = 0; iter < kIterations; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+        for (uint16_t i = 0; i < kLength; i++)
+        {
+            SuccessOrQuit(encoder.Encode(frame[i]), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+    }
+
+    byteEncodeDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int iter = 0; iter < kIterations; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(encoder.Encode(frame, kLength), "Encoder::Encode() failed");
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+    }
+
+    blockEncodeDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int iter = 0; iter < kIterations; iter++)
+    {
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+
+        for (uint16_t i = 0; i < encoderBuffer.GetLength(); i++)
+        {
+            decoder.Decode(encoderBuffer.GetFrame() + i, 1);
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE, "Decoder failed");
+    }
+
+    byteDecodeDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int iter = 0; iter < kIterations; iter++)
+    {
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled && decoderContext.mError == OT_ERROR_NONE, "Decoder failed");
+    }
+
+    blockDecodeDuration = otPlatAlarmMicroGetNow() - start;
+
+    printf("HDLC frame of %d bytes x %d: encode byte-at-a-time %lu usec, block %lu usec; "
+           "decode byte-at-a-time %lu usec, block %lu usec\n",
+           kLength, kIterations, static_cast<unsigned long>(byteEncodeDuration),
+           static_cast<unsigned long>(blockEncodeDuration), static_cast<unsigned long>(byteDecodeDuration),
+           static_cast<unsigned long>(blockDecodeDuration));
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -569,6 +855,10 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestBlockEncoderMatchesByteEncoder();
+    ot::Ncp::TestEncodeUpToPartialProgress();
+    ot::Ncp::TestDecoderSplitInput();
+    ot::Ncp::TestEncoderDecoderPerformance();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,241 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdarg.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_queue.hpp"
+
+namespace ot {
+
+enum
+{
+    kNumEntries  = OPENTHREAD_CONFIG_NUM_INDIRECT_QUEUE_ENTRIES, // Entries shared by all children.
+    kMaxChildren = OPENTHREAD_CONFIG_MAX_CHILDREN,
+};
+
+static Instance *sInstance;
+
+// Verifies that the queue for `aChild` contains the given list of messages (in order).
+static void VerifyQueueContent(IndirectQueue &aQueue, Child &aChild, int aExpectedLength, ...)
+{
+    va_list                 args;
+    IndirectQueue::Iterator iter(aQueue, aChild);
+
+    va_start(args, aExpectedLength);
+
+    VerifyOrQuit((aExpectedLength == 0) == (aQueue.GetHead(aChild) == NULL), "GetHead() is incorrect");
+
+    for (; !iter.IsDone(); iter++)
+    {
+        Message *message = va_arg(args, Message *);
+
+        VerifyOrQuit(aExpectedLength != 0, "Queue contains more entries than expected");
+        VerifyOrQuit(iter.GetMessage() == message, "Queue content does not match what is expected");
+        VerifyOrQuit(aQueue.Contains(aChild, *message), "Contains() failed");
+        aExpectedLength--;
+    }
+
+    VerifyOrQuit(aExpectedLength == 0, "Queue contains less entries than expected");
+
+    va_end(args);
+}
+
+void TestIndirectQueue(void)
+{
+    Message *msgLow;
+    Message *msgNormal1;
+    Message *msgNormal2;
+    Message *msgHigh;
+    Message *msgNet;
+    Message *message;
+    Message *firstMessage = NULL;
+    Message *lastMessage  = NULL;
+    otError  error        = OT_ERROR_NONE;
+    uint16_t numAdded     = 0;
+    uint16_t numMessages  = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    MessagePool & messagePool = sInstance->Get<MessagePool>();
+    IndirectQueue queue(*sInstance);
+    Child &       child0 = *sInstance->Get<ChildTable>().GetChildAtIndex(0);
+    Child &       child1 = *sInstance->Get<ChildTable>().GetChildAtIndex(kMaxChildren - 1);
+
+    printf("TestIndirectQueue");
+
+    msgLow     = messagePool.New(Message::kTypeIp6, 0, Message::kPriorityLow);
+    msgNormal1 = messagePool.New(Message::kTypeIp6, 0, Message::kPriorityNormal);
+    msgNormal2 = messagePool.New(Message::kTypeIp6, 0, Message::kPriorityNormal);
+    msgHigh    = messagePool.New(Message::kTypeIp6, 0, Message::kPriorityHigh);
+    msgNet     = messagePool.New(Message::kTypeIp6, 0, Message::kPriorityNet);
+    VerifyOrQuit(msgLow && msgNormal1 && msgNormal2 && msgHigh && msgNet, "Message::New() failed");
+
+    VerifyQueueContent(queue, child0, 0);
+    VerifyQueueContent(queue, child1, 0);
+
+    // Messages are ordered by priority, and first-in first-out within the same priority.
+
+    SuccessOrQuit(queue.Add(child0, *msgNormal1), "Add() failed");
+    SuccessOrQuit(queue.Add(child0, *msgLow), "Add() failed");
+    SuccessOrQuit(queue.Add(child0, *msgHigh), "Add() failed");
+    SuccessOrQuit(queue.Add(child0, *msgNormal2), "Add() failed");
+    SuccessOrQuit(queue.Add(child0, *msgNet), "Add() failed");
+    VerifyQueueContent(queue, child0, 5, msgNet, msgHigh, msgNormal1, msgNormal2, msgLow);
+    VerifyQueueContent(queue, child1, 0);
+
+    VerifyOrQuit(queue.Add(child0, *msgHigh) == OT_ERROR_ALREADY, "Add() did not fail for a queued message");
+
+    // A message shared by two children tracks the pending count.
+
+    SuccessOrQuit(queue.Add(child1, *msgNormal2), "Add() failed");
+    VerifyQueueContent(queue, child1, 1, msgNormal2);
+    VerifyOrQuit(msgNormal2->IsChildPending(), "IsChildPending() failed");
+
+    SuccessOrQuit(queue.Remove(child0, *msgNormal2), "Remove() failed");
+    VerifyOrQuit(msgNormal2->IsChildPending(), "IsChildPending() failed");
+    VerifyOrQuit(queue.Remove(child0, *msgNormal2) == OT_ERROR_NOT_FOUND, "Remove() did not fail");
+    SuccessOrQuit(queue.Remove(child1, *msgNormal2), "Remove() failed");
+    VerifyOrQuit(!msgNormal2->IsChildPending(), "IsChildPending() failed");
+    VerifyQueueContent(queue, child0, 4, msgNet, msgHigh, msgNormal1, msgLow);
+    VerifyQueueContent(queue, child1, 0);
+
+    // Remove head, tail and middle entries, and add again at the tail.
+
+    SuccessOrQuit(queue.Remove(child0, *msgNet), "Remove() failed");
+    SuccessOrQuit(queue.Remove(child0, *msgLow), "Remove() failed");
+    VerifyQueueContent(queue, child0, 2, msgHigh, msgNormal1);
+    SuccessOrQuit(queue.Add(child0, *msgLow), "Add() failed");
+    SuccessOrQuit(queue.Remove(child0, *msgNormal1), "Remove() failed");
+    VerifyQueueContent(queue, child0, 2, msgHigh, msgLow);
+
+    // Remove all entries while iterating.
+
+    for (IndirectQueue::Iterator iter(queue, child0); !iter.IsDone(); iter++)
+    {
+        SuccessOrQuit(queue.Remove(child0, *iter.GetMessage()), "Remove() failed");
+    }
+
+    VerifyQueueContent(queue, child0, 0);
+    VerifyOrQuit(!msgHigh->IsChildPending() && !msgLow->IsChildPending(), "IsChildPending() failed");
+
+    // Use up all entries that are not reserved, by adding messages to every child except `child1`.
+
+    while (error == OT_ERROR_NONE)
+    {
+        message = messagePool.New(Message::kTypeIp6, 0);
+
+        VerifyOrQuit(message != NULL, "Message::New() failed");
+        numMessages++;
+        lastMessage = message;
+
+        if (firstMessage == NULL)
+        {
+            firstMessage = message;
+        }
+
+        for (uint8_t i = 0; (i < kMaxChildren - 1) && (error == OT_ERROR_NONE); i++)
+        {
+            error = queue.Add(*sInstance->Get<ChildTable>().GetChildAtIndex(i), *message);
+
+            if (error == OT_ERROR_NONE)
+            {
+                numAdded++;
+            }
+        }
+    }
+
+    // Each message had one entry reserved on top of the shared entries.
+    VerifyOrQuit(error == OT_ERROR_NO_BUFS, "Add() did not fail with NO_BUFS when out of entries");
+    VerifyOrQuit(numAdded == kNumEntries + kMaxChildren - 1 + numMessages, "Number of added entries is incorrect");
+    VerifyOrQuit(queue.GetChild(*lastMessage) != NULL, "GetChild() failed");
+
+    // A child with an empty queue still gets its reserved entry, but only one.
+
+    SuccessOrQuit(queue.Add(child1, *lastMessage), "Add() failed for a child with an empty queue");
+    VerifyOrQuit(queue.Add(child1, *firstMessage) == OT_ERROR_NO_BUFS, "Add() did not fail when out of entries");
+    VerifyQueueContent(queue, child1, 1, lastMessage);
+
+    // A message not queued for any child (unicast) still gets its reserved entry, but only one.
+
+    SuccessOrQuit(queue.Add(child0, *msgNet), "Add() failed for a message not queued");
+    VerifyOrQuit(queue.Add(*sInstance->Get<ChildTable>().GetChildAtIndex(1), *msgNet) == OT_ERROR_NO_BUFS,
+                 "Add() did not fail when out of entries");
+
+    // Removing the only message of a child gives its reserved entry back.
+
+    SuccessOrQuit(queue.Remove(child1, *lastMessage), "Remove() failed");
+    VerifyOrQuit(queue.Add(*sInstance->Get<ChildTable>().GetChildAtIndex(1), *msgNet) == OT_ERROR_NO_BUFS,
+                 "Add() used a reserved entry");
+    SuccessOrQuit(queue.Add(child1, *msgNet), "Add() failed for a child with an empty queue");
+    VerifyOrQuit(queue.GetChild(*msgNet) == &child1, "GetChild() did not return the last child queued");
+
+    // Removing a message from all its children only visits the children it is queued for.
+
+    while (firstMessage->IsChildPending())
+    {
+        SuccessOrQuit(queue.Remove(*queue.GetChild(*firstMessage), *firstMessage), "Remove() failed");
+    }
+
+    VerifyOrQuit(queue.GetChild(*firstMessage) == NULL, "GetChild() returned a child for a message not queued");
+
+    // Every message buffer can be queued as a unicast message, however the shared entries are used.
+
+    while ((message = messagePool.New(Message::kTypeIp6, 0)) != NULL)
+    {
+        SuccessOrQuit(queue.Add(child1, *message), "Add() failed for a unicast message");
+    }
+
+    queue.Clear();
+    VerifyQueueContent(queue, child0, 0);
+    VerifyQueueContent(queue, child1, 0);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestIndirectQueue();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,409 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sys/time.h>
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "crypto/hmac_sha256.hpp"
+#include "thread/key_manager.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kHeaderLength  = 15,
+    kPayloadLength = 100,
+    kFrameLength   = kHeaderLength + kPayloadLength,
+    kTagLength     = 4,
+    kNumFrames     = 30000,
+
+    kMleHeaderLength  = 37, ///< IPv6 source and destination addresses, and the auxiliary security header
+    kMleMessageLength = 64,
+    kNumMleMessages   = 30000,
+    kNumKeys          = 30000,
+};
+
+static const uint8_t kThreadString[] = {
+    'T', 'h', 'r', 'e', 'a', 'd',
+};
+
+static uint64_t GetNowUsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
+static void SecureFrame(Crypto::AesCcm &aAesCcm, uint8_t *aFrame, uint8_t *aTag)
+{
+    static const uint8_t kNonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+    };
+
+    uint8_t tagLength = kTagLength;
+
+    SuccessOrQuit(aAesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce)), "AesCcm::Init()");
+    aAesCcm.Header(aFrame, kHeaderLength);
+    aAesCcm.Payload(aFrame + kHeaderLength, aFrame + kHeaderLength, kPayloadLength, true);
+    aAesCcm.Finalize(aTag, &tagLength);
+}
+
+/**
+ * This function secures a frame the way `Mac::ProcessReceiveSecurity()` did before the key schedules were cached: the
+ * key of a previous or next key sequence is derived, and the key is expanded, for every frame.
+ *
+ */
+static void SecureFrameWithKey(KeyManager &aKeyManager, uint32_t aKeySequence, uint8_t *aFrame, uint8_t *aTag)
+{
+    Crypto::AesCcm aesCcm;
+
+    if (aKeySequence == aKeyManager.GetCurrentKeySequence())
+    {
+        aesCcm.SetKey(aKeyManager.GetCurrentMacKey(), 16);
+    }
+    else
+    {
+        aesCcm.SetKey(aKeyManager.GetTemporaryMacKey(aKeySequence), 16);
+    }
+
+    SecureFrame(aesCcm, aFrame, aTag);
+}
+
+static void SecureFrameWithKeySchedule(KeyManager &aKeyManager, uint32_t aKeySequence, uint8_t *aFrame, uint8_t *aTag)
+{
+    Crypto::AesCcm aesCcm;
+
+    aesCcm.SetKey(aKeyManager.GetMacKeySchedule(aKeySequence));
+    SecureFrame(aesCcm, aFrame, aTag);
+}
+
+static void VerifyKeySchedules(KeyManager &aKeyManager)
+{
+    const uint32_t current        = aKeyManager.GetCurrentKeySequence();
+    const uint32_t keySequences[] = {current - 1, current, current + 1, current + 5, current};
+
+    for (size_t i = 0; i < sizeof(keySequences) / sizeof(keySequences[0]); i++)
+    {
+        uint8_t frame[kFrameLength];
+        uint8_t expectedFrame[kFrameLength];
+        uint8_t tag[kTagLength];
+        uint8_t expectedTag[kTagLength];
+
+        for (size_t j = 0; j < sizeof(frame); j++)
+        {
+            frame[j] = expectedFrame[j] = static_cast<uint8_t>(j);
+        }
+
+        SecureFrameWithKey(aKeyManager, keySequences[i], expectedFrame, expectedTag);
+        SecureFrameWithKeySchedule(aKeyManager, keySequences[i], frame, tag);
+
+        VerifyOrQuit(memcmp(frame, expectedFrame, sizeof(frame)) == 0, "MAC key schedule does not match the key\n");
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0, "MAC key schedule does not match the key\n");
+
+        {
+            Crypto::AesEcb ecb;
+            uint8_t        block[Crypto::AesEcb::kBlockSize];
+            uint8_t        expectedBlock[Crypto::AesEcb::kBlockSize];
+
+            memset(block, 0x5a, sizeof(block));
+            memset(expectedBlock, 0x5a, sizeof(expectedBlock));
+
+            aKeyManager.GetMleKeySchedule(keySequences[i]).Encrypt(block, block);
+            ecb.SetKey((keySequences[i] == current) ? aKeyManager.GetCurrentMleKey()
+                                                    : aKeyManager.GetTemporaryMleKey(keySequences[i]),
+                       128);
+            ecb.Encrypt(expectedBlock, expectedBlock);
+
+            VerifyOrQuit(memcmp(block, expectedBlock, sizeof(block)) == 0, "MLE key schedule does not match the key\n");
+        }
+    }
+}
+
+void TestKeySchedules(void)
+{
+    static const otMasterKey kMasterKey = {{
+        0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f,
+    }};
+
+    Instance *  instance = static_cast<Instance *>(testInitInstance());
+    KeyManager &keyManager = instance->Get<KeyManager>();
+
+    // key sequence 0, the previous key sequence wraps around
+    VerifyKeySchedules(keyManager);
+
+    // key rotation
+    keyManager.SetCurrentKeySequence(1);
+    VerifyKeySchedules(keyManager);
+
+    keyManager.SetCurrentKeySequence(0x12345678);
+    VerifyKeySchedules(keyManager);
+
+    // master key change
+    SuccessOrQuit(keyManager.SetMasterKey(kMasterKey), "SetMasterKey() failed\n");
+    VerifyOrQuit(keyManager.GetCurrentKeySequence() == 0, "SetMasterKey() did not reset the key sequence\n");
+    VerifyKeySchedules(keyManager);
+
+    testFreeInstance(instance);
+}
+
+void TestKeyScheduleBenchmark(void)
+{
+    Instance *  instance   = static_cast<Instance *>(testInitInstance());
+    KeyManager &keyManager = instance->Get<KeyManager>();
+    uint8_t     frame[kFrameLength];
+    uint8_t     tag[kTagLength];
+    uint64_t    start;
+    uint64_t    keyElapsed;
+    uint64_t    keyScheduleElapsed;
+
+    keyManager.SetCurrentKeySequence(100);
+    memset(frame, 0, sizeof(frame));
+
+    // frames using the previous, current and next key sequences, as received around a key rotation
+    start = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        SecureFrameWithKey(keyManager, 99 + (i % 3), frame, tag);
+    }
+
+    keyElapsed = GetNowUsec() - start;
+    start      = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        SecureFrameWithKeySchedule(keyManager, 99 + (i % 3), frame, tag);
+    }
+
+    keyScheduleElapsed = GetNowUsec() - start;
+
+    printf("%d frames of %d bytes across key sequences %u..%u\n", kNumFrames, kFrameLength, 99, 101);
+    printf("  key fetched and expanded per frame : %8llu frames/s\n",
+           static_cast<unsigned long long>(kNumFrames * 1000000ULL / (keyElapsed ? keyElapsed : 1)));
+    printf("  cached key schedule                : %8llu frames/s\n",
+           static_cast<unsigned long long>(kNumFrames * 1000000ULL / (keyScheduleElapsed ? keyScheduleElapsed : 1)));
+
+    testFreeInstance(instance);
+}
+
+/**
+ * This function derives a key the way `KeyManager` did before the HMAC states were precomputed: the whole
+ * HMAC-SHA256 is computed from the master key.
+ *
+ */
+static void ComputeKeyWithHmac(const otMasterKey &aMasterKey, uint32_t aKeySequence, uint8_t *aKey)
+{
+    Crypto::HmacSha256 hmac;
+    uint8_t            keySequenceBytes[4];
+
+    hmac.Start(aMasterKey.m8, sizeof(aMasterKey.m8));
+
+    keySequenceBytes[0] = (aKeySequence >> 24) & 0xff;
+    keySequenceBytes[1] = (aKeySequence >> 16) & 0xff;
+    keySequenceBytes[2] = (aKeySequence >> 8) & 0xff;
+    keySequenceBytes[3] = aKeySequence & 0xff;
+    hmac.Update(keySequenceBytes, sizeof(keySequenceBytes));
+    hmac.Update(kThreadString, sizeof(kThreadString));
+
+    hmac.Finish(aKey);
+}
+
+static void VerifyDerivedKeys(KeyManager &aKeyManager)
+{
+    for (uint32_t i = 0; i < 40; i++)
+    {
+        // revisits some key sequences so derived keys are both found in and evicted from the cache
+        uint32_t keySequence = (i * 7) % 11 + ((i & 1) ? 0xfffffff0 : 0);
+        uint8_t  expectedKey[Crypto::HmacSha256::kHashSize];
+
+        ComputeKeyWithHmac(aKeyManager.GetMasterKey(), keySequence, expectedKey);
+
+        VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMleKey(keySequence), expectedKey, 16) == 0,
+                     "derived MLE key does not match HMAC-SHA256\n");
+        VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMacKey(keySequence), expectedKey + 16, 16) == 0,
+                     "derived MAC key does not match HMAC-SHA256\n");
+    }
+
+    {
+        uint8_t expectedKey[Crypto::HmacSha256::kHashSize];
+
+        ComputeKeyWithHmac(aKeyManager.GetMasterKey(), aKeyManager.GetCurrentKeySequence(), expectedKey);
+
+        VerifyOrQuit(memcmp(aKeyManager.GetCurrentMleKey(), expectedKey, 16) == 0,
+                     "current MLE key does not match HMAC-SHA256\n");
+        VerifyOrQuit(memcmp(aKeyManager.GetCurrentMacKey(), expectedKey + 16, 16) == 0,
+                     "current MAC key does not match HMAC-SHA256\n");
+    }
+}
+
+void TestKeyDerivation(void)
+{
+    static const otMasterKey kMasterKey = {{
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+    }};
+
+    Instance *  instance   = static_cast<Instance *>(testInitInstance());
+    KeyManager &keyManager = instance->Get<KeyManager>();
+
+    VerifyDerivedKeys(keyManager);
+
+    keyManager.SetCurrentKeySequence(7);
+    VerifyDerivedKeys(keyManager);
+
+    // the keys derived from the previous master key must not be used anymore
+    SuccessOrQuit(keyManager.SetMasterKey(kMasterKey), "SetMasterKey() failed\n");
+    VerifyDerivedKeys(keyManager);
+
+    testFreeInstance(instance);
+}
+
+static void SecureMleMessage(Crypto::AesCcm &aAesCcm, uint8_t *aMessage, uint8_t *aTag)
+{
+    static const uint8_t kNonce[] = {
+        0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x00, 0x00, 0x00, 0x01, 0x05,
+    };
+
+    uint8_t tagLength = kTagLength;
+
+    SuccessOrQuit(aAesCcm.Init(kMleHeaderLength, kMleMessageLength, kTagLength, kNonce, sizeof(kNonce)),
+                  "AesCcm::Init()");
+    aAesCcm.Header(aMessage, kMleHeaderLength);
+    aAesCcm.Payload(aMessage + kMleHeaderLength, aMessage + kMleHeaderLength, kMleMessageLength, false);
+    aAesCcm.Finalize(aTag, &tagLength);
+}
+
+void TestKeyDerivationBenchmark(void)
+{
+    // key sequences of received MLE messages relative to the current one: mostly the current one, some from neighbors
+    // around a key rotation, and some from neighbors with other key sequences (e.g. from another partition)
+    static const int32_t kKeySequenceOffsets[] = {0, 0, -1, 0, 1, 0, 5, 0, 0, -1, 0, 9, 0, 1, -3, 0};
+    static const uint32_t kNumOffsets           = sizeof(kKeySequenceOffsets) / sizeof(kKeySequenceOffsets[0]);
+
+    Instance *  instance   = static_cast<Instance *>(testInitInstance());
+    KeyManager &keyManager = instance->Get<KeyManager>();
+    uint8_t     message[kMleHeaderLength + kMleMessageLength];
+    uint8_t     key[Crypto::HmacSha256::kHashSize];
+    uint8_t     tag[kTagLength];
+    uint64_t    start;
+    uint64_t    hmacElapsed;
+    uint64_t    elapsed;
+
+    keyManager.SetCurrentKeySequence(1000);
+    memset(message, 0, sizeof(message));
+
+    // key derivation of key sequences that are not cached
+    start = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumKeys; i++)
+    {
+        ComputeKeyWithHmac(keyManager.GetMasterKey(), 2000 + i, key);
+    }
+
+    hmacElapsed = GetNowUsec() - start;
+    start       = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumKeys; i++)
+    {
+        memcpy(key, keyManager.GetTemporaryMleKey(2000 + i), 16);
+    }
+
+    elapsed = GetNowUsec() - start;
+
+    printf("%d keys derived for new key sequences\n", kNumKeys);
+    printf("  HMAC-SHA256 from the master key    : %8llu keys/s\n",
+           static_cast<unsigned long long>(kNumKeys * 1000000ULL / (hmacElapsed ? hmacElapsed : 1)));
+    printf("  precomputed HMAC pad states        : %8llu keys/s\n",
+           static_cast<unsigned long long>(kNumKeys * 1000000ULL / (elapsed ? elapsed : 1)));
+
+    // MLE receive: the key of each message is derived (unless current) and expanded, then the message is verified
+    start = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumMleMessages; i++)
+    {
+        Crypto::AesCcm aesCcm;
+        uint32_t       keySequence = keyManager.GetCurrentKeySequence() + kKeySequenceOffsets[i % kNumOffsets];
+
+        if (keySequence == keyManager.GetCurrentKeySequence())
+        {
+            aesCcm.SetKey(keyManager.GetCurrentMleKey(), 16);
+        }
+        else
+        {
+            ComputeKeyWithHmac(keyManager.GetMasterKey(), keySequence, key);
+            aesCcm.SetKey(key, 16);
+        }
+
+        SecureMleMessage(aesCcm, message, tag);
+    }
+
+    hmacElapsed = GetNowUsec() - start;
+    start       = GetNowUsec();
+
+    for (uint32_t i = 0; i < kNumMleMessages; i++)
+    {
+        Crypto::AesCcm aesCcm;
+        uint32_t       keySequence = keyManager.GetCurrentKeySequence() + kKeySequenceOffsets[i % kNumOffsets];
+
+        aesCcm.SetKey(keyManager.GetMleKeySchedule(keySequence));
+        SecureMleMessage(aesCcm, message, tag);
+    }
+
+    elapsed = GetNowUsec() - start;
+
+    printf("%d MLE messages of %d bytes received with mixed key sequences\n", kNumMleMessages, kMleMessageLength);
+    printf("  key derived and expanded per message : %8llu messages/s\n",
+           static_cast<unsigned long long>(kNumMleMessages * 1000000ULL / (hmacElapsed ? hmacElapsed : 1)));
+    printf("  cached keys and key schedules        : %8llu messages/s\n",
+           static_cast<unsigned long long>(kNumMleMessages * 1000000ULL / (elapsed ? elapsed : 1)));
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestKeySchedules();
+    ot::TestKeyScheduleBenchmark();
+    ot::TestKeyDerivation();
+    ot::TestKeyDerivationBenchmark();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -63,10 +63,315 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChunks(void)
+{
+    ot::Instance *             instance;
+    ot::MessagePool *          messagePool;
+    ot::Message *              message;
+    ot::Message::Chunk         chunk;
+    ot::Message::WritableChunk writableChunk;
+    uint8_t                    writeBuffer[600];
+    uint8_t                    readBuffer[600];
+    uint16_t                   length;
+    uint16_t                   numBytes;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 3)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer), "Message::Write failed\n");
+
+    for (uint16_t offset = 0; offset <= sizeof(writeBuffer); offset += 7)
+    {
+        for (uint16_t rangeLength = 0; rangeLength <= sizeof(writeBuffer) + 10; rangeLength += 23)
+        {
+            uint16_t expectedLength = sizeof(writeBuffer) - offset;
+
+            if (rangeLength < expectedLength)
+            {
+                expectedLength = rangeLength;
+            }
+
+            numBytes = 0;
+            length   = rangeLength;
+
+            for (message->GetFirstChunk(offset, length, chunk); chunk.GetLength() > 0;
+                 message->GetNextChunk(length, chunk))
+            {
+                VerifyOrQuit(numBytes + chunk.GetLength() <= expectedLength, "Chunks exceed the range\n");
+                VerifyOrQuit(memcmp(chunk.GetData(), writeBuffer + offset + numBytes, chunk.GetLength()) == 0,
+                             "Chunk content is incorrect\n");
+                numBytes += chunk.GetLength();
+            }
+
+            VerifyOrQuit(numBytes == expectedLength, "Chunks do not cover the range\n");
+            VerifyOrQuit(length == 0, "Remaining length is not zero after the last chunk\n");
+        }
+    }
+
+    // Modify the content in place through writable chunks.
+
+    length = sizeof(writeBuffer) - 5;
+
+    for (message->GetFirstChunk(5, length, writableChunk); writableChunk.GetLength() > 0;
+         message->GetNextChunk(length, writableChunk))
+    {
+        for (uint16_t i = 0; i < writableChunk.GetLength(); i++)
+        {
+            writableChunk.GetData()[i] ^= 0xff;
+        }
+    }
+
+    for (unsigned i = 5; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] ^= 0xff;
+    }
+
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Writable chunk update failed\n");
+
+    // Copy within the same message, moving content towards the front.
+
+    VerifyOrQuit(message->CopyTo(8, 0, sizeof(writeBuffer) - 8, *message) == sizeof(writeBuffer) - 8,
+                 "Message::CopyTo failed\n");
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer + 8, readBuffer, sizeof(writeBuffer) - 8) == 0, "Message::CopyTo failed\n");
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+// Byte-at-a-time checksum, used as the reference for `Message::UpdateChecksum()`.
+static uint16_t ReferenceChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aChecksum = ot::Message::UpdateChecksum(aChecksum, (i & 1) ? aBuf[i] : static_cast<uint16_t>(aBuf[i] << 8));
+    }
+
+    return aChecksum;
+}
+
+void TestMessageChecksum(void)
+{
+    const uint16_t kInitialChecksums[] = {0x0000, 0x0001, 0x7fff, 0x8000, 0xfffe, 0xffff};
+
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          buffer[1300];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Flat buffers, covering all alignments and tail lengths.
+
+    for (unsigned c = 0; c < OT_ARRAY_LENGTH(kInitialChecksums); c++)
+    {
+        for (uint16_t start = 0; start < 8; start++)
+        {
+            for (uint16_t length = 0; length + start <= sizeof(buffer); length += (length < 80) ? 1 : 37)
+            {
+                VerifyOrQuit(ot::Message::UpdateChecksum(kInitialChecksums[c], buffer + start, length) ==
+                                 ReferenceChecksum(kInitialChecksums[c], buffer + start, length),
+                             "UpdateChecksum() does not match the reference\n");
+            }
+        }
+    }
+
+    {
+        uint8_t zeros[64];
+        uint8_t ones[64];
+
+        memset(zeros, 0x00, sizeof(zeros));
+        memset(ones, 0xff, sizeof(ones));
+
+        for (uint16_t length = 0; length <= sizeof(zeros); length++)
+        {
+            for (unsigned c = 0; c < OT_ARRAY_LENGTH(kInitialChecksums); c++)
+            {
+                VerifyOrQuit(ot::Message::UpdateChecksum(kInitialChecksums[c], zeros, length) ==
+                                 ReferenceChecksum(kInitialChecksums[c], zeros, length),
+                             "UpdateChecksum() does not match the reference for zeros\n");
+                VerifyOrQuit(ot::Message::UpdateChecksum(kInitialChecksums[c], ones, length) ==
+                                 ReferenceChecksum(kInitialChecksums[c], ones, length),
+                             "UpdateChecksum() does not match the reference for ones\n");
+            }
+        }
+    }
+
+    // Messages spanning several buffers, with odd offsets so segments start at odd positions.
+
+    for (uint16_t reserved = 0; reserved < 3; reserved++)
+    {
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, reserved)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(sizeof(buffer)), "Message::SetLength failed\n");
+        VerifyOrQuit(message->Write(0, sizeof(buffer), buffer) == sizeof(buffer), "Message::Write failed\n");
+
+        for (uint16_t offset = 0; offset < 300; offset += (offset < 20) ? 1 : 13)
+        {
+            for (uint16_t length = 0; length + offset <= sizeof(buffer); length += (length < 20) ? 1 : 41)
+            {
+                VerifyOrQuit(message->UpdateChecksum(0x1234, offset, length) ==
+                                 ReferenceChecksum(0x1234, buffer + offset, length),
+                             "Message::UpdateChecksum() does not match the reference\n");
+            }
+        }
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+void TestMessageChecksumPerformance(void)
+{
+    enum
+    {
+        kLength     = 1280,
+        kIterations = 20000,
+    };
+
+    uint8_t           buffer[kLength];
+    uint32_t          start;
+    uint32_t          referenceDuration;
+    uint32_t          duration;
+    volatile uint16_t checksum = 0;
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kIterations; i++)
+    {
+        checksum = ReferenceChecksum(checksum, buffer, kLength);
+    }
+
+    referenceDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kIterations; i++)
+    {
+        checksum = ot::Message::UpdateChecksum(checksum, buffer, kLength);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+
+    printf("Checksum of %d bytes x %d: byte-at-a-time %lu usec, UpdateChecksum() %lu usec\n", kLength, kIterations,
+           static_cast<unsigned long>(referenceDuration), static_cast<unsigned long>(duration));
+}
+
+void TestMessagePoolStats(void)
+{
+    enum
+    {
+        kNumBuffers        = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+        kNumReservedNet    = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NET,
+        kNumReservedHigh   = kNumReservedNet + OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH,
+        kNumReservedNormal = kNumReservedHigh + OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_NORMAL,
+    };
+
+    // Priority levels in increasing order, with the number of buffers reserved for the levels above each.
+    static const struct
+    {
+        uint8_t  mPriority;
+        uint16_t mNumReservedAbove;
+    } kPriorities[] = {
+        {ot::Message::kPriorityLow, kNumReservedNormal},
+        {ot::Message::kPriorityNormal, kNumReservedHigh},
+        {ot::Message::kPriorityHigh, kNumReservedNet},
+        {ot::Message::kPriorityNet, 0},
+    };
+
+    ot::Instance *     instance;
+    ot::MessagePool *  messagePool;
+    ot::Message *      messages[kNumBuffers + 1];
+    uint16_t           numMessages         = 0;
+    uint32_t           numReservedFailures = 0;
+    otMessagePoolStats stats;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mTotalBuffers == kNumBuffers, "GetStats() total buffers is incorrect\n");
+    VerifyOrQuit(stats.mUsedBuffers == 0, "GetStats() used buffers is incorrect\n");
+
+    // Each priority level can only allocate the buffers not reserved for higher priority levels.
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kPriorities); i++)
+    {
+        while ((messages[numMessages] = messagePool->New(ot::Message::kTypeIp6, 0, kPriorities[i].mPriority)) != NULL)
+        {
+            numMessages++;
+        }
+
+        VerifyOrQuit(numMessages == kNumBuffers - kPriorities[i].mNumReservedAbove,
+                     "Allocations did not stop at the buffers reserved for higher priorities\n");
+        VerifyOrQuit(messagePool->GetFreeBufferCount() == kPriorities[i].mNumReservedAbove,
+                     "GetFreeBufferCount() is incorrect\n");
+
+        if (kPriorities[i].mNumReservedAbove > 0)
+        {
+            numReservedFailures++;
+        }
+    }
+
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mTotalBuffers == kNumBuffers, "GetStats() total buffers is incorrect\n");
+    VerifyOrQuit(stats.mUsedBuffers == kNumBuffers, "GetStats() used buffers is incorrect\n");
+    VerifyOrQuit(stats.mMaxUsedBuffers == kNumBuffers, "GetStats() max used buffers is incorrect\n");
+    VerifyOrQuit(stats.mAllocFailures == OT_ARRAY_LENGTH(kPriorities), "GetStats() alloc failures is incorrect\n");
+    VerifyOrQuit(stats.mReservedAllocFailures == numReservedFailures,
+                 "GetStats() reserved alloc failures is incorrect\n");
+
+    for (uint16_t i = 0; i < numMessages; i++)
+    {
+        messages[i]->Free();
+    }
+
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mUsedBuffers == 0, "GetStats() used buffers is incorrect after free\n");
+    VerifyOrQuit(stats.mMaxUsedBuffers == kNumBuffers, "GetStats() max used buffers is incorrect after free\n");
+
+    messagePool->ResetStats();
+    messagePool->GetStats(stats);
+    VerifyOrQuit(stats.mMaxUsedBuffers == 0, "ResetStats() did not reset max used buffers\n");
+    VerifyOrQuit(stats.mAllocFailures == 0, "ResetStats() did not reset alloc failures\n");
+    VerifyOrQuit(stats.mReservedAllocFailures == 0, "ResetStats() did not reset reserved alloc failures\n");
+
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMessage();
+    TestMessagePoolStats();
+    TestMessageChunks();
+    TestMessageChecksum();
+    TestMessageChecksumPerformance();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,258 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "posix/platform/message_io.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+enum
+{
+    kPacketSize = 1280, ///< Spans several message buffers.
+};
+
+static ot::Instance *   sInstance;
+static ot::MessagePool *sMessagePool;
+static int              sFds[2];
+static uint8_t          sPacket[kPacketSize];
+
+static void InitTest(void)
+{
+    int rval;
+
+    sInstance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(sInstance != NULL, "Null OpenThread instance\n");
+    sMessagePool = &sInstance->Get<ot::MessagePool>();
+
+    // Datagram sockets keep packet boundaries and truncate short reads, as a TUN device does.
+    rval = socketpair(AF_UNIX, SOCK_DGRAM, 0, sFds);
+    VerifyOrQuit(rval == 0, "socketpair() failed\n");
+    rval = fcntl(sFds[1], F_SETFL, O_NONBLOCK);
+    VerifyOrQuit(rval == 0, "fcntl() failed\n");
+
+    for (unsigned i = 0; i < sizeof(sPacket); i++)
+    {
+        sPacket[i] = static_cast<uint8_t>(i * 7);
+    }
+}
+
+static void FinalizeTest(void)
+{
+    close(sFds[0]);
+    close(sFds[1]);
+    testFreeInstance(sInstance);
+}
+
+static void SendPacket(uint16_t aLength)
+{
+    ssize_t rval = send(sFds[0], sPacket, aLength, 0);
+
+    VerifyOrQuit(rval == aLength, "send() failed\n");
+}
+
+static void VerifyPacket(const ot::Message &aMessage, uint16_t aLength)
+{
+    uint8_t buffer[kPacketSize];
+
+    VerifyOrQuit(aMessage.GetLength() == aLength, "Message length does not match the packet\n");
+    VerifyOrQuit(aMessage.Read(0, aLength, buffer) == aLength, "Message::Read() failed\n");
+    VerifyOrQuit(memcmp(buffer, sPacket, aLength) == 0, "Message content does not match the packet\n");
+}
+
+void TestReadMessage(void)
+{
+    ot::Message *message;
+    uint16_t     freeBuffers;
+    uint8_t      bufferCount;
+
+    InitTest();
+
+    freeBuffers = sMessagePool->GetFreeBufferCount();
+
+    // A packet spanning several buffers is read into them, the unused buffers are returned.
+
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+    VerifyOrQuit(message->GetAvailableLength() >= kPacketSize, "Too few buffers available\n");
+
+    SendPacket(kPacketSize);
+    SuccessOrQuit(ot::PosixApp::ReadMessage(sFds[1], message), "ReadMessage() failed\n");
+    VerifyPacket(*message, kPacketSize);
+
+    bufferCount = message->GetBufferCount();
+    VerifyOrQuit(bufferCount > 1, "Packet does not span several buffers\n");
+    SuccessOrQuit(message->SetLength(kPacketSize - 1), "Message::SetLength() failed\n");
+    VerifyOrQuit(message->GetBufferCount() <= bufferCount, "Message holds more buffers than the packet needs\n");
+    VerifyOrQuit(sMessagePool->GetFreeBufferCount() == freeBuffers - message->GetBufferCount(),
+                 "Unused buffers were not returned\n");
+    message->Free();
+
+    // A packet fitting in the head buffer only uses the head buffer.
+
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+
+    SendPacket(40);
+    SuccessOrQuit(ot::PosixApp::ReadMessage(sFds[1], message), "ReadMessage() failed\n");
+    VerifyPacket(*message, 40);
+    VerifyOrQuit(message->GetBufferCount() == 1, "Small packet uses more than the head buffer\n");
+    message->Free();
+
+    // Without a message the packet is read and dropped.
+
+    SendPacket(kPacketSize);
+    VerifyOrQuit(ot::PosixApp::ReadMessage(sFds[1], NULL) == OT_ERROR_NO_BUFS, "ReadMessage() did not drop\n");
+
+    // Nothing left to read.
+
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+    VerifyOrQuit(ot::PosixApp::ReadMessage(sFds[1], message) == OT_ERROR_NOT_FOUND, "ReadMessage() read a packet\n");
+    message->Free();
+
+    VerifyOrQuit(sMessagePool->GetFreeBufferCount() == freeBuffers, "Message buffers were leaked\n");
+
+    printf("TestReadMessage -- PASS\n");
+
+    FinalizeTest();
+}
+
+void TestReadMessageLowBuffers(void)
+{
+    ot::Message *hog;
+    ot::Message *message;
+    uint16_t     available;
+
+    InitTest();
+
+    // Leave fewer free buffers than a full size packet needs, so the available length limits the direct read.
+
+    hog = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(hog != NULL, "MessagePool::New() failed\n");
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+
+    while (message->GetAvailableLength() >= kPacketSize / 2)
+    {
+        SuccessOrQuit(hog->SetLength(hog->GetLength() + 64), "Message::SetLength() failed\n");
+    }
+
+    available = message->GetAvailableLength();
+    VerifyOrQuit(available < kPacketSize, "Too many buffers available\n");
+    VerifyOrQuit(message->SetLength(available + 64) == OT_ERROR_NO_BUFS, "Available length is too small\n");
+    SuccessOrQuit(message->SetLength(0), "Message::SetLength() failed\n");
+
+    // A packet within the available length is read.
+
+    SendPacket(available);
+    SuccessOrQuit(ot::PosixApp::ReadMessage(sFds[1], message), "ReadMessage() failed\n");
+    VerifyPacket(*message, available);
+    SuccessOrQuit(message->SetLength(0), "Message::SetLength() failed\n");
+
+    // A larger packet is consumed and dropped, since no buffers can be reclaimed from the hog.
+
+    SendPacket(kPacketSize);
+    VerifyOrQuit(ot::PosixApp::ReadMessage(sFds[1], message) == OT_ERROR_NO_BUFS, "ReadMessage() did not drop\n");
+    SuccessOrQuit(message->SetLength(0), "Message::SetLength() failed\n");
+    VerifyOrQuit(ot::PosixApp::ReadMessage(sFds[1], message) == OT_ERROR_NOT_FOUND, "Dropped packet was not read\n");
+
+    hog->Free();
+    message->Free();
+
+    // When the buffers are held by an evictable lower priority message, the part of the packet read past the
+    // available length is copied into the message once the buffers are reclaimed.
+
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+
+    hog = sMessagePool->New(ot::Message::kTypeMacDataPoll, 0, ot::Message::kPriorityLow);
+    VerifyOrQuit(hog != NULL, "MessagePool::New() failed\n");
+
+    while (message->GetAvailableLength() >= kPacketSize / 2)
+    {
+        SuccessOrQuit(hog->SetLength(hog->GetLength() + 64), "Message::SetLength() failed\n");
+    }
+
+    VerifyOrQuit(message->GetAvailableLength() < kPacketSize, "Too many buffers available\n");
+    SuccessOrQuit(sInstance->Get<ot::MeshForwarder>().SendMessage(*hog), "MeshForwarder::SendMessage() failed\n");
+
+    SendPacket(kPacketSize);
+    SuccessOrQuit(ot::PosixApp::ReadMessage(sFds[1], message), "ReadMessage() failed\n");
+    VerifyPacket(*message, kPacketSize);
+
+    message->Free();
+
+    printf("TestReadMessageLowBuffers -- PASS\n");
+
+    FinalizeTest();
+}
+
+void TestWriteMessage(void)
+{
+    ot::Message *message;
+    uint8_t      buffer[kPacketSize + 1];
+    ssize_t      rval;
+
+    InitTest();
+
+    message = sMessagePool->New(ot::Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed\n");
+    SuccessOrQuit(message->Append(sPacket, kPacketSize), "Message::Append() failed\n");
+    VerifyOrQuit(message->GetBufferCount() > 1, "Packet does not span several buffers\n");
+
+    SuccessOrQuit(ot::PosixApp::WriteMessage(sFds[1], *message), "WriteMessage() failed\n");
+
+    rval = recv(sFds[0], buffer, sizeof(buffer), 0);
+    VerifyOrQuit(rval == kPacketSize, "Written packet has the wrong length\n");
+    VerifyOrQuit(memcmp(buffer, sPacket, kPacketSize) == 0, "Written packet does not match the message\n");
+
+    message->Free();
+
+    printf("TestWriteMessage -- PASS\n");
+
+    FinalizeTest();
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestReadMessage();
+    TestReadMessageLowBuffers();
+    TestWriteMessage();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -211,6 +211,42 @@ void ReadAndVerifyContent(NcpFrameBuffer &aNcpBuffer, const uint8_t *aContentBuf
     }
 }
 
+// Reads the frame as spans of at most `aMaxSpanLength` bytes and verifies that it matches with the given content
+// buffer. The spans are verified only after the whole frame is read, as they should stay valid until frame removal.
+void ReadAndVerifySpans(NcpFrameBuffer &aNcpBuffer,
+                        const uint8_t * aContentBuffer,
+                        uint16_t        aBufferLength,
+                        uint16_t        aMaxSpanLength)
+{
+    enum
+    {
+        kMaxSpans = 500,
+    };
+
+    const uint8_t *spans[kMaxSpans];
+    uint16_t       spanLengths[kMaxSpans];
+    uint16_t       numSpans = 0;
+    uint16_t       length   = 0;
+
+    while (!aNcpBuffer.OutFrameHasEnded())
+    {
+        VerifyOrQuit(numSpans < kMaxSpans, "Out frame has too many spans.");
+        spanLengths[numSpans] = aNcpBuffer.OutFrameReadSpan(aMaxSpanLength, spans[numSpans]);
+        VerifyOrQuit(spanLengths[numSpans] > 0 && spanLengths[numSpans] <= aMaxSpanLength, "Span length is invalid.");
+        length += spanLengths[numSpans];
+        numSpans++;
+    }
+
+    VerifyOrQuit(aNcpBuffer.OutFrameReadSpan(aMaxSpanLength, spans[0]) == 0, "ReadSpan() returned data after end.");
+    VerifyOrQuit(length == aBufferLength, "Out frame length does not match expected content.");
+
+    for (uint16_t i = 0; i < numSpans; i++)
+    {
+        VerifyOrQuit(memcmp(spans[i], aContentBuffer, spanLengths[i]) == 0, "Span does not match expected content.");
+        aContentBuffer += spanLengths[i];
+    }
+}
+
 void WriteTestFrame1(NcpFrameBuffer &aNcpBuffer, NcpFrameBuffer::Priority aPriority)
 {
     Message *       message;
@@ -660,6 +696,37 @@ void TestNcpFrameBuffer(void)
 
     printf("\n -- PASS\n");
 
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 7b: OutFrameReadSpan() over segments, messages and buffer wrap-around");
+
+    for (i = 0; i < kNumPrios; i++)
+    {
+        NcpFrameBuffer::Priority priority = (i == 0) ? NcpFrameBuffer::kPriorityLow : NcpFrameBuffer::kPriorityHigh;
+        uint8_t                  content[kTestFrame1Size];
+
+        memcpy(content, sMottoText, sizeof(sMottoText));
+        memcpy(content + sizeof(sMottoText), sMysteryText, sizeof(sMysteryText));
+        memcpy(content + sizeof(sMottoText) + sizeof(sMysteryText), sMottoText, sizeof(sMottoText));
+        memcpy(content + 2 * sizeof(sMottoText) + sizeof(sMysteryText), sHelloText, sizeof(sHelloText));
+
+        // Move the frames around the buffer so that they wrap around its end.
+        for (j = 0; j < kTestBufferSize; j += kTestFrame1Size / 2)
+        {
+            WriteTestFrame1(ncpBuffer, priority);
+            SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed unexpectedly.");
+            ReadAndVerifySpans(ncpBuffer, content, sizeof(content), 0xffff);
+            SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed unexpectedly.");
+            ReadAndVerifySpans(ncpBuffer, content, sizeof(content), static_cast<uint16_t>(j % 7) + 1);
+            VerifyAndRemoveFrame1(ncpBuffer);
+
+            WriteTestFrame4(ncpBuffer, priority);
+            VerifyAndRemoveFrame4(ncpBuffer);
+        }
+    }
+
+    VerifyOrQuit(ncpBuffer.IsEmpty(), "IsEmpty() failed.");
+    printf(" -- PASS\n");
+
     printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
     printf("\nTest 8: Remove a frame without reading it first");
 
@@ -980,7 +1047,16 @@ otError ReadRandomFrame(uint32_t aLength, NcpFrameBuffer &aNcpBuffer, uint8_t pr
     VerifyOrQuit(aNcpBuffer.OutFrameGetLength() == aLength, "OutFrameGetLength() does not match");
 
     // Read and verify that the content is same as sFrameBuffer values...
-    ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    if (GetRandom(2) == 0)
+    {
+        ReadAndVerifyContent(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength));
+    }
+    else
+    {
+        ReadAndVerifySpans(aNcpBuffer, sFrameBuffer[priority], static_cast<uint16_t>(aLength),
+                           static_cast<uint16_t>(GetRandom(kMaxFrameLen) + 1));
+    }
+
     sExpectedRemovedTag = aNcpBuffer.OutFrameGetTag();
 
     SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "OutFrameRemove failed");
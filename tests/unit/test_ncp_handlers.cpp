@@ -0,0 +1,179 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "ncp/ncp_base.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Ncp {
+
+/**
+ * This class exposes the property handler tables of `NcpBase`, it is never instantiated.
+ *
+ */
+class TestNcp : public NcpBase
+{
+public:
+    typedef NcpBase::HandlerEntry HandlerEntry;
+    typedef NcpBase::HandlerTable HandlerTable;
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    typedef NcpBase::PropertyStats PropertyStats;
+#endif
+
+    static uint8_t             GetNumTables(void) { return kNumHandlerTables; }
+    static const HandlerTable &GetTable(uint8_t aIndex) { return sHandlerTables[aIndex]; }
+
+    static const HandlerEntry *FindHandler(uint8_t aCommand, spinel_prop_key_t aKey)
+    {
+        const HandlerEntry *entry = NULL;
+
+        switch (aCommand)
+        {
+        case SPINEL_CMD_PROP_VALUE_GET:
+            entry = FindGetPropertyHandler(aKey);
+            break;
+
+        case SPINEL_CMD_PROP_VALUE_SET:
+            entry = FindSetPropertyHandler(aKey);
+            break;
+
+        case SPINEL_CMD_PROP_VALUE_INSERT:
+            entry = FindInsertPropertyHandler(aKey);
+            break;
+
+        case SPINEL_CMD_PROP_VALUE_REMOVE:
+            entry = FindRemovePropertyHandler(aKey);
+            break;
+        }
+
+        return entry;
+    }
+
+    using NcpBase::AreHandlerTablesSorted;
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    using NcpBase::FindPropertyStats;
+
+    static const PropertyStats *GetPropertyStats(void) { return sPropertyStats; }
+#endif
+};
+
+void TestHandlerTablesSorted(void)
+{
+    static const uint8_t kCommands[] = {SPINEL_CMD_PROP_VALUE_GET, SPINEL_CMD_PROP_VALUE_SET,
+                                        SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_CMD_PROP_VALUE_REMOVE};
+
+    printf("Testing the sorting of the property handler tables");
+
+    VerifyOrQuit(OT_ARRAY_LENGTH(kCommands) == TestNcp::GetNumTables(), "unexpected number of handler tables\n");
+
+    for (uint8_t tableIndex = 0; tableIndex < TestNcp::GetNumTables(); tableIndex++)
+    {
+        const TestNcp::HandlerTable &table = TestNcp::GetTable(tableIndex);
+
+        VerifyOrQuit(table.mCommand == kCommands[tableIndex], "unexpected handler table command\n");
+
+        for (uint16_t index = 1; index < table.mLength; index++)
+        {
+            if (table.mEntries[index - 1].mKey >= table.mEntries[index].mKey)
+            {
+                printf("\nCommand %u: property %u is not sorted before property %u\n", table.mCommand,
+                       table.mEntries[index - 1].mKey, table.mEntries[index].mKey);
+                VerifyOrQuit(false, "handler table is not sorted\n");
+            }
+        }
+
+        // Every handler is found by the binary search, and keys between handlers are not.
+
+        for (uint16_t index = 0; index < table.mLength; index++)
+        {
+            spinel_prop_key_t key = table.mEntries[index].mKey;
+
+            VerifyOrQuit(TestNcp::FindHandler(table.mCommand, key) == &table.mEntries[index], "handler not found\n");
+
+            if (index + 1 == table.mLength || table.mEntries[index + 1].mKey != key + 1)
+            {
+                VerifyOrQuit(TestNcp::FindHandler(table.mCommand, static_cast<spinel_prop_key_t>(key + 1)) == NULL,
+                             "handler found for a property without handler\n");
+            }
+        }
+    }
+
+    VerifyOrQuit(TestNcp::AreHandlerTablesSorted(), "AreHandlerTablesSorted() failed\n");
+
+    printf(" -- PASS\n");
+}
+
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+void TestPropertyStats(void)
+{
+    const TestNcp::PropertyStats *stats = TestNcp::GetPropertyStats();
+    TestNcp::HandlerEntry         otherEntry;
+
+    printf("Testing the property handler statistics");
+
+    // The statistics of all handlers are laid out table after table, in the order of the entries.
+
+    for (uint8_t tableIndex = 0; tableIndex < TestNcp::GetNumTables(); tableIndex++)
+    {
+        const TestNcp::HandlerTable &table = TestNcp::GetTable(tableIndex);
+
+        for (uint16_t index = 0; index < table.mLength; index++, stats++)
+        {
+            VerifyOrQuit(TestNcp::FindPropertyStats(table.mEntries[index]) == stats, "FindPropertyStats() failed\n");
+        }
+    }
+
+    memset(&otherEntry, 0, sizeof(otherEntry));
+    VerifyOrQuit(TestNcp::FindPropertyStats(otherEntry) == NULL, "FindPropertyStats() found an unknown handler\n");
+
+    VerifyOrQuit(TestNcp::FindHandler(SPINEL_CMD_PROP_VALUE_GET, SPINEL_PROP_DEBUG_NCP_PROPERTY_STATS) != NULL,
+                 "statistics cannot be read\n");
+
+    printf(" -- PASS\n");
+}
+#endif // OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+
+} // namespace Ncp
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::Ncp::TestHandlerTablesSorted();
+#if OPENTHREAD_CONFIG_NCP_ENABLE_PROPERTY_STATS
+    ot::Ncp::TestPropertyStats();
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -30,6 +30,8 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "net/ip6_address.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 
 #include "test_platform.h"
@@ -171,12 +173,311 @@ void TestNetworkDataIterator(void)
     testFreeInstance(instance);
 }
 
+// Helpers to compose a Network Data for the Leader lookup tests.
+
+static uint8_t sNetData[NetworkData::NetworkData::kMaxSize];
+static uint8_t sNetDataLength;
+
+static void AppendByte(uint8_t aByte)
+{
+    VerifyOrQuit(sNetDataLength < sizeof(sNetData), "Network Data is too long");
+    sNetData[sNetDataLength++] = aByte;
+}
+
+enum
+{
+    kContextCompressFlag = 1 << 4, ///< Compress flag in the Context TLV.
+};
+
+static uint8_t BeginTlv(uint8_t aType)
+{
+    AppendByte(static_cast<uint8_t>(aType << 1) | 1); // Stable
+    AppendByte(0);
+
+    return sNetDataLength;
+}
+
+static void EndTlv(uint8_t aValueOffset)
+{
+    sNetData[aValueOffset - 1] = sNetDataLength - aValueOffset;
+}
+
+static void AppendPrefix(const char *   aPrefix,
+                         uint8_t        aPrefixLength,
+                         uint8_t        aContextId,
+                         bool           aCompress,
+                         uint16_t       aBorderRouter,
+                         bool           aDefaultRoute,
+                         uint16_t       aHasRoute)
+{
+    Ip6::Address prefix;
+    uint8_t      prefixTlv;
+    uint8_t      subTlv;
+
+    SuccessOrQuit(prefix.FromString(aPrefix), "Ip6::Address::FromString() failed");
+
+    prefixTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypePrefix);
+    AppendByte(0); // Domain ID
+    AppendByte(aPrefixLength);
+
+    for (uint8_t i = 0; i < (aPrefixLength + 7) / 8; i++)
+    {
+        AppendByte(prefix.mFields.m8[i]);
+    }
+
+    if (aBorderRouter != 0)
+    {
+        subTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypeBorderRouter);
+        AppendByte(aBorderRouter >> 8);
+        AppendByte(aBorderRouter & 0xff);
+        AppendByte(NetworkData::BorderRouterEntry::kOnMeshFlag |
+                   (aDefaultRoute ? NetworkData::BorderRouterEntry::kDefaultRouteFlag : 0));
+        AppendByte(0);
+        EndTlv(subTlv);
+    }
+
+    if (aHasRoute != 0)
+    {
+        subTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypeHasRoute);
+        AppendByte(aHasRoute >> 8);
+        AppendByte(aHasRoute & 0xff);
+        AppendByte(0);
+        EndTlv(subTlv);
+    }
+
+    if (aContextId != 0)
+    {
+        subTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypeContext);
+        AppendByte((aCompress ? kContextCompressFlag : 0) | aContextId);
+        AppendByte(aPrefixLength);
+        EndTlv(subTlv);
+    }
+
+    EndTlv(prefixTlv);
+}
+
+static void AppendService(uint8_t aServiceId, uint16_t aServer)
+{
+    uint8_t serviceTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypeService);
+    uint8_t serverTlv;
+
+    AppendByte(0x80 | aServiceId); // Thread Enterprise Number
+    AppendByte(2);                 // Service Data Length
+    AppendByte(0x5c);
+    AppendByte(aServiceId);
+
+    serverTlv = BeginTlv(NetworkData::NetworkDataTlv::kTypeServer);
+    AppendByte(aServer >> 8);
+    AppendByte(aServer & 0xff);
+    EndTlv(serverTlv);
+
+    EndTlv(serviceTlv);
+}
+
+static void SetLeaderNetworkData(ot::Instance *aInstance, uint8_t aVersion)
+{
+    NetworkData::Leader &leader  = aInstance->Get<NetworkData::Leader>();
+    Message *            message = aInstance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    uint8_t              tlv[2]  = {0, sNetDataLength};
+
+    VerifyOrQuit(message != NULL, "Message::New() failed");
+    SuccessOrQuit(message->Append(tlv, sizeof(tlv)), "Message::Append() failed");
+    SuccessOrQuit(message->Append(sNetData, sNetDataLength), "Message::Append() failed");
+    SuccessOrQuit(leader.SetNetworkData(aVersion, aVersion, false, *message, 0), "SetNetworkData() failed");
+    message->Free();
+}
+
+static Ip6::Address ToAddress(const char *aString)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString(aString), "Ip6::Address::FromString() failed");
+
+    return address;
+}
+
+static void VerifyContext(NetworkData::Leader &aLeader,
+                          const char *         aAddress,
+                          uint8_t              aContextId,
+                          uint8_t              aPrefixLength,
+                          bool                 aCompress)
+{
+    Lowpan::Context context;
+
+    SuccessOrQuit(aLeader.GetContext(ToAddress(aAddress), context), "GetContext() failed");
+    VerifyOrQuit(context.mContextId == aContextId, "GetContext() returned wrong context");
+    VerifyOrQuit(context.mPrefixLength == aPrefixLength, "GetContext() returned wrong prefix length");
+    VerifyOrQuit(context.mCompressFlag == aCompress, "GetContext() returned wrong compress flag");
+}
+
+void TestNetworkDataLeaderLookup(void)
+{
+    ot::Instance *  instance;
+    Lowpan::Context context;
+    Ip6::Address    meshLocal;
+    uint16_t        rloc16;
+    uint8_t         prefixMatch;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    NetworkData::Leader &leader = instance->Get<NetworkData::Leader>();
+
+    printf("\nTest #3: Leader Network Data lookups");
+    printf("\n-------------------------------------------------");
+
+    memset(&meshLocal, 0, sizeof(meshLocal));
+    memcpy(meshLocal.mFields.m8, instance->Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, sizeof(otMeshLocalPrefix));
+    meshLocal.mFields.m8[15] = 1;
+
+    sNetDataLength = 0;
+    AppendPrefix("2001:db8::", 32, 1, true, 0x1000, true, 0);
+    AppendPrefix("2001:db8:1::", 48, 2, false, 0, false, 0x2000);
+    AppendService(1, 0x3000);
+    AppendPrefix("fd11:2233::", 64, 3, true, 0x4000, false, 0);
+    SetLeaderNetworkData(instance, 1);
+
+    VerifyContext(leader, "2001:db8:1::1", 2, 48, false);
+    VerifyContext(leader, "2001:db8:2::1", 1, 32, true);
+    VerifyContext(leader, "fd11:2233::1", 3, 64, true);
+    VerifyOrQuit(leader.GetContext(meshLocal, context) == OT_ERROR_NONE && context.mContextId == 0,
+                 "GetContext() failed for mesh-local address");
+    VerifyOrQuit(leader.GetContext(ToAddress("3000::1"), context) == OT_ERROR_NOT_FOUND,
+                 "GetContext() succeeded for unknown prefix");
+
+    SuccessOrQuit(leader.GetContext(3, context), "GetContext() failed");
+    VerifyOrQuit(context.mPrefixLength == 64 && context.mCompressFlag, "GetContext() returned wrong context");
+    VerifyOrQuit(leader.GetContext(4, context) == OT_ERROR_NOT_FOUND, "GetContext() succeeded for unknown id");
+
+    VerifyOrQuit(leader.IsOnMesh(meshLocal), "IsOnMesh() failed for mesh-local address");
+    VerifyOrQuit(leader.IsOnMesh(ToAddress("2001:db8:1::1")), "IsOnMesh() failed");
+    VerifyOrQuit(leader.IsOnMesh(ToAddress("fd11:2233::1")), "IsOnMesh() failed");
+    VerifyOrQuit(!leader.IsOnMesh(ToAddress("3000::1")), "IsOnMesh() succeeded for off-mesh address");
+
+    SuccessOrQuit(leader.RouteLookup(ToAddress("2001:db8:2::1"), ToAddress("3000::1"), &prefixMatch, &rloc16),
+                  "RouteLookup() failed");
+    VerifyOrQuit(rloc16 == 0x1000 && prefixMatch == 0, "RouteLookup() did not select the default route");
+    SuccessOrQuit(leader.RouteLookup(ToAddress("2001:db8:2::1"), ToAddress("2001:db8:1::5"), &prefixMatch, &rloc16),
+                  "RouteLookup() failed");
+    VerifyOrQuit(rloc16 == 0x2000 && prefixMatch == 48, "RouteLookup() did not select the external route");
+    VerifyOrQuit(leader.RouteLookup(ToAddress("fd11:2233::1"), ToAddress("3000::1"), NULL, &rloc16) ==
+                     OT_ERROR_NO_ROUTE,
+                 "RouteLookup() succeeded without a route");
+
+    // New Network Data with the same version must not be served from a stale index.
+
+    sNetDataLength = 0;
+    AppendPrefix("fd11:2233::", 64, 2, false, 0, false, 0);
+    SetLeaderNetworkData(instance, 1);
+
+    VerifyContext(leader, "fd11:2233::1", 2, 64, false);
+    VerifyOrQuit(leader.GetContext(1, context) == OT_ERROR_NOT_FOUND, "GetContext() returned stale context");
+    VerifyOrQuit(!leader.IsOnMesh(ToAddress("2001:db8:1::1")), "IsOnMesh() returned stale result");
+
+    printf("\n -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestNetworkDataLeaderLookupPerformance(void)
+{
+    enum
+    {
+        kNumPrefixes = 8,
+        kIterations  = 20000,
+    };
+
+    ot::Instance *  instance;
+    Lowpan::Context context;
+    Ip6::Address    address;
+    char            string[40];
+    uint32_t        start;
+    uint32_t        duration;
+    uint16_t        rloc16;
+    uint32_t        found = 0;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    NetworkData::Leader &leader = instance->Get<NetworkData::Leader>();
+
+    printf("\nTest #4: Leader Network Data lookup performance");
+    printf("\n-------------------------------------------------");
+
+    sNetDataLength = 0;
+
+    for (uint8_t i = 0; i < kNumPrefixes; i++)
+    {
+        snprintf(string, sizeof(string), "fd00:%x::", i + 1);
+        AppendPrefix(string, 64, i + 1, true, 0x1000 + i, (i % 2) == 1, 0x2000 + i);
+    }
+
+    AppendService(1, 0x3000);
+    AppendService(2, 0x3400);
+    SetLeaderNetworkData(instance, 1);
+
+    printf("\nNetwork Data length: %d bytes, %d prefixes", sNetDataLength, kNumPrefixes);
+    VerifyOrQuit(sNetDataLength >= 200, "Network Data is too short for the benchmark");
+
+    // Look up the prefix stored last in the Network Data.
+    snprintf(string, sizeof(string), "fd00:%x::1", kNumPrefixes);
+    address = ToAddress(string);
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        found += (leader.GetContext(address, context) == OT_ERROR_NONE);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+    printf("\nGetContext(address): %d ns/lookup", static_cast<int>(duration * 1000 / kIterations));
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        found += (leader.GetContext(kNumPrefixes, context) == OT_ERROR_NONE);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+    printf("\nGetContext(id):      %d ns/lookup", static_cast<int>(duration * 1000 / kIterations));
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        found += leader.IsOnMesh(address);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+    printf("\nIsOnMesh():          %d ns/lookup", static_cast<int>(duration * 1000 / kIterations));
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        found += (leader.RouteLookup(address, ToAddress("3000::1"), NULL, &rloc16) == OT_ERROR_NONE);
+    }
+
+    duration = otPlatAlarmMicroGetNow() - start;
+    printf("\nRouteLookup():       %d ns/lookup", static_cast<int>(duration * 1000 / kIterations));
+
+    VerifyOrQuit(found == 4 * kIterations, "lookups failed");
+
+    printf("\n -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestNetworkDataIterator();
+    ot::TestNetworkDataLeaderLookup();
+    ot::TestNetworkDataLeaderLookupPerformance();
 
     printf("\nAll tests passed\n");
     return 0;
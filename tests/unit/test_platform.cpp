@@ -392,6 +392,13 @@ otError otPlatRadioEnergyScan(otInstance *, uint8_t, uint16_t)
     return OT_ERROR_NOT_IMPLEMENTED;
 }
 
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aPower);
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -436,12 +443,13 @@ exit:
 // Diag
 //
 
-void otPlatDiagProcess(int argc, char *argv[], char *aOutput)
+void otPlatDiagProcess(otInstance *aInstance, int argc, char *argv[], char *aOutput, size_t aOutputMaxLen)
 {
+    OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(argc);
 
     // no more diagnostics features for Posix platform
-    sprintf(aOutput, "diag feature '%s' is not supported\r\n", argv[0]);
+    snprintf(aOutput, aOutputMaxLen, "diag feature '%s' is not supported\r\n", argv[0]);
 }
 
 void otPlatDiagModeSet(bool aMode)
@@ -454,6 +462,25 @@ bool otPlatDiagModeGet()
     return sDiagMode;
 }
 
+void otPlatDiagChannelSet(uint8_t)
+{
+}
+
+void otPlatDiagTxPowerSet(int8_t)
+{
+}
+
+void otPlatDiagRadioReceived(otInstance *, otRadioFrame *, otError)
+{
+}
+
+void otPlatDiagAlarmCallback(otInstance *)
+{
+}
+
+#if !OPENTHREAD_ENABLE_DIAG
+// The diagnostics module handles these when it is built.
+
 void otPlatDiagAlarmFired(otInstance *)
 {
 }
@@ -465,6 +492,7 @@ void otPlatDiagRadioTransmitDone(otInstance *, otRadioFrame *, otError)
 void otPlatDiagRadioReceiveDone(otInstance *, otRadioFrame *, otError)
 {
 }
+#endif
 
 //
 // Uart
@@ -572,6 +600,50 @@ void otPlatSettingsWipe(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
 }
 
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+static size_t   sTestPlatBufferSize;
+static uint16_t sTestPlatMaxNumBuffers;
+static uint16_t sTestPlatNumUsedBuffers;
+
+void otPlatMessagePoolInit(otInstance *aInstance, uint16_t aMinNumFreeBuffers, size_t aBufferSize)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    sTestPlatBufferSize     = aBufferSize;
+    sTestPlatMaxNumBuffers  = aMinNumFreeBuffers;
+    sTestPlatNumUsedBuffers = 0;
+}
+
+otMessage *otPlatMessagePoolNew(otInstance *aInstance)
+{
+    otMessage *buffer = NULL;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    VerifyOrExit(sTestPlatNumUsedBuffers < sTestPlatMaxNumBuffers);
+    VerifyOrExit((buffer = static_cast<otMessage *>(calloc(1, sTestPlatBufferSize))) != NULL);
+    sTestPlatNumUsedBuffers++;
+
+exit:
+    return buffer;
+}
+
+void otPlatMessagePoolFree(otInstance *aInstance, otMessage *aBuffer)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    free(aBuffer);
+    sTestPlatNumUsedBuffers--;
+}
+
+uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return sTestPlatMaxNumBuffers - sTestPlatNumUsedBuffers;
+}
+#endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
 #if OPENTHREAD_CONFIG_ENABLE_TIME_SYNC
 uint64_t otPlatTimeGet(void)
 {
@@ -0,0 +1,580 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "ncp/hdlc.hpp"
+#include "ncp/spinel_batcher.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Ncp {
+
+enum
+{
+    kTestBufferSize    = 2048,
+    kBatchSize         = 256,
+    kMaxFrameSize      = 300,
+    kMaxFrames         = 64,
+    kFuzzIterations    = 2000,
+    kBenchmarkFrames   = 20000,
+    kBenchmarkBurst    = 64,
+    kBenchmarkTimeout  = 10000000, // Time allowed for the host to receive all frames (in usec).
+    kBenchmarkKeyValue = 0x70,     // A one byte property key.
+    kBenchmarkDataSize = 16,       // Size of the property value in each benchmark frame.
+};
+
+static const uint8_t kHeaderIid0  = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+static const uint8_t kHeaderIid1  = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_1;
+static const uint8_t kHeaderTid1  = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | 1;
+static const uint8_t kHeaderTid15 = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | 15;
+
+struct TestFrame
+{
+    uint8_t  mData[kMaxFrameSize];
+    uint16_t mLength;
+};
+
+struct FrameList
+{
+    void Clear(void) { mNumFrames = 0; }
+
+    void Add(const uint8_t *aFrame, uint16_t aLength)
+    {
+        VerifyOrQuit(mNumFrames < kMaxFrames, "FrameList is full");
+        VerifyOrQuit(aLength <= kMaxFrameSize, "Frame is too long");
+        memcpy(mFrames[mNumFrames].mData, aFrame, aLength);
+        mFrames[mNumFrames].mLength = aLength;
+        mNumFrames++;
+    }
+
+    TestFrame mFrames[kMaxFrames];
+    uint16_t  mNumFrames;
+};
+
+static ot::Instance *sInstance;
+static MessagePool * sMessagePool;
+
+uint32_t GetRandom(uint32_t aMax)
+{
+    return otPlatRandomGet() % aMax;
+}
+
+// Writes a spinel frame with `aValueLength` bytes of property value, optionally taking the value from a message.
+void WriteFrame(NcpFrameBuffer &        aNcpBuffer,
+                NcpFrameBuffer::Priority aPriority,
+                uint8_t                  aHeader,
+                uint8_t                  aCommand,
+                uint16_t                 aValueLength,
+                bool                     aUseMessage,
+                TestFrame &              aFrame)
+{
+    aFrame.mLength = 0;
+    aFrame.mData[aFrame.mLength++] = aHeader;
+    aFrame.mData[aFrame.mLength++] = aCommand;
+
+    for (uint16_t i = 0; i < aValueLength; i++)
+    {
+        aFrame.mData[aFrame.mLength++] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    aNcpBuffer.InFrameBegin(aPriority);
+
+    if (aUseMessage && aValueLength > 0)
+    {
+        Message *message = sMessagePool->New(Message::kTypeIp6, 0);
+
+        VerifyOrQuit(message != NULL, "Null Message");
+        SuccessOrQuit(message->SetLength(aValueLength), "Could not set the length of message.");
+        message->Write(0, aValueLength, &aFrame.mData[2]);
+
+        SuccessOrQuit(aNcpBuffer.InFrameFeedData(aFrame.mData, 2), "InFrameFeedData() failed.");
+        SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message), "InFrameFeedMessage() failed.");
+    }
+    else
+    {
+        SuccessOrQuit(aNcpBuffer.InFrameFeedData(aFrame.mData, aFrame.mLength), "InFrameFeedData() failed.");
+    }
+
+    SuccessOrQuit(aNcpBuffer.InFrameEnd(), "InFrameEnd() failed.");
+}
+
+// Splits a `VALUES_ARE` frame back into the `VALUE_IS` frames it carries (host side unbatching).
+void Unbatch(const uint8_t *aFrame, uint16_t aLength, FrameList &aList)
+{
+    uint8_t  frame[kMaxFrameSize];
+    uint16_t offset = SpinelBatcher::kFrameHeaderSize;
+
+    if (aLength < SpinelBatcher::kFrameHeaderSize || aFrame[1] != SPINEL_CMD_PROP_VALUES_ARE)
+    {
+        aList.Add(aFrame, aLength);
+        ExitNow();
+    }
+
+    VerifyOrQuit(SPINEL_HEADER_GET_TID(aFrame[0]) == 0, "Batched frame is not unsolicited");
+
+    frame[0] = aFrame[0];
+    frame[1] = SPINEL_CMD_PROP_VALUE_IS;
+
+    while (offset < aLength)
+    {
+        uint16_t entryLength;
+
+        VerifyOrQuit(offset + SpinelBatcher::kEntryLengthFieldSize <= aLength, "Truncated entry length");
+        entryLength = Encoding::LittleEndian::ReadUint16(&aFrame[offset]);
+        offset += SpinelBatcher::kEntryLengthFieldSize;
+
+        VerifyOrQuit(offset + entryLength <= aLength, "Truncated entry");
+        memcpy(&frame[SpinelBatcher::kFrameHeaderSize], &aFrame[offset], entryLength);
+        offset += entryLength;
+
+        aList.Add(frame, SpinelBatcher::kFrameHeaderSize + entryLength);
+    }
+
+exit:
+    return;
+}
+
+// Reads all frames from the buffer through the batcher, returning the number of transport frames.
+uint16_t ReadAllFrames(NcpFrameBuffer &aNcpBuffer, uint16_t aBatchSize, FrameList &aList)
+{
+    uint8_t  buffer[kTestBufferSize];
+    uint16_t numTransportFrames = 0;
+
+    aList.Clear();
+
+    while (!aNcpBuffer.IsEmpty())
+    {
+        uint16_t length = SpinelBatcher(aNcpBuffer).ReadFrame(buffer, aBatchSize);
+
+        if (length == 0)
+        {
+            // Not batchable, read it as is from the start.
+            length = aNcpBuffer.OutFrameGetLength();
+            VerifyOrQuit(aNcpBuffer.OutFrameRead(length, buffer) == length, "OutFrameRead() failed");
+            SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+        }
+        else
+        {
+            VerifyOrQuit(length <= aBatchSize, "Batched frame is larger than the batch size");
+        }
+
+        Unbatch(buffer, length, aList);
+        numTransportFrames++;
+    }
+
+    return numTransportFrames;
+}
+
+void VerifyFrame(const TestFrame &aActual, const TestFrame &aExpected)
+{
+    VerifyOrQuit(aActual.mLength == aExpected.mLength, "Frame length does not match");
+    VerifyOrQuit(memcmp(aActual.mData, aExpected.mData, aActual.mLength) == 0, "Frame content does not match");
+}
+
+void TestSpinelBatcher(void)
+{
+    uint8_t        buffer[kTestBufferSize];
+    uint8_t        batch[kBatchSize];
+    NcpFrameBuffer ncpBuffer(buffer, sizeof(buffer));
+    TestFrame      frames[8];
+    FrameList      list;
+    uint16_t       length;
+
+    sInstance    = testInitInstance();
+    sMessagePool = &sInstance->Get<MessagePool>();
+
+    printf("\nTest 1: Consecutive unsolicited frames are batched, responses are not");
+
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 10, false, frames[0]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 40, true, frames[1]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 1, false, frames[2]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid1, SPINEL_CMD_PROP_VALUE_IS, 5, false, frames[3]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid1, SPINEL_CMD_PROP_VALUE_INSERTED, 5, false,
+               frames[4]);
+
+    length = SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch));
+    VerifyOrQuit(length == 2 + (2 + 10) + (2 + 40) + (2 + 1), "Batched frame length is incorrect");
+    VerifyOrQuit(batch[0] == kHeaderIid0 && batch[1] == SPINEL_CMD_PROP_VALUES_ARE, "Batched frame header is wrong");
+
+    list.Clear();
+    Unbatch(batch, length, list);
+    VerifyOrQuit(list.mNumFrames == 3, "Batched frame does not carry three frames");
+
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        VerifyFrame(list.mFrames[i], frames[i]);
+    }
+
+    // A lone frame (the next frame is not a `VALUE_IS`) is sent as is.
+    length = SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch));
+    VerifyOrQuit(length == frames[3].mLength && memcmp(batch, frames[3].mData, length) == 0, "Lone frame changed");
+
+    // Other commands are left in the buffer, ready to be read from their start.
+    VerifyOrQuit(SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch)) == 0, "Non-batchable frame was read");
+    VerifyOrQuit(ncpBuffer.OutFrameGetLength() == frames[4].mLength, "Non-batchable frame length is wrong");
+    VerifyOrQuit(ncpBuffer.OutFrameRead(sizeof(batch), batch) == frames[4].mLength, "OutFrameRead() failed");
+    VerifyOrQuit(memcmp(batch, frames[4].mData, frames[4].mLength) == 0, "Non-batchable frame content is wrong");
+    SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+    VerifyOrQuit(ncpBuffer.IsEmpty(), "Buffer is not empty");
+
+    printf(" -- PASS\n");
+
+    printf("Test 2: A response stops a batch and is never batched itself");
+
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 3, false, frames[0]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 3, false, frames[1]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderTid1, SPINEL_CMD_PROP_VALUE_IS, 3, false, frames[2]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 3, false, frames[3]);
+
+    VerifyOrQuit(ReadAllFrames(ncpBuffer, kBatchSize, list) == 3, "Unexpected number of transport frames");
+    VerifyOrQuit(list.mNumFrames == 4, "Unexpected number of frames");
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        VerifyFrame(list.mFrames[i], frames[i]);
+    }
+
+    printf(" -- PASS\n");
+
+    printf("Test 3: Frames which do not fit are left for the next batch");
+
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 100, false, frames[0]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 100, true, frames[1]);
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 100, false, frames[2]);
+
+    // Two frames take 2 + 2 * (2 + 100) = 206 bytes, a third one does not fit.
+    length = SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch));
+    VerifyOrQuit(length == 206, "First batch length is incorrect");
+    length = SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch));
+    VerifyOrQuit(length == frames[2].mLength && memcmp(batch, frames[2].mData, length) == 0, "Lone frame changed");
+    VerifyOrQuit(ncpBuffer.IsEmpty(), "Buffer is not empty");
+
+    // A frame larger than the batch size is not read at all.
+    WriteFrame(ncpBuffer, NcpFrameBuffer::kPriorityLow, kHeaderIid0, SPINEL_CMD_PROP_VALUE_IS, 280, false, frames[0]);
+    VerifyOrQuit(SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch)) == 0, "Large frame was read");
+    VerifyOrQuit(ncpBuffer.OutFrameGetLength() == frames[0].mLength, "Large frame length is wrong");
+    SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+
+    // An empty buffer yields nothing.
+    VerifyOrQuit(SpinelBatcher(ncpBuffer).ReadFrame(batch, sizeof(batch)) == 0, "Read from an empty buffer");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestFuzzSpinelBatcher(void)
+{
+    uint8_t        buffer[kTestBufferSize * 4];
+    NcpFrameBuffer ncpBuffer(buffer, sizeof(buffer));
+    TestFrame      frames[kMaxFrames];
+    FrameList      list;
+    uint32_t       numTransportFrames = 0;
+    uint32_t       numFrames          = 0;
+
+    sInstance    = testInitInstance();
+    sMessagePool = &sInstance->Get<MessagePool>();
+
+    printf("Test 4: Fuzz batching of random frame sequences");
+
+    for (uint32_t iter = 0; iter < kFuzzIterations; iter++)
+    {
+        uint16_t count     = static_cast<uint16_t>(1 + GetRandom(kMaxFrames - 1));
+        uint16_t batchSize = static_cast<uint16_t>(3 + GetRandom(kBatchSize));
+        uint16_t numHigh   = 0;
+        uint16_t highIndex = 0;
+        uint16_t lowIndex;
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            static const uint8_t kHeaders[]  = {kHeaderIid0, kHeaderIid0, kHeaderIid0, kHeaderIid1, kHeaderTid15};
+            static const uint8_t kCommands[] = {SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_IS,
+                                                SPINEL_CMD_PROP_VALUE_IS, SPINEL_CMD_PROP_VALUE_INSERTED};
+
+            uint8_t                  header   = kHeaders[GetRandom(sizeof(kHeaders))];
+            uint8_t                  command  = kCommands[GetRandom(sizeof(kCommands))];
+            NcpFrameBuffer::Priority priority = NcpFrameBuffer::kPriorityLow;
+            uint16_t                 length   = static_cast<uint16_t>(GetRandom(4) ? GetRandom(40) : GetRandom(250));
+
+            // Responses are queued with high priority, as `SpinelEncoder` does.
+            if (SPINEL_HEADER_GET_TID(header) != 0)
+            {
+                priority = NcpFrameBuffer::kPriorityHigh;
+                numHigh++;
+            }
+
+            WriteFrame(ncpBuffer, priority, header, command, length, GetRandom(8) == 0, frames[i]);
+        }
+
+        numTransportFrames += ReadAllFrames(ncpBuffer, batchSize, list);
+        numFrames += count;
+
+        VerifyOrQuit(list.mNumFrames == count, "Number of frames read does not match");
+
+        // High priority frames are read first, each group keeping its order.
+        lowIndex = numHigh;
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            if (SPINEL_HEADER_GET_TID(frames[i].mData[0]) != 0)
+            {
+                VerifyFrame(list.mFrames[highIndex++], frames[i]);
+            }
+            else
+            {
+                VerifyFrame(list.mFrames[lowIndex++], frames[i]);
+            }
+        }
+    }
+
+    printf(" -- PASS (%lu frames in %lu transport frames)\n", static_cast<unsigned long>(numFrames),
+           static_cast<unsigned long>(numTransportFrames));
+
+    testFreeInstance(sInstance);
+}
+
+struct PtyHost
+{
+    static void HandleFrame(void *aContext, otError aError)
+    {
+        static_cast<PtyHost *>(aContext)->HandleFrame(aError);
+    }
+
+    void HandleFrame(otError aError)
+    {
+        uint16_t offset = SpinelBatcher::kFrameHeaderSize;
+
+        VerifyOrQuit(aError == OT_ERROR_NONE, "Host failed to decode an HDLC frame");
+        mNumTransportFrames++;
+
+        if (mRxBuffer.GetFrame()[1] != SPINEL_CMD_PROP_VALUES_ARE)
+        {
+            mNumFrames++;
+            ExitNow();
+        }
+
+        while (offset < mRxBuffer.GetLength())
+        {
+            offset += SpinelBatcher::kEntryLengthFieldSize +
+                      Encoding::LittleEndian::ReadUint16(mRxBuffer.GetFrame() + offset);
+            mNumFrames++;
+        }
+
+        VerifyOrQuit(offset == mRxBuffer.GetLength(), "Host found a truncated entry");
+
+    exit:
+        mRxBuffer.Clear();
+    }
+
+    Hdlc::FrameBuffer<kBatchSize * 2> mRxBuffer;
+    uint32_t                          mNumTransportFrames;
+    uint32_t                          mNumFrames;
+};
+
+// Reads whatever the pty holds for the host and decodes it.
+void DrainPty(int aHostFd, Hdlc::Decoder &aDecoder)
+{
+    uint8_t buffer[4096];
+    ssize_t rval;
+
+    while ((rval = read(aHostFd, buffer, sizeof(buffer))) > 0)
+    {
+        aDecoder.Decode(buffer, static_cast<uint16_t>(rval));
+    }
+
+    VerifyOrQuit(rval < 0 && errno == EAGAIN, "read() from pty failed");
+}
+
+void WritePty(int aNcpFd, int aHostFd, Hdlc::Decoder &aDecoder, const uint8_t *aBuffer, uint16_t aLength)
+{
+    while (aLength > 0)
+    {
+        ssize_t rval = write(aNcpFd, aBuffer, aLength);
+
+        if (rval > 0)
+        {
+            aBuffer += rval;
+            aLength -= static_cast<uint16_t>(rval);
+        }
+        else
+        {
+            VerifyOrQuit(errno == EAGAIN, "write() to pty failed");
+        }
+
+        DrainPty(aHostFd, aDecoder);
+    }
+}
+
+// Sends `kBenchmarkFrames` small unsolicited frames over a pty, returning the duration in usec.
+uint32_t RunPtyBenchmark(int aNcpFd, int aHostFd, bool aBatching, PtyHost &aHost)
+{
+    uint8_t                               buffer[kTestBufferSize];
+    uint8_t                               frame[kBatchSize];
+    NcpFrameBuffer                        ncpBuffer(buffer, sizeof(buffer));
+    Hdlc::FrameBuffer<kBatchSize * 2 + 4> encoderBuffer;
+    Hdlc::Encoder                         encoder(encoderBuffer);
+    Hdlc::Decoder                         decoder(aHost.mRxBuffer, PtyHost::HandleFrame, &aHost);
+    uint32_t                              numQueued = 0;
+    uint32_t                              start     = otPlatAlarmMicroGetNow();
+
+    aHost.mRxBuffer.Clear();
+    aHost.mNumTransportFrames = 0;
+    aHost.mNumFrames          = 0;
+
+    while (numQueued < kBenchmarkFrames || !ncpBuffer.IsEmpty())
+    {
+        uint16_t length = 0;
+
+        // Queue up a burst of notifications, as the stack does while the transport is busy.
+        for (uint16_t i = 0; (i < kBenchmarkBurst) && (numQueued < kBenchmarkFrames) && (i > 0 || ncpBuffer.IsEmpty());
+             i++)
+        {
+            uint8_t value[SpinelBatcher::kFrameHeaderSize + kBenchmarkDataSize];
+
+            memset(value, static_cast<int>(numQueued), sizeof(value));
+            value[0] = kHeaderIid0;
+            value[1] = SPINEL_CMD_PROP_VALUE_IS;
+            value[2] = kBenchmarkKeyValue;
+
+            ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
+            SuccessOrQuit(ncpBuffer.InFrameFeedData(value, sizeof(value)), "InFrameFeedData() failed");
+            SuccessOrQuit(ncpBuffer.InFrameEnd(), "InFrameEnd() failed");
+            numQueued++;
+        }
+
+        if (aBatching)
+        {
+            length = SpinelBatcher(ncpBuffer).ReadFrame(frame, sizeof(frame));
+        }
+
+        if (length == 0)
+        {
+            SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed");
+            length = ncpBuffer.OutFrameRead(sizeof(frame), frame);
+            SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed");
+        }
+
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(encoder.Encode(frame, length), "Encoder::Encode() failed");
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        WritePty(aNcpFd, aHostFd, decoder, encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+    }
+
+    while (aHost.mNumFrames < kBenchmarkFrames)
+    {
+        VerifyOrQuit(otPlatAlarmMicroGetNow() - start < kBenchmarkTimeout, "Host did not receive all frames");
+        DrainPty(aHostFd, decoder);
+    }
+
+    return otPlatAlarmMicroGetNow() - start;
+}
+
+void TestPtyBenchmark(void)
+{
+    int            hostFd = -1;
+    int            ncpFd  = -1;
+    struct termios tios;
+    PtyHost        host;
+    uint32_t       plainDuration;
+    uint32_t       batchDuration;
+    uint32_t       plainTransportFrames;
+
+    printf("Test 5: Frames per second over a pty");
+
+    hostFd = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (hostFd < 0 || grantpt(hostFd) != 0 || unlockpt(hostFd) != 0 ||
+        (ncpFd = open(ptsname(hostFd), O_RDWR | O_NOCTTY)) < 0)
+    {
+        printf(" -- SKIPPED (no pty available)\n");
+        ExitNow();
+    }
+
+    // Pass the HDLC bytes through unchanged.
+    VerifyOrQuit(tcgetattr(ncpFd, &tios) == 0, "tcgetattr() failed");
+    cfmakeraw(&tios);
+    VerifyOrQuit(tcsetattr(ncpFd, TCSANOW, &tios) == 0, "tcsetattr() failed");
+
+    VerifyOrQuit(fcntl(hostFd, F_SETFL, fcntl(hostFd, F_GETFL) | O_NONBLOCK) == 0, "fcntl() failed");
+    VerifyOrQuit(fcntl(ncpFd, F_SETFL, fcntl(ncpFd, F_GETFL) | O_NONBLOCK) == 0, "fcntl() failed");
+
+    plainDuration = RunPtyBenchmark(ncpFd, hostFd, false, host);
+    VerifyOrQuit(host.mNumFrames == kBenchmarkFrames, "Host did not receive all frames");
+    plainTransportFrames = host.mNumTransportFrames;
+
+    batchDuration = RunPtyBenchmark(ncpFd, hostFd, true, host);
+    VerifyOrQuit(host.mNumFrames == kBenchmarkFrames, "Host did not receive all batched frames");
+    VerifyOrQuit(host.mNumTransportFrames < plainTransportFrames, "Batching did not reduce the transport frames");
+
+    printf(" -- PASS\n%d frames of %d bytes: unbatched %lu frames/sec (%lu HDLC frames), "
+           "batched %lu frames/sec (%lu HDLC frames)\n",
+           kBenchmarkFrames, 2 + kBenchmarkDataSize,
+           static_cast<unsigned long>(kBenchmarkFrames * 1000000ULL / (plainDuration + 1)),
+           static_cast<unsigned long>(plainTransportFrames),
+           static_cast<unsigned long>(kBenchmarkFrames * 1000000ULL / (batchDuration + 1)),
+           static_cast<unsigned long>(host.mNumTransportFrames));
+
+exit:
+    if (ncpFd >= 0)
+    {
+        close(ncpFd);
+    }
+
+    if (hostFd >= 0)
+    {
+        close(hostFd);
+    }
+}
+
+} // namespace Ncp
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::Ncp::TestSpinelBatcher();
+    ot::Ncp::TestFuzzSpinelBatcher();
+    ot::Ncp::TestPtyBenchmark();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
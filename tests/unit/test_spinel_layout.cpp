@@ -0,0 +1,437 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "ncp/spinel_layout.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+namespace Ncp {
+
+enum
+{
+    kTestBufferSize   = 800,
+    kMaxTestDataSize  = 100,
+    kFuzzIterations   = 20000,
+    kBenchmarkLoops   = 200000,
+    kMaxUintPackedBit = 21, // SPINEL_MAX_UINT_PACKED is 2^21 - 1.
+};
+
+typedef SpinelLayout<SpinelField::Bool,
+                     SpinelField::Uint8,
+                     SpinelField::Int8,
+                     SpinelField::Uint16,
+                     SpinelField::Int16,
+                     SpinelField::Uint32,
+                     SpinelField::Int32,
+                     SpinelField::UintPacked>
+    ScalarLayout;
+
+typedef SpinelLayout<SpinelField::Uint64,
+                     SpinelField::Int64,
+                     SpinelField::Eui64,
+                     SpinelField::Ipv6Addr,
+                     SpinelField::DataWlen,
+                     SpinelField::UintPacked,
+                     SpinelField::Data>
+    BlockLayout;
+
+// Header, command, key, frame, channel, max CSMA backoffs, max frame retries and CSMA/CA enabled.
+typedef SpinelLayout<SpinelField::Uint8,
+                     SpinelField::UintPacked,
+                     SpinelField::UintPacked,
+                     SpinelField::DataWlen,
+                     SpinelField::Uint8,
+                     SpinelField::Uint8,
+                     SpinelField::Uint8,
+                     SpinelField::Bool>
+    TransmitLayout;
+
+static uint32_t GetRandom32(void)
+{
+    return (static_cast<uint32_t>(rand()) << 16) ^ static_cast<uint32_t>(rand());
+}
+
+static uint64_t GetRandom64(void)
+{
+    return (static_cast<uint64_t>(GetRandom32()) << 32) | GetRandom32();
+}
+
+static unsigned int GetRandomUintPacked(void)
+{
+    // Pick a random bit width so that all packed encoding sizes are covered.
+    return GetRandom32() & ((1U << (rand() % kMaxUintPackedBit)) - 1);
+}
+
+static void FillRandom(uint8_t *aBuffer, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuffer[i] = static_cast<uint8_t>(rand());
+    }
+}
+
+void TestSpinelLayoutFormat(void)
+{
+    printf("Testing SpinelLayout::GetFormat()");
+
+    VerifyOrQuit(strcmp(ScalarLayout::GetFormat(), "bCcSsLli") == 0, "ScalarLayout format is incorrect");
+    VerifyOrQuit(strcmp(BlockLayout::GetFormat(), "XxE6diD") == 0, "BlockLayout format is incorrect");
+    VerifyOrQuit(strcmp(TransmitLayout::GetFormat(), "CiidCCCb") == 0, "TransmitLayout format is incorrect");
+    VerifyOrQuit(strcmp(SpinelLayout<SpinelField::UintPacked>::GetFormat(), SPINEL_DATATYPE_UINT_PACKED_S) == 0,
+                 "Single field format is incorrect");
+
+    printf(" -- PASS\n");
+}
+
+void TestSpinelLayoutScalarEquivalence(void)
+{
+    uint8_t        expected[kTestBufferSize];
+    uint8_t        actual[kTestBufferSize];
+    spinel_ssize_t expectedLen;
+    spinel_ssize_t actualLen;
+
+    printf("Testing SpinelLayout against spinel_datatype_pack/unpack() with scalar fields");
+
+    for (int iter = 0; iter < kFuzzIterations; iter++)
+    {
+        bool          bool_1   = (rand() & 1) != 0;
+        uint8_t       uint8_1  = static_cast<uint8_t>(rand());
+        int8_t        int8_1   = static_cast<int8_t>(rand());
+        uint16_t      uint16_1 = static_cast<uint16_t>(rand());
+        int16_t       int16_1  = static_cast<int16_t>(rand());
+        uint32_t      uint32_1 = GetRandom32();
+        int32_t       int32_1  = static_cast<int32_t>(GetRandom32());
+        unsigned int  uint_1   = GetRandomUintPacked();
+        spinel_size_t bufferLen;
+
+        bool         bool_2;
+        uint8_t      uint8_2;
+        int8_t       int8_2;
+        uint16_t     uint16_2;
+        int16_t      int16_2;
+        uint32_t     uint32_2;
+        int32_t      int32_2;
+        unsigned int uint_2;
+
+        // Pack with a full buffer and with a randomly truncated one.
+
+        bufferLen = (iter % 2 == 0) ? sizeof(expected) : static_cast<spinel_size_t>(rand() % 16);
+
+        memset(expected, 0, sizeof(expected));
+        memset(actual, 0, sizeof(actual));
+
+        expectedLen = spinel_datatype_pack(expected, bufferLen, ScalarLayout::GetFormat(), bool_1, uint8_1, int8_1,
+                                           uint16_1, int16_1, uint32_1, int32_1, uint_1);
+        actualLen = ScalarLayout::Pack(actual, bufferLen, bool_1, uint8_1, int8_1, uint16_1, int16_1, uint32_1, int32_1,
+                                       uint_1);
+
+        VerifyOrQuit(actualLen == expectedLen, "Pack() length does not match spinel_datatype_pack()");
+        VerifyOrQuit(memcmp(actual, expected, sizeof(actual)) == 0, "Pack() output does not match");
+
+        if (static_cast<spinel_size_t>(actualLen) > bufferLen)
+        {
+            continue;
+        }
+
+        // Unpack the whole frame and a randomly truncated one.
+
+        if (iter % 4 == 1)
+        {
+            actualLen = static_cast<spinel_ssize_t>(rand() % actualLen);
+        }
+
+        expectedLen = spinel_datatype_unpack(expected, static_cast<spinel_size_t>(actualLen),
+                                             ScalarLayout::GetFormat(), &bool_2, &uint8_2, &int8_2, &uint16_2,
+                                             &int16_2, &uint32_2, &int32_2, &uint_2);
+        actualLen   = ScalarLayout::Unpack(actual, static_cast<spinel_size_t>(actualLen), &bool_2, &uint8_2, &int8_2,
+                                         &uint16_2, &int16_2, &uint32_2, &int32_2, &uint_2);
+
+        // `spinel_datatype_unpack()` may return a partial length for a frame truncated within a 'd' or 'i' field,
+        // `Unpack()` reports such frames as invalid.
+        VerifyOrQuit(expectedLen >= 0 || actualLen < 0, "Unpack() accepted a frame spinel_datatype_unpack() rejects");
+
+        if (actualLen > 0)
+        {
+            VerifyOrQuit(actualLen == expectedLen, "Unpack() length does not match spinel_datatype_unpack()");
+            VerifyOrQuit(bool_2 == bool_1 && uint8_2 == uint8_1 && int8_2 == int8_1 && uint16_2 == uint16_1 &&
+                             int16_2 == int16_1 && uint32_2 == uint32_1 && int32_2 == int32_1 && uint_2 == uint_1,
+                         "Unpack() value does not match");
+        }
+    }
+
+    // Values out of the packed uint range must fail in both.
+
+    expectedLen = spinel_datatype_pack(expected, sizeof(expected), SPINEL_DATATYPE_UINT_PACKED_S,
+                                       static_cast<unsigned int>(SPINEL_MAX_UINT_PACKED));
+    actualLen = SpinelLayout<SpinelField::UintPacked>::Pack(actual, sizeof(actual), SPINEL_MAX_UINT_PACKED);
+    VerifyOrQuit(expectedLen < 0 && actualLen < 0, "Pack() accepted an out of range packed uint");
+
+    printf(" -- PASS\n");
+}
+
+void TestSpinelLayoutBlockEquivalence(void)
+{
+    uint8_t        expected[kTestBufferSize];
+    uint8_t        actual[kTestBufferSize];
+    spinel_ssize_t expectedLen;
+    spinel_ssize_t actualLen;
+
+    printf("Testing SpinelLayout against spinel_datatype_pack/unpack() with block fields");
+
+    for (int iter = 0; iter < kFuzzIterations; iter++)
+    {
+        uint64_t          uint64_1 = GetRandom64();
+        int64_t           int64_1  = static_cast<int64_t>(GetRandom64());
+        spinel_eui64_t    eui64_1;
+        spinel_ipv6addr_t ip6Addr_1;
+        uint8_t           data_1[kMaxTestDataSize];
+        uint16_t          dataLen_1 = static_cast<uint16_t>(rand() % kMaxTestDataSize);
+        unsigned int      uint_1    = GetRandomUintPacked();
+        uint8_t           data_2[kMaxTestDataSize];
+        uint16_t          dataLen_2 = static_cast<uint16_t>(rand() % kMaxTestDataSize);
+        spinel_size_t     bufferLen;
+
+        uint64_t                 uint64_3;
+        int64_t                  int64_3;
+        const spinel_eui64_t *   eui64_3;
+        const spinel_ipv6addr_t *ip6Addr_3;
+        const uint8_t *          data_3;
+        unsigned int             dataLen_3;
+        unsigned int             uint_3;
+        const uint8_t *          data_4;
+        unsigned int             dataLen_4;
+
+        const uint8_t *eui64_5;
+        const uint8_t *ip6Addr_5;
+        uint64_t       uint64_5 = 0;
+        int64_t        int64_5  = 0;
+        SpinelData     data_5;
+        unsigned int   uint_5;
+        SpinelData     data_6;
+
+        FillRandom(eui64_1.bytes, sizeof(eui64_1));
+        FillRandom(ip6Addr_1.bytes, sizeof(ip6Addr_1));
+        FillRandom(data_1, dataLen_1);
+        FillRandom(data_2, dataLen_2);
+
+        bufferLen = (iter % 2 == 0) ? sizeof(expected) : static_cast<spinel_size_t>(rand() % 256);
+
+        memset(expected, 0, sizeof(expected));
+        memset(actual, 0, sizeof(actual));
+
+        expectedLen = spinel_datatype_pack(expected, bufferLen, BlockLayout::GetFormat(), uint64_1, int64_1, &eui64_1,
+                                           &ip6Addr_1, data_1, static_cast<uint32_t>(dataLen_1), uint_1, data_2,
+                                           static_cast<uint32_t>(dataLen_2));
+        actualLen   = BlockLayout::Pack(actual, bufferLen, uint64_1, int64_1, eui64_1.bytes, ip6Addr_1.bytes,
+                                      SpinelData(data_1, dataLen_1), uint_1, SpinelData(data_2, dataLen_2));
+
+        VerifyOrQuit(actualLen == expectedLen, "Pack() length does not match spinel_datatype_pack()");
+        VerifyOrQuit(memcmp(actual, expected, sizeof(actual)) == 0, "Pack() output does not match");
+
+        if (static_cast<spinel_size_t>(actualLen) > bufferLen)
+        {
+            continue;
+        }
+
+        if (iter % 4 == 2)
+        {
+            actualLen = static_cast<spinel_ssize_t>(rand() % actualLen);
+        }
+
+        expectedLen = spinel_datatype_unpack(expected, static_cast<spinel_size_t>(actualLen), BlockLayout::GetFormat(),
+                                             &uint64_3, &int64_3, &eui64_3, &ip6Addr_3, &data_3, &dataLen_3, &uint_3,
+                                             &data_4, &dataLen_4);
+        actualLen   = BlockLayout::Unpack(actual, static_cast<spinel_size_t>(actualLen), &uint64_5, &int64_5,
+                                        &eui64_5, &ip6Addr_5, &data_5, &uint_5, &data_6);
+
+        // `spinel_datatype_unpack()` may return a partial length for a frame truncated within a 'd' or 'i' field,
+        // `Unpack()` reports such frames as invalid.
+        VerifyOrQuit(expectedLen >= 0 || actualLen < 0, "Unpack() accepted a frame spinel_datatype_unpack() rejects");
+
+        if (actualLen > 0)
+        {
+            VerifyOrQuit(actualLen == expectedLen, "Unpack() length does not match spinel_datatype_unpack()");
+            VerifyOrQuit(uint64_5 == uint64_1 && int64_5 == int64_1 && uint_5 == uint_1, "Unpack() value mismatch");
+            VerifyOrQuit(memcmp(eui64_5, eui64_1.bytes, sizeof(eui64_1)) == 0, "Unpack() EUI64 mismatch");
+            VerifyOrQuit(memcmp(ip6Addr_5, ip6Addr_1.bytes, sizeof(ip6Addr_1)) == 0, "Unpack() IPv6 mismatch");
+            VerifyOrQuit(data_5.mLength == dataLen_1 && memcmp(data_5.mData, data_1, dataLen_1) == 0,
+                         "Unpack() data mismatch");
+            VerifyOrQuit(data_6.mLength == dataLen_4 && memcmp(data_6.mData, data_2, dataLen_4) == 0,
+                         "Unpack() data mismatch");
+            VerifyOrQuit(data_5.mData - actual == data_3 - expected && data_6.mData - actual == data_4 - expected,
+                         "Unpack() data offset mismatch");
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestSpinelLayoutUnpackRandomInput(void)
+{
+    uint8_t buffer[64];
+
+    printf("Testing SpinelLayout::Unpack() against spinel_datatype_unpack() with random input");
+
+    for (int iter = 0; iter < kFuzzIterations; iter++)
+    {
+        spinel_size_t  length = static_cast<spinel_size_t>(rand() % sizeof(buffer));
+        uint8_t        header_1, header_2 = 0;
+        unsigned int   cmd_1, cmd_2 = 0;
+        unsigned int   key_1, key_2;
+        const uint8_t *data_1;
+        unsigned int   dataLen_1;
+        SpinelData     data_2;
+        spinel_ssize_t expectedLen;
+        spinel_ssize_t actualLen;
+
+        FillRandom(buffer, sizeof(buffer));
+
+        // Keep the packed uints short most of the time so that frames are likely to be well formed.
+        if (rand() % 4 != 0)
+        {
+            buffer[1] &= 0x7f;
+            buffer[2] &= 0x7f;
+        }
+
+        expectedLen = spinel_datatype_unpack(buffer, length, "CiiD", &header_1, &cmd_1, &key_1, &data_1, &dataLen_1);
+        actualLen   = SpinelLayout<SpinelField::Uint8, SpinelField::UintPacked, SpinelField::UintPacked,
+                                 SpinelField::Data>::Unpack(buffer, length, &header_2, &cmd_2, &key_2, &data_2);
+
+        // `spinel_datatype_unpack()` may return a partial length for a frame truncated within a 'd' or 'i' field,
+        // `Unpack()` reports such frames as invalid.
+        VerifyOrQuit(expectedLen >= 0 || actualLen < 0, "Unpack() accepted a frame spinel_datatype_unpack() rejects");
+
+        if (actualLen > 0)
+        {
+            VerifyOrQuit(actualLen == expectedLen, "Unpack() length does not match spinel_datatype_unpack()");
+            VerifyOrQuit(header_1 == header_2 && cmd_1 == cmd_2 && key_1 == key_2, "Unpack() value mismatch");
+            VerifyOrQuit(data_1 == data_2.mData && dataLen_1 == data_2.mLength, "Unpack() data mismatch");
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestSpinelLayoutPerformance(void)
+{
+    uint8_t           buffer[kTestBufferSize];
+    uint8_t           psdu[127];
+    uint32_t          start;
+    uint32_t          interpreterPackDuration;
+    uint32_t          layoutPackDuration;
+    uint32_t          interpreterUnpackDuration;
+    uint32_t          layoutUnpackDuration;
+    spinel_ssize_t    packed = 0;
+    volatile uint32_t sum    = 0;
+
+    FillRandom(psdu, sizeof(psdu));
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kBenchmarkLoops; i++)
+    {
+        packed = spinel_datatype_pack(buffer, sizeof(buffer), TransmitLayout::GetFormat(), 0x81,
+                                      SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW, psdu,
+                                      static_cast<uint32_t>(sizeof(psdu)), 11 + (i & 15), 4, 3, true);
+    }
+
+    interpreterPackDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kBenchmarkLoops; i++)
+    {
+        packed = TransmitLayout::Pack(buffer, sizeof(buffer), 0x81, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_RAW,
+                                      SpinelData(psdu, sizeof(psdu)), static_cast<uint8_t>(11 + (i & 15)), 4, 3, true);
+    }
+
+    layoutPackDuration = otPlatAlarmMicroGetNow() - start;
+
+    VerifyOrQuit(packed > 0, "Pack() failed");
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kBenchmarkLoops; i++)
+    {
+        uint8_t        header, channel = 0, backoffs, retries;
+        unsigned int   cmd, key, length;
+        const uint8_t *frame;
+        bool           csma;
+
+        spinel_datatype_unpack(buffer, static_cast<spinel_size_t>(packed), TransmitLayout::GetFormat(), &header, &cmd,
+                               &key, &frame, &length, &channel, &backoffs, &retries, &csma);
+        sum += channel;
+    }
+
+    interpreterUnpackDuration = otPlatAlarmMicroGetNow() - start;
+
+    start = otPlatAlarmMicroGetNow();
+
+    for (int i = 0; i < kBenchmarkLoops; i++)
+    {
+        uint8_t      header, channel = 0, backoffs, retries;
+        unsigned int cmd, key;
+        SpinelData   frame;
+        bool         csma;
+
+        TransmitLayout::Unpack(buffer, static_cast<spinel_size_t>(packed), &header, &cmd, &key, &frame, &channel,
+                               &backoffs, &retries, &csma);
+        sum += channel;
+    }
+
+    layoutUnpackDuration = otPlatAlarmMicroGetNow() - start;
+
+    printf("Spinel STREAM_RAW frame x %d: pack format string %lu usec, layout %lu usec; "
+           "unpack format string %lu usec, layout %lu usec\n",
+           kBenchmarkLoops, static_cast<unsigned long>(interpreterPackDuration),
+           static_cast<unsigned long>(layoutPackDuration), static_cast<unsigned long>(interpreterUnpackDuration),
+           static_cast<unsigned long>(layoutUnpackDuration));
+}
+
+} // namespace Ncp
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::Ncp::TestSpinelLayoutFormat();
+    ot::Ncp::TestSpinelLayoutScalarEquivalence();
+    ot::Ncp::TestSpinelLayoutBlockEquivalence();
+    ot::Ncp::TestSpinelLayoutUnpackRandomInput();
+    ot::Ncp::TestSpinelLayoutPerformance();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -28,6 +28,8 @@
 
 #include "test_platform.h"
 
+#include <sys/time.h>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
@@ -559,11 +561,193 @@ int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * `StressTimer` sub-classes `ot::TimerMilli`, verifies that timers fire in order of their fire times and keeps track of
+ * number of times timer gets fired.
+ */
+class StressTimer : public ot::TimerMilli
+{
+public:
+    StressTimer(ot::Instance &aInstance)
+        : ot::TimerMilli(aInstance, StressTimer::HandleTimerFired, NULL)
+        , mFiredCounter(0)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer) { static_cast<StressTimer &>(aTimer).HandleTimerFired(); }
+
+    void HandleTimerFired(void)
+    {
+        VerifyOrQuit(!ot::TimerScheduler::IsStrictlyBefore(GetFireTime(), sLastFireTime),
+                     "TestTimerStress: Timers fired out of order.\n");
+        VerifyOrQuit(!ot::TimerScheduler::IsStrictlyBefore(sNow, GetFireTime()), "TestTimerStress: Timer fired early.\n");
+
+        sLastFireTime = GetFireTime();
+        sCallCount[kCallCountIndexTimerHandler]++;
+        mFiredCounter++;
+    }
+
+    uint32_t GetFiredCounter(void) { return mFiredCounter; }
+
+    static uint32_t sLastFireTime;
+
+private:
+    uint32_t mFiredCounter; //< Number of times timer has been fired so far
+};
+
+uint32_t StressTimer::sLastFireTime;
+
+static uint32_t sRandomState;
+
+static uint32_t GetWallClockUsec(void)
+{
+    // `otPlatAlarmMicroGetNow()` follows the simulated `sNow`, so use the wall clock for measuring durations.
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint32_t>(tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static uint32_t StressRandom(void)
+{
+    // xorshift32
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+/**
+ * Stress the TimerScheduler with thousands of timers that are started, restarted and stopped in random order, and
+ * report the average time spent per operation.
+ *
+ * `aTimeShift` is added to the start time so the timers can span the 32-bit wrap.
+ */
+static void TimerStress(uint32_t aTimeShift)
+{
+    enum
+    {
+        kNumTimers   = 4000,
+        kNumRestarts = 20000,
+        kMaxInterval = 100000,
+    };
+
+    ot::Instance *instance = testInitInstance();
+    StressTimer * timers[kNumTimers];
+    uint32_t      numRunning = 0;
+    uint32_t      numFired   = 0;
+    uint32_t      start;
+    uint32_t      startDuration;
+    uint32_t      restartDuration;
+    uint32_t      fireDuration;
+
+    printf("TestTimerStress() with aTimeShift=%-10u ", aTimeShift);
+
+    InitTestTimer();
+    InitCounters();
+
+    sRandomState               = 0x12345678;
+    sNow                       = aTimeShift - kMaxInterval / 2;
+    StressTimer::sLastFireTime = sNow;
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i] = new StressTimer(*instance);
+        VerifyOrQuit(timers[i] != NULL, "TestTimerStress: Allocation Failed.\n");
+    }
+
+    // Start all the timers.
+
+    start = GetWallClockUsec();
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers[i]->Start(StressRandom() % kMaxInterval);
+    }
+
+    startDuration = GetWallClockUsec() - start;
+
+    // Randomly restart or stop timers while time advances.
+
+    start = GetWallClockUsec();
+
+    for (uint32_t i = 0; i < kNumRestarts; i++)
+    {
+        StressTimer &timer = *timers[StressRandom() % kNumTimers];
+
+        sNow += StressRandom() % 4;
+
+        if (StressRandom() % 4 == 0)
+        {
+            timer.Stop();
+        }
+        else
+        {
+            timer.Start(StressRandom() % kMaxInterval);
+        }
+    }
+
+    restartDuration = GetWallClockUsec() - start;
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        numRunning += timers[i]->IsRunning() ? 1 : 0;
+    }
+
+    // Advance the time to each requested alarm and fire all the timers.
+
+    start = GetWallClockUsec();
+
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        otPlatAlarmMilliFired(instance);
+    }
+
+    fireDuration = GetWallClockUsec() - start;
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i]->IsRunning(), "TestTimerStress: Timer running Failed.\n");
+        numFired += timers[i]->GetFiredCounter();
+    }
+
+    VerifyOrQuit(numFired == numRunning, "TestTimerStress: Fired count Failed.\n");
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == numRunning, "TestTimerStress: Handler CallCount Failed.\n");
+
+    printf("--> PASSED (start %u ns, restart/stop %u ns, fire %u ns per timer)\n",
+           static_cast<unsigned int>(startDuration * 1000 / kNumTimers),
+           static_cast<unsigned int>(restartDuration * 1000 / kNumRestarts),
+           static_cast<unsigned int>(fireDuration * 1000 / numFired));
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        delete timers[i];
+    }
+
+    testFreeInstance(instance);
+}
+
+int TestTimerStress(void)
+{
+    const uint32_t kTimeShift[] = {0, 0U - 10000U, ot::Timer::kMaxDt};
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(kTimeShift); i++)
+    {
+        TimerStress(kTimeShift[i]);
+    }
+
+    return 0;
+}
+
 void RunTimerTests(void)
 {
     TestOneTimer();
     TestTwoTimers();
     TestTenTimers();
+    TestTimerStress();
 }
 
 #ifdef ENABLE_TEST_MAIN